@@ -0,0 +1,269 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "adapterselectortest.h"
+#include "autotests.h"
+#include "adapter.h"
+#include "device.h"
+#include "pendingcall.h"
+#include "connectjob.h"
+#include "connectionmanager.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString Address1 = QStringLiteral("40:79:6A:0C:39:75");
+static const QString Address2 = QStringLiteral("50:79:6A:0C:39:75");
+static const QString Address3 = QStringLiteral("60:79:6A:0C:39:75");
+
+AdapterSelectorTest::AdapterSelectorTest()
+    : m_manager(nullptr)
+    , m_selector(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void AdapterSelectorTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    const QStringList adapters = QStringList() << QStringLiteral("hci0") << QStringLiteral("hci1");
+    const QStringList addresses = QStringList() << Address1 << Address2 << Address3;
+
+    Q_FOREACH (const QString &adapter, adapters) {
+        const QString adapterPath = QStringLiteral("/org/bluez/") + adapter;
+
+        QVariantMap adapterProps;
+        adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+        adapterProps[QStringLiteral("Address")] = adapter == QLatin1String("hci0") ? QStringLiteral("1C:E5:C3:BC:94:7E") : QStringLiteral("2E:3A:C3:BC:85:7C");
+        adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+        adapterProps[QStringLiteral("Powered")] = true;
+        FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+        Q_FOREACH (const QString &address, addresses) {
+            QString path = adapterPath + QStringLiteral("/dev_") + address;
+            path.replace(QLatin1Char(':'), QLatin1Char('_'));
+
+            QVariantMap deviceProps;
+            deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(path));
+            deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+            deviceProps[QStringLiteral("Address")] = address;
+            deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+            deviceProps[QStringLiteral("UUIDs")] = QStringList();
+            FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+        }
+    }
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+    QCOMPARE(m_manager->adapters().count(), 2);
+    QCOMPARE(m_manager->devices().count(), 6);
+
+    m_adapter1 = m_manager->adapterForUbi(QStringLiteral("/org/bluez/hci0"));
+    m_adapter2 = m_manager->adapterForUbi(QStringLiteral("/org/bluez/hci1"));
+    QVERIFY(m_adapter1);
+    QVERIFY(m_adapter2);
+}
+
+void AdapterSelectorTest::cleanupTestCase()
+{
+    m_adapter1.clear();
+    m_adapter2.clear();
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void AdapterSelectorTest::init()
+{
+    m_selector = new AdapterSelector(m_manager);
+}
+
+void AdapterSelectorTest::cleanup()
+{
+    delete m_selector;
+    m_selector = nullptr;
+
+    Q_FOREACH (DevicePtr device, m_manager->devices()) {
+        if (device->isConnected()) {
+            device->disconnectFromDevice()->waitForFinished();
+            QTRY_VERIFY(!device->isConnected());
+        }
+    }
+}
+
+void AdapterSelectorTest::setAdapterPowered(const QString &path, bool powered)
+{
+    QVariantMap props;
+    props[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(path));
+    props[QStringLiteral("Name")] = QStringLiteral("Powered");
+    props[QStringLiteral("Value")] = powered;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("change-adapter-property"), props);
+
+    AdapterPtr adapter = m_manager->adapterForUbi(path);
+    QTRY_COMPARE(adapter->isPowered(), powered);
+}
+
+void AdapterSelectorTest::firstPoweredTest()
+{
+    m_selector->setPolicy(AdapterSelector::FirstPowered);
+
+    QCOMPARE(m_selector->selectAdapter(), m_adapter1);
+    QCOMPARE(m_selector->selectAdapter(), m_adapter1);
+    QCOMPARE(m_selector->selectionCount(m_adapter1), 2);
+    QCOMPARE(m_selector->selectionCount(m_adapter2), 0);
+
+    setAdapterPowered(m_adapter1->ubi(), false);
+    QCOMPARE(m_selector->selectAdapter(), m_adapter2);
+    QCOMPARE(m_selector->selectDevice(Address1)->adapter(), m_adapter2);
+
+    setAdapterPowered(m_adapter2->ubi(), false);
+    QVERIFY(!m_selector->selectAdapter());
+    QVERIFY(!m_selector->selectDevice(Address1));
+
+    setAdapterPowered(m_adapter1->ubi(), true);
+    setAdapterPowered(m_adapter2->ubi(), true);
+}
+
+void AdapterSelectorTest::roundRobinTest()
+{
+    m_selector->setPolicy(AdapterSelector::RoundRobin);
+
+    QCOMPARE(m_selector->selectAdapter(), m_adapter1);
+    QCOMPARE(m_selector->selectAdapter(), m_adapter2);
+    QCOMPARE(m_selector->selectAdapter(), m_adapter1);
+    QCOMPARE(m_selector->selectDevice(Address1)->adapter(), m_adapter2);
+    QCOMPARE(m_selector->selectDevice(Address2)->adapter(), m_adapter1);
+
+    QCOMPARE(m_selector->selectionCount(m_adapter1), 3);
+    QCOMPARE(m_selector->selectionCount(m_adapter2), 2);
+}
+
+void AdapterSelectorTest::leastConnectedTest()
+{
+    QCOMPARE(m_selector->policy(), AdapterSelector::LeastConnected);
+
+    // Selected devices are pending until connected
+    DevicePtr device1 = m_selector->selectDevice(Address1);
+    QCOMPARE(device1->adapter(), m_adapter1);
+    QCOMPARE(m_selector->pendingCount(m_adapter1), 1);
+
+    DevicePtr device2 = m_selector->selectDevice(Address2);
+    QCOMPARE(device2->adapter(), m_adapter2);
+    QCOMPARE(m_selector->pendingCount(m_adapter2), 1);
+
+    m_selector->release(device2);
+    QCOMPARE(m_selector->pendingCount(m_adapter2), 0);
+
+    device1->connectToDevice()->waitForFinished();
+    QTRY_VERIFY(device1->isConnected());
+    QCOMPARE(m_selector->connectedCount(m_adapter1), 1);
+    QCOMPARE(m_selector->pendingCount(m_adapter1), 0);
+
+    QCOMPARE(m_selector->selectDevice(Address3)->adapter(), m_adapter2);
+    QCOMPARE(m_selector->selectAdapter(), m_adapter1);
+}
+
+void AdapterSelectorTest::pinTest()
+{
+    m_selector->setPolicy(AdapterSelector::FirstPowered);
+
+    m_selector->pinAddress(Address1.toLower(), m_adapter2);
+    QCOMPARE(m_selector->pinnedAdapter(Address1), m_adapter2);
+    QCOMPARE(m_selector->selectDevice(Address1)->adapter(), m_adapter2);
+    QCOMPARE(m_selector->selectDevice(Address2)->adapter(), m_adapter1);
+
+    // Pinned device is not selected on other adapters
+    setAdapterPowered(m_adapter2->ubi(), false);
+    QVERIFY(!m_selector->selectDevice(Address1));
+    setAdapterPowered(m_adapter2->ubi(), true);
+
+    m_selector->unpinAddress(Address1);
+    QVERIFY(!m_selector->pinnedAdapter(Address1));
+    QCOMPARE(m_selector->selectDevice(Address1)->adapter(), m_adapter1);
+}
+
+void AdapterSelectorTest::connectToAddressTest()
+{
+    ConnectionManager connectionManager;
+
+    ConnectJob *job = connectionManager.connectToAddress(Address1);
+    QVERIFY(!job->exec());
+
+    connectionManager.setAdapterSelector(m_selector);
+    QCOMPARE(connectionManager.adapterSelector(), m_selector);
+
+    job = connectionManager.connectToAddress(Address1);
+    QCOMPARE(job->device()->adapter(), m_adapter1);
+    QVERIFY(job->exec());
+
+    job = connectionManager.connectToAddress(Address2);
+    QCOMPARE(job->device()->adapter(), m_adapter2);
+    QVERIFY(job->exec());
+
+    QTRY_COMPARE(m_selector->connectedCount(m_adapter1), 1);
+    QTRY_COMPARE(m_selector->connectedCount(m_adapter2), 1);
+    QCOMPARE(m_selector->pendingCount(m_adapter1), 0);
+    QCOMPARE(m_selector->pendingCount(m_adapter2), 0);
+}
+
+void AdapterSelectorTest::releaseTest()
+{
+    ConnectionManager connectionManager;
+    connectionManager.setAdapterSelector(m_selector);
+    m_selector->pinAddress(Address2, m_adapter1);
+
+    // Job deleted without being started
+    ConnectJob *job = connectionManager.connectToAddress(Address2);
+    QCOMPARE(m_selector->pendingCount(m_adapter1), 1);
+    delete job;
+    QCOMPARE(m_selector->pendingCount(m_adapter1), 0);
+
+    // Job killed while waiting in the queue behind another attempt
+    ConnectJob *blockingJob = connectionManager.connectToDevice(m_adapter1->deviceForAddress(Address3));
+    job = connectionManager.connectToAddress(Address2);
+    QCOMPARE(job->device()->adapter(), m_adapter1);
+
+    blockingJob->start();
+    job->start();
+    QTRY_COMPARE(connectionManager.pendingCount(), 2);
+
+    job->kill();
+    QCOMPARE(m_selector->pendingCount(m_adapter1), 1);
+
+    QTRY_COMPARE(connectionManager.pendingCount(), 0);
+    QCOMPARE(m_selector->pendingCount(m_adapter1), 0);
+}
+
+QTEST_MAIN(AdapterSelectorTest)
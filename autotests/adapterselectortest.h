@@ -0,0 +1,60 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ADAPTERSELECTORTEST_H
+#define ADAPTERSELECTORTEST_H
+
+#include <QObject>
+
+#include "manager.h"
+#include "adapterselector.h"
+
+class AdapterSelectorTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit AdapterSelectorTest();
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+    void firstPoweredTest();
+    void roundRobinTest();
+    void leastConnectedTest();
+    void pinTest();
+    void connectToAddressTest();
+    void releaseTest();
+
+private:
+    void setAdapterPowered(const QString &path, bool powered);
+
+    BluezQt::Manager *m_manager;
+    BluezQt::AdapterSelector *m_selector;
+    BluezQt::AdapterPtr m_adapter1;
+    BluezQt::AdapterPtr m_adapter2;
+};
+
+#endif // ADAPTERSELECTORTEST_H
@@ -23,6 +23,7 @@
 #include "device.h"
 #include "pendingcall.h"
 #include "initmanagerjob.h"
+#include "batchjob.h"
 
 #include <QtTest/QTest>
 #include <QtTest/QSignalSpy>
@@ -338,6 +339,75 @@ void AdapterTest::discoveryTest()
     }
 }
 
+void AdapterTest::discoveryFilterTest()
+{
+    Q_FOREACH (const AdapterUnit &unit, m_units) {
+        QVariantMap filter;
+        filter[QStringLiteral("Transport")] = QStringLiteral("le");
+        filter[QStringLiteral("UUIDs")] = QStringList(QStringLiteral("0000180D-0000-1000-8000-00805F9B34FB"));
+
+        PendingCall *call = unit.adapter->setDiscoveryFilter(filter);
+        call->waitForFinished();
+        QCOMPARE(call->error(), int(PendingCall::NoError));
+
+        call = unit.adapter->setDiscoveryFilter(QVariantMap());
+        call->waitForFinished();
+        QCOMPARE(call->error(), int(PendingCall::NoError));
+
+        filter[QStringLiteral("Transport")] = QStringLiteral("invalid");
+        call = unit.adapter->setDiscoveryFilter(filter);
+        call->waitForFinished();
+        QCOMPARE(call->error(), int(PendingCall::InvalidArguments));
+    }
+}
+
+void AdapterTest::removeDevicesTest()
+{
+    AdapterPtr adapter = m_units.first().adapter;
+    const int devicesCount = adapter->devices().count();
+
+    QVariantMap devicesProps;
+    devicesProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapter->ubi()));
+    devicesProps[QStringLiteral("Count")] = 20;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-devices"), devicesProps);
+    QTRY_COMPARE(adapter->devices().count(), devicesCount + 20);
+
+    QList<DevicePtr> devices;
+    Q_FOREACH (DevicePtr device, adapter->devices()) {
+        if (device->address().startsWith(QLatin1String("10:00:00"))) {
+            devices.append(device);
+        }
+    }
+    QCOMPARE(devices.count(), 20);
+
+    // Invalid device fails, other devices are still removed
+    devices.append(DevicePtr());
+
+    BatchJob *job = adapter->removeDevices(devices);
+    QSignalSpy progressSpy(job, SIGNAL(progress(BatchJob*,int,int)));
+    QSignalSpy resultSpy(job, SIGNAL(result(BatchJob*)));
+    int failedCount = 0;
+    int lastItemError = PendingCall::NoError;
+    connect(job, &BatchJob::result, this, [&](BatchJob *finishedJob) {
+        QCOMPARE(finishedJob->count(), 21);
+        QCOMPARE(finishedJob->finishedCount(), 21);
+        QCOMPARE(finishedJob->error(), int(BatchJob::UserDefinedError));
+        QCOMPARE(finishedJob->itemError(0), int(PendingCall::NoError));
+        failedCount = finishedJob->failedCount();
+        lastItemError = finishedJob->itemError(20);
+    });
+
+    job->setWindow(4);
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(progressSpy.count(), 21);
+    QCOMPARE(progressSpy.last().at(1).toInt(), 21);
+    QCOMPARE(failedCount, 1);
+    QCOMPARE(lastItemError, int(PendingCall::InvalidArguments));
+    QTRY_COMPARE(adapter->devices().count(), devicesCount);
+}
+
 void AdapterTest::removeDeviceTest()
 {
     Q_FOREACH (const AdapterUnit &unit, m_units) {
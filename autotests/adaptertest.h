@@ -50,6 +50,8 @@ private Q_SLOTS:
     void setPairableTimeoutTest();
 
     void discoveryTest();
+    void discoveryFilterTest();
+    void removeDevicesTest();
     void removeDeviceTest();
     void adapterRemovedTest();
 
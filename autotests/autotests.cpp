@@ -23,6 +23,8 @@
 #include "adapter.h"
 #include "mediaplayer.h"
 #include "mediaplayertrack.h"
+#include "gattservice.h"
+#include "gattcharacteristic.h"
 #include "bluezqt_dbustypes.h"
 
 #include <QDir>
@@ -181,6 +183,8 @@ void Autotests::registerMetatypes()
     qRegisterMetaType<BluezQt::DevicePtr>("DevicePtr");
     qRegisterMetaType<BluezQt::AdapterPtr>("AdapterPtr");
     qRegisterMetaType<BluezQt::MediaPlayerPtr>("MediaPlayerPtr");
+    qRegisterMetaType<BluezQt::GattServicePtr>("GattServicePtr");
+    qRegisterMetaType<BluezQt::GattCharacteristicPtr>("GattCharacteristicPtr");
 }
 
 void Autotests::verifyPropertiesChangedSignal(const QSignalSpy &spy, const QString &propertyName, const QVariant &propertyValue)
@@ -0,0 +1,228 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "callschedulertest.h"
+#include "autotests.h"
+#include "adapter.h"
+#include "device.h"
+#include "pendingcall.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+CallSchedulerTest::CallSchedulerTest()
+    : m_manager(nullptr)
+    , m_scheduler(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void CallSchedulerTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0/dev_40_79_6A_0C_39_75")));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    deviceProps[QStringLiteral("UUIDs")] = QStringList();
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+    QCOMPARE(m_manager->devices().count(), 1);
+}
+
+void CallSchedulerTest::cleanupTestCase()
+{
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void CallSchedulerTest::init()
+{
+    m_scheduler = new CallScheduler();
+    m_scheduler->setMaxInFlightPerAdapter(1);
+    Manager::setCallScheduler(m_scheduler);
+    m_finished.clear();
+}
+
+void CallSchedulerTest::cleanup()
+{
+    QTRY_COMPARE(m_scheduler->inFlightCount(), 0);
+
+    Manager::setCallScheduler(nullptr);
+    delete m_scheduler;
+    m_scheduler = nullptr;
+}
+
+void CallSchedulerTest::trackCall(PendingCall *call, const QString &name)
+{
+    connect(call, &PendingCall::finished, this, [this, name](PendingCall *finishedCall) {
+        QVERIFY(!finishedCall->error());
+        m_finished.append(name);
+    });
+}
+
+void CallSchedulerTest::noSchedulerTest()
+{
+    Manager::setCallScheduler(nullptr);
+    QVERIFY(!Manager::callScheduler());
+
+    DevicePtr device = m_manager->devices().first();
+    for (int i = 0; i < 3; ++i) {
+        trackCall(device->setTrusted(i % 2 == 0), QStringLiteral("B%1").arg(i));
+    }
+
+    // All calls are sent immediately
+    QCOMPARE(m_scheduler->inFlightCount(), 0);
+    QCOMPARE(m_scheduler->queueDepth(CallScheduler::Background), 0);
+    QTRY_COMPARE(m_finished.count(), 3);
+
+    Manager::setCallScheduler(m_scheduler);
+    QCOMPARE(Manager::callScheduler(), m_scheduler);
+}
+
+void CallSchedulerTest::priorityTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    AdapterPtr adapter = m_manager->adapters().first();
+
+    for (int i = 0; i < 4; ++i) {
+        trackCall(device->setTrusted(i % 2 == 0), QStringLiteral("B%1").arg(i));
+    }
+    trackCall(adapter->setName(QStringLiteral("Name1")), QStringLiteral("I0"));
+
+    QCOMPARE(m_scheduler->inFlightCount(), 1);
+    QCOMPARE(m_scheduler->queueDepth(CallScheduler::Background), 3);
+    QCOMPARE(m_scheduler->queueDepth(CallScheduler::Interactive), 1);
+
+    // Interactive call overtakes queued background calls
+    QTRY_COMPARE(m_finished.count(), 5);
+    QCOMPARE(m_finished, QStringList() << QStringLiteral("B0") << QStringLiteral("I0")
+             << QStringLiteral("B1") << QStringLiteral("B2") << QStringLiteral("B3"));
+
+    QCOMPARE(m_scheduler->dispatchedCount(CallScheduler::Background), 4);
+    QCOMPARE(m_scheduler->dispatchedCount(CallScheduler::Interactive), 1);
+    QVERIFY(m_scheduler->maximumWaitTime(CallScheduler::Background) >= m_scheduler->averageWaitTime(CallScheduler::Background));
+
+    m_scheduler->resetMetrics();
+    QCOMPARE(m_scheduler->dispatchedCount(CallScheduler::Background), 0);
+}
+
+void CallSchedulerTest::fairnessTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    AdapterPtr adapter = m_manager->adapters().first();
+
+    m_scheduler->setInteractiveBurst(1);
+
+    trackCall(device->setTrusted(true), QStringLiteral("B0"));
+    for (int i = 0; i < 3; ++i) {
+        trackCall(adapter->setName(QStringLiteral("Name%1").arg(i)), QStringLiteral("I%1").arg(i));
+    }
+    for (int i = 1; i < 3; ++i) {
+        trackCall(device->setTrusted(i % 2 == 0), QStringLiteral("B%1").arg(i));
+    }
+
+    // Background calls get through between interactive calls
+    QTRY_COMPARE(m_finished.count(), 6);
+    QCOMPARE(m_finished, QStringList() << QStringLiteral("B0") << QStringLiteral("I0")
+             << QStringLiteral("B1") << QStringLiteral("I1") << QStringLiteral("B2") << QStringLiteral("I2"));
+}
+
+void CallSchedulerTest::cancelQueuedTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    trackCall(device->setTrusted(true), QStringLiteral("B0"));
+    PendingCall *call = device->setTrusted(false);
+    trackCall(call, QStringLiteral("B1"));
+    trackCall(device->setTrusted(true), QStringLiteral("B2"));
+
+    QVERIFY(!call->isFinished());
+    QCOMPARE(m_scheduler->queueDepth(CallScheduler::Background), 2);
+
+    call->cancel();
+    QVERIFY(call->isFinished());
+    QCOMPARE(m_scheduler->queueDepth(CallScheduler::Background), 1);
+
+    QTRY_COMPARE(m_finished.count(), 2);
+    QTest::qWait(50);
+    QCOMPARE(m_finished, QStringList() << QStringLiteral("B0") << QStringLiteral("B2"));
+    QCOMPARE(m_scheduler->dispatchedCount(CallScheduler::Background), 2);
+}
+
+void CallSchedulerTest::waitForFinishedTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    trackCall(device->setTrusted(true), QStringLiteral("B0"));
+    PendingCall *call = device->setTrusted(false);
+    trackCall(call, QStringLiteral("B1"));
+
+    // Waiting for a queued call sends it right away
+    call->waitForFinished();
+    QCOMPARE(m_scheduler->queueDepth(CallScheduler::Background), 0);
+
+    QTRY_COMPARE(m_finished.count(), 2);
+}
+
+void CallSchedulerTest::deleteSchedulerTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    for (int i = 0; i < 3; ++i) {
+        trackCall(device->setTrusted(i % 2 == 0), QStringLiteral("B%1").arg(i));
+    }
+    QCOMPARE(m_scheduler->queueDepth(CallScheduler::Background), 2);
+
+    // Queued calls are sent when scheduler is deleted
+    delete m_scheduler;
+    QVERIFY(!Manager::callScheduler());
+    m_scheduler = new CallScheduler();
+
+    QTRY_COMPARE(m_finished.count(), 3);
+}
+
+QTEST_MAIN(CallSchedulerTest)
@@ -0,0 +1,312 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "connectionmanagertest.h"
+#include "autotests.h"
+#include "device.h"
+#include "pendingcall.h"
+#include "connectjob.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString MediaPlayerUuid = QStringLiteral("0000110E-0000-1000-8000-00805F9B34FB");
+static const QString NotReadyUuid = QStringLiteral("0000FFFE-0000-1000-8000-00805F9B34FB");
+static const QString InProgressUuid = QStringLiteral("0000FFFD-0000-1000-8000-00805F9B34FB");
+
+ConnectionManagerTest::ConnectionManagerTest()
+    : m_manager(nullptr)
+    , m_connectionManager(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void ConnectionManagerTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0/dev_40_79_6A_0C_39_75")));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    deviceProps[QStringLiteral("UUIDs")] = QStringList(MediaPlayerUuid);
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0/dev_50_79_6A_0C_39_75")));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("50:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice2");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+    QCOMPARE(m_manager->devices().count(), 2);
+}
+
+void ConnectionManagerTest::cleanupTestCase()
+{
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void ConnectionManagerTest::init()
+{
+    m_connectionManager = new ConnectionManager();
+    m_connectionManager->setInitialBackoff(10);
+    m_connectionManager->setMaximumBackoff(40);
+
+    // Tests check the exact delays
+    m_connectionManager->setJitter(0);
+}
+
+void ConnectionManagerTest::cleanup()
+{
+    QTRY_COMPARE(m_connectionManager->pendingCount(), 0);
+
+    delete m_connectionManager;
+    m_connectionManager = nullptr;
+
+    Q_FOREACH (DevicePtr device, m_manager->devices()) {
+        if (device->isConnected()) {
+            device->disconnectFromDevice()->waitForFinished();
+            QTRY_VERIFY(!device->isConnected());
+        }
+    }
+}
+
+void ConnectionManagerTest::connectTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    QCOMPARE(m_connectionManager->lastLatency(device), -1);
+
+    QSignalSpy finishedSpy(m_connectionManager, SIGNAL(connectFinished(DevicePtr,int,int)));
+
+    ConnectJob *job = m_connectionManager->connectToDevice(device);
+    QSignalSpy resultSpy(job, SIGNAL(result(ConnectJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::NoError));
+    QCOMPARE(job->callError(), int(PendingCall::NoError));
+    QCOMPARE(job->attempts(), 1);
+    QVERIFY(job->latency() >= 0);
+    QCOMPARE(m_connectionManager->lastLatency(device), job->latency());
+    QVERIFY(device->isConnected());
+
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(finishedSpy.first().at(1).toInt(), int(PendingCall::NoError));
+}
+
+void ConnectionManagerTest::deduplicateTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    QSignalSpy finishedSpy(m_connectionManager, SIGNAL(connectFinished(DevicePtr,int,int)));
+
+    ConnectJob *job1 = m_connectionManager->connectProfile(device, MediaPlayerUuid);
+    ConnectJob *job2 = m_connectionManager->connectProfile(device, MediaPlayerUuid.toLower());
+    QSignalSpy resultSpy1(job1, SIGNAL(result(ConnectJob*)));
+    QSignalSpy resultSpy2(job2, SIGNAL(result(ConnectJob*)));
+    job1->start();
+    job2->start();
+
+    QTRY_COMPARE(m_connectionManager->pendingCount(), 1);
+    QTRY_COMPARE(resultSpy1.count(), 1);
+    QTRY_COMPARE(resultSpy2.count(), 1);
+    QCOMPARE(job1->error(), int(Job::NoError));
+    QCOMPARE(job2->error(), int(Job::NoError));
+
+    // Both jobs finished with one attempt
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(job1->attempts(), 1);
+    QCOMPARE(job2->attempts(), 1);
+}
+
+void ConnectionManagerTest::alreadyConnectedTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    ConnectJob *job = m_connectionManager->connectProfile(device, MediaPlayerUuid);
+    QVERIFY(job->exec());
+
+    job = m_connectionManager->connectProfile(device, MediaPlayerUuid);
+    QSignalSpy resultSpy(job, SIGNAL(result(ConnectJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::NoError));
+    QCOMPARE(job->callError(), int(PendingCall::NoError));
+    QCOMPARE(job->attempts(), 1);
+}
+
+void ConnectionManagerTest::retryTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    m_connectionManager->setMaxRetries(2);
+
+    ConnectJob *job = m_connectionManager->connectProfile(device, NotReadyUuid);
+    QSignalSpy resultSpy(job, SIGNAL(result(ConnectJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::UserDefinedError));
+    QCOMPARE(job->callError(), int(PendingCall::NotReady));
+    QCOMPARE(job->attempts(), 3);
+
+    // Backoff 10 ms + 20 ms
+    QVERIFY(job->latency() >= 30);
+}
+
+void ConnectionManagerTest::jitterTest()
+{
+    ConnectionManager connectionManager;
+    QCOMPARE(connectionManager.jitter(), 0.3);
+    connectionManager.setJitter(2.0);
+    QCOMPARE(connectionManager.jitter(), 1.0);
+
+    DevicePtr device = m_manager->devices().first();
+    m_connectionManager->setMaxRetries(2);
+    m_connectionManager->setJitter(0.5);
+
+    ConnectJob *job = m_connectionManager->connectProfile(device, NotReadyUuid);
+    QSignalSpy resultSpy(job, SIGNAL(result(ConnectJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->attempts(), 3);
+
+    // Backoff 10 ms + 20 ms, each at least halved
+    QVERIFY(job->latency() >= 15);
+}
+
+void ConnectionManagerTest::inProgressRetryTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    // First attempt fails with InProgress, the retry succeeds
+    ConnectJob *job = m_connectionManager->connectProfile(device, InProgressUuid);
+    QSignalSpy resultSpy(job, SIGNAL(result(ConnectJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::NoError));
+    QCOMPARE(job->callError(), int(PendingCall::NoError));
+    QCOMPARE(job->attempts(), 2);
+    QTRY_VERIFY(device->isConnected());
+}
+
+void ConnectionManagerTest::nonRetryableTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    ConnectJob *job = m_connectionManager->connectProfile(device, QStringLiteral("00001234-0000-1000-8000-00805F9B34FB"));
+    QSignalSpy resultSpy(job, SIGNAL(result(ConnectJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::UserDefinedError));
+    QCOMPARE(job->callError(), int(PendingCall::DoesNotExist));
+    QCOMPARE(job->attempts(), 1);
+}
+
+void ConnectionManagerTest::serializeTest()
+{
+    DevicePtr device1 = m_manager->devices().at(0);
+    DevicePtr device2 = m_manager->devices().at(1);
+    m_connectionManager->setMaxRetries(2);
+
+    QStringList finished;
+    ConnectJob *job1 = m_connectionManager->connectProfile(device1, NotReadyUuid);
+    ConnectJob *job2 = m_connectionManager->connectToDevice(device2);
+    connect(job1, &ConnectJob::result, this, [&finished]() {
+        finished.append(QStringLiteral("job1"));
+    });
+    connect(job2, &ConnectJob::result, this, [&finished]() {
+        finished.append(QStringLiteral("job2"));
+    });
+    job1->start();
+    job2->start();
+
+    // Second attempt waits until the first one finishes, including its retries
+    QTRY_COMPARE(finished.count(), 2);
+    QCOMPARE(finished, QStringList() << QStringLiteral("job1") << QStringLiteral("job2"));
+
+    // Both attempts run concurrently
+    m_connectionManager->setMaxAttemptsPerAdapter(2);
+    finished.clear();
+
+    job1 = m_connectionManager->connectProfile(device1, NotReadyUuid);
+    job2 = m_connectionManager->connectProfile(device2, MediaPlayerUuid);
+    connect(job1, &ConnectJob::result, this, [&finished]() {
+        finished.append(QStringLiteral("job1"));
+    });
+    connect(job2, &ConnectJob::result, this, [&finished]() {
+        finished.append(QStringLiteral("job2"));
+    });
+    job1->start();
+    job2->start();
+
+    QTRY_COMPARE(finished.count(), 2);
+    QCOMPARE(finished, QStringList() << QStringLiteral("job2") << QStringLiteral("job1"));
+}
+
+void ConnectionManagerTest::killTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    m_connectionManager->setMaxRetries(5);
+
+    QSignalSpy finishedSpy(m_connectionManager, SIGNAL(connectFinished(DevicePtr,int,int)));
+
+    ConnectJob *job = m_connectionManager->connectProfile(device, NotReadyUuid);
+    QSignalSpy resultSpy(job, SIGNAL(result(ConnectJob*)));
+    job->start();
+
+    QTRY_COMPARE(m_connectionManager->pendingCount(), 1);
+    job->kill();
+
+    // No more retries without running jobs
+    QTRY_COMPARE(m_connectionManager->pendingCount(), 0);
+    QCOMPARE(resultSpy.count(), 0);
+    QCOMPARE(finishedSpy.count(), 1);
+}
+
+QTEST_MAIN(ConnectionManagerTest)
@@ -0,0 +1,245 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "coroutinestest.h"
+#include "autotests.h"
+#include "adapter.h"
+#include "device.h"
+#include "obexmanager.h"
+#include "initmanagerjob.h"
+#include "coroutines.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString unsupportedUuid = QStringLiteral("0000110a-0000-1000-8000-00805f9b34fb");
+
+static Task<> initManager(Manager *manager, int *error)
+{
+    InitManagerJob *job = co_await manager->init();
+    *error = job ? job->error() : -1;
+}
+
+static Task<> awaitJob(InitManagerJob *job, InitManagerJob **result)
+{
+    *result = co_await job;
+}
+
+static Task<> connectAndDisconnect(DevicePtr device, bool *wasConnected, int *error)
+{
+    PendingCall *call = co_await device->connectToDevice();
+    if (!call || call->error()) {
+        *error = call ? call->error() : -1;
+        co_return;
+    }
+
+    *wasConnected = device->isConnected();
+
+    call = co_await device->disconnectFromDevice();
+    *error = call ? call->error() : -1;
+}
+
+static Task<int> connectProfile(DevicePtr device, const QString &uuid)
+{
+    PendingCall *call = co_await device->connectProfile(uuid);
+    co_return call ? call->error() : -1;
+}
+
+static Task<> connectProfiles(DevicePtr device, int *error, bool *continued)
+{
+    // Error of the inner task is returned to the outer coroutine
+    *error = co_await connectProfile(device, unsupportedUuid);
+    *continued = true;
+}
+
+static Task<> createSession(ObexManager *manager, int *error)
+{
+    PendingReply<QDBusObjectPath> *reply = co_await manager->createSession(QStringLiteral("00:00:00:00:00:00"), QVariantMap());
+    *error = reply ? reply->error() : -1;
+}
+
+static Task<> awaitTask(Task<int> task, int *result)
+{
+    *result = co_await task;
+}
+
+static Task<> setName(AdapterPtr adapter, const QString &name, bool *resumed)
+{
+    co_await adapter->setName(name);
+    *resumed = true;
+}
+
+CoroutinesTest::CoroutinesTest()
+    : m_manager(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void CoroutinesTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0/dev_40_79_6A_0C_39_75")));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    deviceProps[QStringLiteral("UUIDs")] = QStringList();
+    deviceProps[QStringLiteral("Connected")] = false;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    m_manager = new Manager();
+    int error = -1;
+    Task<> task = initManager(m_manager, &error);
+
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(error, 0);
+    QVERIFY(m_manager->isInitialized());
+}
+
+void CoroutinesTest::cleanupTestCase()
+{
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void CoroutinesTest::initManagerTest()
+{
+    Manager manager;
+    int error = -1;
+    Task<> task = initManager(&manager, &error);
+
+    // Job is started by co_await, the coroutine is suspended until it finishes
+    QVERIFY(!task.isFinished());
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(error, 0);
+    QVERIFY(manager.isOperational());
+    QCOMPARE(manager.devices().count(), 1);
+}
+
+void CoroutinesTest::callSequenceTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    bool wasConnected = false;
+    int error = -1;
+    Task<> task = connectAndDisconnect(device, &wasConnected, &error);
+
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(error, int(PendingCall::NoError));
+    QVERIFY(wasConnected);
+    QTRY_VERIFY(!device->isConnected());
+}
+
+void CoroutinesTest::errorPropagationTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    bool continued = false;
+    int error = -1;
+    Task<> task = connectProfiles(device, &error, &continued);
+
+    QTRY_VERIFY(task.isFinished());
+    QVERIFY(continued);
+    QCOMPARE(error, int(PendingCall::DoesNotExist));
+}
+
+void CoroutinesTest::internalErrorTest()
+{
+    // Not initialized manager fails the call without D-Bus round trip
+    ObexManager manager;
+    int error = -1;
+    Task<> task = createSession(&manager, &error);
+
+    QVERIFY(!task.isFinished());
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(error, int(PendingCall::InternalError));
+}
+
+void CoroutinesTest::cancelTaskTest()
+{
+    AdapterPtr adapter = m_manager->adapters().first();
+    QSignalSpy nameSpy(adapter.data(), SIGNAL(nameChanged(QString)));
+    bool resumed = false;
+
+    {
+        Task<> task = setName(adapter, QStringLiteral("CancelledName"), &resumed);
+        QVERIFY(!task.isFinished());
+    }
+
+    // The call itself still finishes, but the destroyed coroutine is never resumed
+    QTRY_COMPARE(nameSpy.count(), 1);
+    QCOMPARE(adapter->name(), QStringLiteral("CancelledName"));
+    QTest::qWait(50);
+    QVERIFY(!resumed);
+}
+
+void CoroutinesTest::killJobTest()
+{
+    Manager *manager = new Manager();
+    InitManagerJob *job = manager->init();
+    InitManagerJob *result = job;
+    Task<> task = awaitJob(job, &result);
+
+    QVERIFY(job->isRunning());
+    job->kill();
+
+    // Killed job does not emit result, co_await returns nullptr when it is destroyed
+    QTRY_VERIFY(task.isFinished());
+    QVERIFY(!result);
+
+    delete manager;
+}
+
+void CoroutinesTest::emptyTaskTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    Task<int> task = connectProfile(device, unsupportedUuid);
+    Task<int> movedTask = std::move(task);
+
+    // Moved-from task is finished and has no value
+    QVERIFY(task.isFinished());
+    int result = -1;
+    Task<> awaiting = awaitTask(std::move(task), &result);
+    QVERIFY(awaiting.isFinished());
+    QCOMPARE(result, 0);
+
+    movedTask.cancel();
+    QVERIFY(movedTask.isFinished());
+}
+
+QTEST_MAIN(CoroutinesTest)
@@ -0,0 +1,208 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "devicesmodeltest.h"
+#include "autotests.h"
+#include "adapter.h"
+#include "device.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static void changeDeviceProperty(const DevicePtr &device, const QString &name, const QVariant &value)
+{
+    QVariantMap properties;
+    properties[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device->ubi()));
+    properties[QStringLiteral("Name")] = name;
+    properties[QStringLiteral("Value")] = value;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("change-device-property"), properties);
+}
+
+DevicesModelTest::DevicesModelTest()
+    : m_manager(nullptr)
+    , m_model(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void DevicesModelTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    // Create adapter
+    QDBusObjectPath adapter1path = QDBusObjectPath(QStringLiteral("/org/bluez/hci0"));
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(adapter1path);
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    // Create devices
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath("/org/bluez/hci0/dev_40_79_6A_0C_39_75"));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(adapter1path);
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    deviceProps[QStringLiteral("Alias")] = QStringLiteral("TestAlias");
+    deviceProps[QStringLiteral("Class")] = QVariant::fromValue(quint32(0x240404));
+    deviceProps[QStringLiteral("Appearance")] = QVariant::fromValue(quint16(0));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath("/org/bluez/hci0/dev_50_79_6A_0C_39_75"));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("50:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice2");
+    deviceProps[QStringLiteral("Alias")] = QStringLiteral("TestDevice2");
+    deviceProps[QStringLiteral("Class")] = QVariant::fromValue(quint32(0));
+    deviceProps[QStringLiteral("Appearance")] = QVariant::fromValue(quint16(0x03c1));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+
+    m_model = new DevicesModel(m_manager, this);
+
+    QCOMPARE(m_manager->devices().count(), 2);
+    QCOMPARE(m_model->rowCount(), 2);
+}
+
+void DevicesModelTest::cleanupTestCase()
+{
+    delete m_model;
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void DevicesModelTest::derivedPropertiesTest()
+{
+    DevicePtr device1 = m_manager->deviceForAddress(QStringLiteral("40:79:6A:0C:39:75"));
+    DevicePtr device2 = m_manager->deviceForAddress(QStringLiteral("50:79:6A:0C:39:75"));
+
+    QCOMPARE(device1->type(), Device::Headset);
+    QCOMPARE(device1->friendlyName(), QStringLiteral("TestAlias (TestDevice)"));
+    QCOMPARE(device2->type(), Device::Keyboard);
+    QCOMPARE(device2->friendlyName(), QStringLiteral("TestDevice2"));
+
+    for (int i = 0; i < m_model->rowCount(); ++i) {
+        const QModelIndex idx = m_model->index(i, 0);
+        DevicePtr device = m_model->device(idx);
+
+        QCOMPARE(idx.data(DevicesModel::TypeRole).toInt(), int(device->type()));
+        QCOMPARE(idx.data(DevicesModel::FriendlyNameRole).toString(), device->friendlyName());
+    }
+}
+
+void DevicesModelTest::appearanceTypeTest()
+{
+    // Type is derived from appearance when class is not set
+    DevicePtr device = m_manager->deviceForAddress(QStringLiteral("50:79:6A:0C:39:75"));
+
+    QSignalSpy typeSpy(device.data(), &Device::typeChanged);
+
+    changeDeviceProperty(device, QStringLiteral("Appearance"), QVariant::fromValue(quint16(0x03c2)));
+    QTRY_COMPARE(typeSpy.count(), 1);
+
+    QCOMPARE(typeSpy.at(0).at(0).value<Device::Type>(), Device::Mouse);
+    QCOMPARE(device->type(), Device::Mouse);
+}
+
+void DevicesModelTest::friendlyNameTest()
+{
+    DevicePtr device = m_manager->deviceForAddress(QStringLiteral("40:79:6A:0C:39:75"));
+
+    QSignalSpy friendlyNameSpy(device.data(), SIGNAL(friendlyNameChanged(QString)));
+
+    changeDeviceProperty(device, QStringLiteral("Alias"), QStringLiteral("TestDevice"));
+    QTRY_COMPARE(friendlyNameSpy.count(), 1);
+
+    QCOMPARE(friendlyNameSpy.at(0).at(0).toString(), QStringLiteral("TestDevice"));
+    QCOMPARE(device->friendlyName(), QStringLiteral("TestDevice"));
+}
+
+void DevicesModelTest::multiDataTest()
+{
+    QVector<int> roles;
+    roles << DevicesModel::UbiRole << DevicesModel::FriendlyNameRole << DevicesModel::TypeRole
+          << DevicesModel::AdapterNameRole << Qt::DisplayRole << Qt::DecorationRole;
+
+    for (int i = 0; i < m_model->rowCount(); ++i) {
+        const QModelIndex idx = m_model->index(i, 0);
+        const QVector<QVariant> values = m_model->multiData(idx, roles);
+
+        QCOMPARE(values.size(), roles.size());
+        for (int j = 0; j < roles.size(); ++j) {
+            QCOMPARE(values.at(j), idx.data(roles.at(j)));
+        }
+        QVERIFY(!values.last().isValid());
+
+        const QMap<int, QVariant> itemData = m_model->itemData(idx);
+        QCOMPARE(itemData.value(DevicesModel::AddressRole), idx.data(DevicesModel::AddressRole));
+        QCOMPARE(itemData.value(DevicesModel::AdapterAddressRole), idx.data(DevicesModel::AdapterAddressRole));
+    }
+
+    // Cached values are refreshed when device changes
+    DevicePtr device = m_model->device(m_model->index(0, 0));
+    QSignalSpy dataChangedSpy(m_model, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)));
+
+    changeDeviceProperty(device, QStringLiteral("Alias"), QStringLiteral("CachedAlias"));
+    QTRY_VERIFY(dataChangedSpy.count() >= 1);
+
+    QCOMPARE(m_model->index(0, 0).data(DevicesModel::NameRole).toString(), QStringLiteral("CachedAlias"));
+}
+
+void DevicesModelTest::benchmarkData()
+{
+    const QModelIndex idx = m_model->index(0, 0);
+
+    QBENCHMARK {
+        idx.data(DevicesModel::TypeRole);
+        idx.data(DevicesModel::FriendlyNameRole);
+        idx.data(DevicesModel::NameRole);
+    }
+}
+
+void DevicesModelTest::benchmarkMultiData()
+{
+    const QModelIndex idx = m_model->index(0, 0);
+
+    QVector<int> roles;
+    roles << DevicesModel::TypeRole << DevicesModel::FriendlyNameRole << DevicesModel::NameRole;
+
+    QBENCHMARK {
+        m_model->multiData(idx, roles);
+    }
+}
+
+QTEST_MAIN(DevicesModelTest)
@@ -0,0 +1,244 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "devicestreemodeltest.h"
+#include "autotests.h"
+#include "adapter.h"
+#include "device.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString adapter1path = QStringLiteral("/org/bluez/hci0");
+static const QString adapter2path = QStringLiteral("/org/bluez/hci1");
+
+static void createDevice(const QString &adapterPath, const QString &address)
+{
+    QString path = address;
+    path.replace(QLatin1Char(':'), QLatin1Char('_'));
+
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath + QStringLiteral("/dev_") + path));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    deviceProps[QStringLiteral("Address")] = address;
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+}
+
+DevicesTreeModelTest::DevicesTreeModelTest()
+    : m_manager(nullptr)
+    , m_model(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void DevicesTreeModelTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    // Create adapters
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapter1path));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    adapterProps[QStringLiteral("Powered")] = false;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapter2path));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("2E:3A:C3:BC:85:7C");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter2");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    // Create devices
+    createDevice(adapter1path, QStringLiteral("40:79:6A:0C:39:75"));
+    createDevice(adapter1path, QStringLiteral("40:79:6A:0C:39:76"));
+    createDevice(adapter2path, QStringLiteral("50:79:6A:0C:39:75"));
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+
+    m_model = new DevicesTreeModel(m_manager, this);
+
+    QCOMPARE(m_manager->adapters().count(), 2);
+    QCOMPARE(m_manager->devices().count(), 3);
+}
+
+void DevicesTreeModelTest::cleanupTestCase()
+{
+    delete m_model;
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void DevicesTreeModelTest::structureTest()
+{
+    QCOMPARE(m_model->rowCount(), 2);
+
+    int devicesCount = 0;
+
+    for (int i = 0; i < m_model->rowCount(); ++i) {
+        const QModelIndex adapterIdx = m_model->index(i, 0);
+        const AdapterPtr adapter = m_model->adapter(adapterIdx);
+
+        QVERIFY(adapter);
+        QVERIFY(!m_model->device(adapterIdx));
+        QVERIFY(!m_model->parent(adapterIdx).isValid());
+        QCOMPARE(m_model->adapterIndex(adapter), adapterIdx);
+        QCOMPARE(adapterIdx.data(DevicesTreeModel::IsAdapterRole).toBool(), true);
+        QCOMPARE(adapterIdx.data(DevicesModel::UbiRole).toString(), adapter->ubi());
+        QCOMPARE(adapterIdx.data(DevicesModel::AdapterPoweredRole).toBool(), adapter->isPowered());
+        QCOMPARE(m_model->rowCount(adapterIdx), adapter->devices().count());
+
+        for (int j = 0; j < m_model->rowCount(adapterIdx); ++j) {
+            const QModelIndex deviceIdx = m_model->index(j, 0, adapterIdx);
+            const DevicePtr device = m_model->device(deviceIdx);
+
+            QVERIFY(device);
+            QCOMPARE(device->adapter(), adapter);
+            QCOMPARE(m_model->adapter(deviceIdx), adapter);
+            QCOMPARE(m_model->parent(deviceIdx), adapterIdx);
+            QCOMPARE(m_model->rowCount(deviceIdx), 0);
+            QCOMPARE(deviceIdx.data(DevicesTreeModel::IsAdapterRole).toBool(), false);
+            QCOMPARE(deviceIdx.data(DevicesModel::UbiRole).toString(), device->ubi());
+            QCOMPARE(deviceIdx.data(DevicesModel::AddressRole).toString(), device->address());
+            devicesCount++;
+        }
+    }
+
+    QCOMPARE(devicesCount, 3);
+}
+
+void DevicesTreeModelTest::deviceAddedTest()
+{
+    AdapterPtr adapter = m_manager->adapterForUbi(adapter2path);
+    const QModelIndex adapterIdx = m_model->adapterIndex(adapter);
+
+    QSignalSpy insertedSpy(m_model, SIGNAL(rowsInserted(QModelIndex,int,int)));
+
+    createDevice(adapter2path, QStringLiteral("50:79:6A:0C:39:76"));
+    QTRY_COMPARE(insertedSpy.count(), 1);
+
+    QCOMPARE(insertedSpy.at(0).at(0).value<QModelIndex>(), adapterIdx);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(insertedSpy.at(0).at(2).toInt(), 1);
+    QCOMPARE(m_model->rowCount(adapterIdx), 2);
+    QCOMPARE(m_model->device(m_model->index(1, 0, adapterIdx))->address(), QStringLiteral("50:79:6A:0C:39:76"));
+}
+
+void DevicesTreeModelTest::deviceChangedTest()
+{
+    AdapterPtr adapter = m_manager->adapterForUbi(adapter1path);
+    DevicePtr device = adapter->devices().at(0);
+    const QModelIndex adapterIdx = m_model->adapterIndex(adapter);
+
+    QSignalSpy changedSpy(m_model, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)));
+
+    QVariantMap properties;
+    properties[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device->ubi()));
+    properties[QStringLiteral("Name")] = QStringLiteral("Alias");
+    properties[QStringLiteral("Value")] = QStringLiteral("TreeAlias");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("change-device-property"), properties);
+
+    QTRY_VERIFY(changedSpy.count() >= 1);
+
+    Q_FOREACH (const QList<QVariant> &args, changedSpy) {
+        const QModelIndex idx = args.at(0).value<QModelIndex>();
+        QCOMPARE(idx.parent(), adapterIdx);
+        QCOMPARE(m_model->device(idx), device);
+    }
+    QCOMPARE(m_model->index(0, 0, adapterIdx).data(DevicesModel::NameRole).toString(), QStringLiteral("TreeAlias"));
+}
+
+void DevicesTreeModelTest::adapterChangedTest()
+{
+    AdapterPtr adapter = m_manager->adapterForUbi(adapter1path);
+    const QModelIndex adapterIdx = m_model->adapterIndex(adapter);
+
+    QSignalSpy changedSpy(m_model, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)));
+
+    QVariantMap properties;
+    properties[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapter1path));
+    properties[QStringLiteral("Name")] = QStringLiteral("Powered");
+    properties[QStringLiteral("Value")] = true;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("change-adapter-property"), properties);
+
+    QTRY_VERIFY(changedSpy.count() >= 1);
+
+    // Only adapter row is updated, not its devices
+    Q_FOREACH (const QList<QVariant> &args, changedSpy) {
+        QCOMPARE(args.at(0).value<QModelIndex>(), adapterIdx);
+        QCOMPARE(args.at(1).value<QModelIndex>(), adapterIdx);
+    }
+    QCOMPARE(adapterIdx.data(DevicesModel::AdapterPoweredRole).toBool(), true);
+}
+
+void DevicesTreeModelTest::deviceRemovedTest()
+{
+    AdapterPtr adapter = m_manager->adapterForUbi(adapter1path);
+    DevicePtr device = adapter->devices().at(0);
+    const QModelIndex adapterIdx = m_model->adapterIndex(adapter);
+
+    QSignalSpy removedSpy(m_model, SIGNAL(rowsRemoved(QModelIndex,int,int)));
+
+    QVariantMap properties;
+    properties[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device->ubi()));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("remove-device"), properties);
+
+    QTRY_COMPARE(removedSpy.count(), 1);
+
+    QCOMPARE(removedSpy.at(0).at(0).value<QModelIndex>(), adapterIdx);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 0);
+    QCOMPARE(m_model->rowCount(adapterIdx), 1);
+}
+
+void DevicesTreeModelTest::adapterRemovedTest()
+{
+    QSignalSpy removedSpy(m_model, SIGNAL(rowsRemoved(QModelIndex,int,int)));
+
+    QVariantMap properties;
+    properties[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapter1path));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("remove-adapter"), properties);
+
+    // One device row and then the adapter row
+    QTRY_COMPARE(removedSpy.count(), 2);
+
+    QVERIFY(removedSpy.at(0).at(0).value<QModelIndex>().isValid());
+    QVERIFY(!removedSpy.at(1).at(0).value<QModelIndex>().isValid());
+    QCOMPARE(m_model->rowCount(), 1);
+    QCOMPARE(m_model->adapter(m_model->index(0, 0))->ubi(), adapter2path);
+}
+
+QTEST_MAIN(DevicesTreeModelTest)
@@ -22,6 +22,7 @@
 #include "autotests.h"
 #include "pendingcall.h"
 #include "initmanagerjob.h"
+#include "batchjob.h"
 
 #include <QtTest/QTest>
 #include <QtTest/QSignalSpy>
@@ -33,6 +34,8 @@ extern void bluezqt_initFakeBluezTestRun();
 
 using namespace BluezQt;
 
+static const QString noReplyUuid = QStringLiteral("0000FFFF-0000-1000-8000-00805F9B34FB");
+
 DeviceTest::DeviceTest()
     : m_manager(nullptr)
 {
@@ -234,6 +237,110 @@ void DeviceTest::setBlockedTest()
     }
 }
 
+void DeviceTest::setTrustedBatchTest()
+{
+    QList<DevicePtr> devices;
+    Q_FOREACH (const DeviceUnit &unit, m_units) {
+        devices.append(unit.device);
+    }
+
+    BatchJob *job = m_manager->setTrusted(devices, true);
+    QSignalSpy progressSpy(job, SIGNAL(progress(BatchJob*,int,int)));
+    QSignalSpy resultSpy(job, SIGNAL(result(BatchJob*)));
+    int error = -1;
+    connect(job, &BatchJob::result, this, [&error](BatchJob *finishedJob) {
+        error = finishedJob->error();
+    });
+
+    job->setWindow(1);
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(progressSpy.count(), devices.count());
+    QCOMPARE(error, int(BatchJob::NoError));
+
+    Q_FOREACH (const DeviceUnit &unit, m_units) {
+        QTRY_VERIFY(unit.device->isTrusted());
+        QCOMPARE(unit.dbusDevice->trusted(), true);
+    }
+}
+
+void DeviceTest::callTimeoutTest()
+{
+    DevicePtr device = m_units.first().device;
+
+    // Timeout of the call
+    PendingCall *call = device->connectProfile(noReplyUuid);
+    QSignalSpy callSpy(call, SIGNAL(finished(PendingCall*)));
+    int error = PendingCall::NoError;
+    connect(call, &PendingCall::finished, this, [&error](PendingCall *finishedCall) {
+        error = finishedCall->error();
+    });
+
+    call->setTimeout(100);
+    QCOMPARE(call->timeout(), 100);
+    QTRY_COMPARE(callSpy.count(), 1);
+    QCOMPARE(error, int(PendingCall::TimedOut));
+
+    // D-Bus timeout of the device
+    QCOMPARE(device->callTimeout(), -1);
+    device->setCallTimeout(100);
+    QCOMPARE(device->callTimeout(), 100);
+
+    call = device->connectProfile(noReplyUuid);
+    QSignalSpy callSpy2(call, SIGNAL(finished(PendingCall*)));
+    error = PendingCall::NoError;
+    connect(call, &PendingCall::finished, this, [&error](PendingCall *finishedCall) {
+        error = finishedCall->error();
+    });
+
+    QTRY_COMPARE(callSpy2.count(), 1);
+    QCOMPARE(error, int(PendingCall::TimedOut));
+
+    device->setCallTimeout(-1);
+}
+
+void DeviceTest::callCancelTest()
+{
+    DevicePtr device = m_units.first().device;
+
+    PendingCall *call = device->connectProfile(noReplyUuid);
+    QSignalSpy callSpy(call, SIGNAL(finished(PendingCall*)));
+    QSignalSpy destroyedSpy(call, SIGNAL(destroyed(QObject*)));
+
+    call->setTimeout(50);
+    call->cancel();
+    QVERIFY(call->isFinished());
+
+    // Canceled call is deleted without emitting finished, not even on timeout
+    QTRY_COMPARE(destroyedSpy.count(), 1);
+    QTest::qWait(100);
+    QCOMPARE(callSpy.count(), 0);
+}
+
+void DeviceTest::callScopeTest()
+{
+    DevicePtr device = m_units.first().device;
+    QObject *scope = new QObject();
+
+    PendingCall *call1 = device->connectProfile(noReplyUuid);
+    PendingCall *call2 = device->connectProfile(noReplyUuid);
+    call1->setScope(scope);
+    call2->setScope(scope);
+
+    QSignalSpy callSpy1(call1, SIGNAL(finished(PendingCall*)));
+    QSignalSpy callSpy2(call2, SIGNAL(finished(PendingCall*)));
+    QSignalSpy destroyedSpy1(call1, SIGNAL(destroyed(QObject*)));
+    QSignalSpy destroyedSpy2(call2, SIGNAL(destroyed(QObject*)));
+
+    delete scope;
+
+    QTRY_COMPARE(destroyedSpy1.count(), 1);
+    QTRY_COMPARE(destroyedSpy2.count(), 1);
+    QCOMPARE(callSpy1.count(), 0);
+    QCOMPARE(callSpy2.count(), 0);
+}
+
 void DeviceTest::deviceRemovedTest()
 {
     Q_FOREACH (const DeviceUnit &unit, m_units) {
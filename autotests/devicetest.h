@@ -46,6 +46,10 @@ private Q_SLOTS:
     void setAliasTest();
     void setTrustedTest();
     void setBlockedTest();
+    void setTrustedBatchTest();
+    void callTimeoutTest();
+    void callCancelTest();
+    void callScopeTest();
 
     void deviceRemovedTest();
 
@@ -0,0 +1,280 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "discoveryschedulertest.h"
+#include "autotests.h"
+#include "adapter.h"
+#include "device.h"
+#include "adapterselector.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+DiscoverySchedulerTest::DiscoverySchedulerTest()
+    : m_manager(nullptr)
+    , m_scheduler(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void DiscoverySchedulerTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    adapterProps[QStringLiteral("Powered")] = true;
+    adapterProps[QStringLiteral("StopDiscoveryDelay")] = 50;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci1")));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("2E:3A:C3:BC:85:7C");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter2");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+
+    m_adapter1 = m_manager->adapterForUbi(QStringLiteral("/org/bluez/hci0"));
+    m_adapter2 = m_manager->adapterForUbi(QStringLiteral("/org/bluez/hci1"));
+    QVERIFY(m_adapter1);
+    QVERIFY(m_adapter2);
+}
+
+void DiscoverySchedulerTest::cleanupTestCase()
+{
+    m_adapter1.clear();
+    m_adapter2.clear();
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void DiscoverySchedulerTest::init()
+{
+    m_scheduler = new DiscoveryScheduler();
+    m_scheduler->setInterval(200);
+    m_scheduler->addAdapter(m_adapter1, 0.25);
+    m_scheduler->addAdapter(m_adapter2, 0.25);
+}
+
+void DiscoverySchedulerTest::cleanup()
+{
+    delete m_scheduler;
+    m_scheduler = nullptr;
+
+    QTRY_VERIFY(!m_adapter1->isDiscovering());
+    QTRY_VERIFY(!m_adapter2->isDiscovering());
+}
+
+void DiscoverySchedulerTest::rotationTest()
+{
+    QCOMPARE(m_scheduler->adapters().count(), 2);
+    QCOMPARE(m_scheduler->dutyCycle(m_adapter1), 0.25);
+
+    QSignalSpy startedSpy(m_scheduler, SIGNAL(windowStarted(AdapterPtr)));
+    QSignalSpy finishedSpy(m_scheduler, SIGNAL(windowFinished(AdapterPtr)));
+
+    m_scheduler->start();
+    QVERIFY(m_scheduler->isRunning());
+    QCOMPARE(m_scheduler->currentAdapter(), m_adapter1);
+
+    QTRY_COMPARE(startedSpy.count(), 3);
+    QCOMPARE(startedSpy.at(0).at(0).value<AdapterPtr>(), m_adapter1);
+    QCOMPARE(startedSpy.at(1).at(0).value<AdapterPtr>(), m_adapter2);
+    QCOMPARE(startedSpy.at(2).at(0).value<AdapterPtr>(), m_adapter1);
+    QCOMPARE(finishedSpy.count(), 2);
+
+    m_scheduler->stop();
+    QVERIFY(!m_scheduler->isRunning());
+    QVERIFY(!m_scheduler->currentAdapter());
+    QCOMPARE(finishedSpy.count(), 3);
+}
+
+void DiscoverySchedulerTest::exclusiveTest()
+{
+    bool overlap = false;
+    auto check = [this, &overlap]() {
+        if (m_adapter1->isDiscovering() && m_adapter2->isDiscovering()) {
+            overlap = true;
+        }
+    };
+    connect(m_adapter1.data(), &Adapter::discoveringChanged, this, check);
+    connect(m_adapter2.data(), &Adapter::discoveringChanged, this, check);
+
+    QSignalSpy startedSpy(m_scheduler, SIGNAL(windowStarted(AdapterPtr)));
+    m_scheduler->start();
+
+    QTRY_COMPARE(startedSpy.count(), 5);
+    QVERIFY(!overlap);
+
+    m_scheduler->stop();
+    m_adapter1->disconnect(this);
+    m_adapter2->disconnect(this);
+}
+
+void DiscoverySchedulerTest::restartTest()
+{
+    bool overlap = false;
+    auto check = [this, &overlap]() {
+        if (m_adapter1->isDiscovering() && m_adapter2->isDiscovering()) {
+            overlap = true;
+        }
+    };
+    connect(m_adapter1.data(), &Adapter::discoveringChanged, this, check);
+    connect(m_adapter2.data(), &Adapter::discoveringChanged, this, check);
+
+    QSignalSpy startedSpy(m_scheduler, SIGNAL(windowStarted(AdapterPtr)));
+    m_scheduler->setInterval(1000);
+    m_scheduler->start();
+    QTRY_VERIFY(m_adapter1->isDiscovering());
+
+    // Restarted scheduler waits for the stop of the previous window
+    m_scheduler->stop();
+    m_scheduler->start();
+    QCOMPARE(startedSpy.count(), 1);
+    QVERIFY(!m_scheduler->currentAdapter());
+
+    QTRY_COMPARE(startedSpy.count(), 4);
+    QVERIFY(!overlap);
+
+    m_scheduler->stop();
+    m_adapter1->disconnect(this);
+    m_adapter2->disconnect(this);
+}
+
+void DiscoverySchedulerTest::statisticsTest()
+{
+    m_scheduler->setDutyCycle(m_adapter1, 1.0);
+    m_scheduler->setDutyCycle(m_adapter2, 0);
+    m_scheduler->setInterval(1000);
+    m_scheduler->start();
+
+    QTRY_VERIFY(m_adapter1->isDiscovering());
+
+    QVariantMap devicesProps;
+    devicesProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(m_adapter1->ubi()));
+    devicesProps[QStringLiteral("Count")] = 10;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-devices"), devicesProps);
+
+    QTRY_COMPARE(m_scheduler->devicesFound(m_adapter1), 10);
+    QVERIFY(m_scheduler->scanTime(m_adapter1) > 0);
+    QVERIFY(m_scheduler->devicesPerSecond(m_adapter1) > 0);
+    QCOMPARE(m_scheduler->devicesFound(m_adapter2), 0);
+    QCOMPARE(m_scheduler->scanTime(m_adapter2), qint64(0));
+
+    m_scheduler->resetStatistics();
+    QCOMPARE(m_scheduler->devicesFound(m_adapter1), 0);
+
+    m_scheduler->stop();
+}
+
+void DiscoverySchedulerTest::removeAdapterTest()
+{
+    QSignalSpy startedSpy(m_scheduler, SIGNAL(windowStarted(AdapterPtr)));
+
+    m_scheduler->start();
+    QCOMPARE(m_scheduler->currentAdapter(), m_adapter1);
+
+    // Next adapter starts once the removed adapter stopped discovering
+    m_scheduler->removeAdapter(m_adapter1);
+    QCOMPARE(m_scheduler->adapters().count(), 1);
+    QVERIFY(!m_scheduler->currentAdapter());
+
+    QTRY_COMPARE(startedSpy.count(), 2);
+    QCOMPARE(m_scheduler->currentAdapter(), m_adapter2);
+    QVERIFY(!m_adapter1->isDiscovering());
+
+    m_scheduler->stop();
+}
+
+void DiscoverySchedulerTest::invalidFilterTest()
+{
+    QVariantMap filter;
+    filter[QStringLiteral("Transport")] = QStringLiteral("invalid");
+    m_scheduler->setFilter(m_adapter1, filter);
+    m_scheduler->setInterval(10000);
+
+    QSignalSpy startedSpy(m_scheduler, SIGNAL(windowStarted(AdapterPtr)));
+    QSignalSpy finishedSpy(m_scheduler, SIGNAL(windowFinished(AdapterPtr)));
+    m_scheduler->start();
+
+    // Window with rejected filter is skipped without waiting for its duration
+    QTRY_COMPARE_WITH_TIMEOUT(startedSpy.count(), 2, 1000);
+    QCOMPARE(finishedSpy.at(0).at(0).value<AdapterPtr>(), m_adapter1);
+    QCOMPARE(startedSpy.at(1).at(0).value<AdapterPtr>(), m_adapter2);
+    QCOMPARE(m_scheduler->scanTime(m_adapter1), qint64(0));
+
+    m_scheduler->stop();
+}
+
+void DiscoverySchedulerTest::adapterSelectorTest()
+{
+    const QString address = QStringLiteral("40:79:6A:0C:39:75");
+
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0/dev_40_79_6A_0C_39_75")));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(m_adapter1->ubi()));
+    deviceProps[QStringLiteral("Address")] = address;
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+    QTRY_VERIFY(m_adapter1->deviceForAddress(address));
+
+    AdapterSelector selector(m_manager);
+    m_scheduler->setAdapterSelector(&selector);
+    QCOMPARE(m_scheduler->adapterSelector(), &selector);
+
+    // Adapter with a device pending connection does not scan
+    DevicePtr device = selector.selectDevice(address);
+    QCOMPARE(selector.pendingCount(m_adapter1), 1);
+
+    QSignalSpy startedSpy(m_scheduler, SIGNAL(windowStarted(AdapterPtr)));
+    m_scheduler->start();
+    QCOMPARE(m_scheduler->currentAdapter(), m_adapter2);
+
+    QTRY_COMPARE(startedSpy.count(), 2);
+    QCOMPARE(startedSpy.at(1).at(0).value<AdapterPtr>(), m_adapter2);
+
+    selector.release(device);
+    QTRY_COMPARE(startedSpy.count(), 4);
+    QVERIFY(startedSpy.at(2).at(0).value<AdapterPtr>() == m_adapter1
+            || startedSpy.at(3).at(0).value<AdapterPtr>() == m_adapter1);
+
+    m_scheduler->stop();
+}
+
+QTEST_MAIN(DiscoverySchedulerTest)
@@ -0,0 +1,59 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DISCOVERYSCHEDULERTEST_H
+#define DISCOVERYSCHEDULERTEST_H
+
+#include <QObject>
+
+#include "manager.h"
+#include "discoveryscheduler.h"
+
+class DiscoverySchedulerTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DiscoverySchedulerTest();
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+    void rotationTest();
+    void exclusiveTest();
+    void restartTest();
+    void statisticsTest();
+    void removeAdapterTest();
+    void invalidFilterTest();
+    void adapterSelectorTest();
+
+private:
+    BluezQt::Manager *m_manager;
+    BluezQt::DiscoveryScheduler *m_scheduler;
+    BluezQt::AdapterPtr m_adapter1;
+    BluezQt::AdapterPtr m_adapter2;
+};
+
+#endif // DISCOVERYSCHEDULERTEST_H
@@ -23,6 +23,7 @@
 
 #include <QTimer>
 #include <QDBusConnection>
+#include <QDBusMessage>
 
 // AdapterObject
 AdapterObject::AdapterObject(const QDBusObjectPath &path, QObject *parent)
@@ -34,10 +35,15 @@ AdapterObject::AdapterObject(const QDBusObjectPath &path, QObject *parent)
 // AdapterInterface
 AdapterInterface::AdapterInterface(const QDBusObjectPath &path, const QVariantMap &properties, QObject *parent)
     : QDBusAbstractAdaptor(parent)
+    , m_stopDiscoveryDelay(properties.value(QStringLiteral("StopDiscoveryDelay")).toInt())
 {
+    // StopDiscoveryDelay delays the reply of StopDiscovery()
+    QVariantMap adapterProps = properties;
+    adapterProps.remove(QStringLiteral("StopDiscoveryDelay"));
+
     setPath(path);
     setObjectParent(parent);
-    setProperties(properties);
+    setProperties(adapterProps);
     setName(QStringLiteral("org.bluez.Adapter1"));
 
     // Alias needs special handling
@@ -147,9 +153,29 @@ void AdapterInterface::StartDiscovery()
     Object::changeProperty(QStringLiteral("Discovering"), true);
 }
 
-void AdapterInterface::StopDiscovery()
+void AdapterInterface::StopDiscovery(const QDBusMessage &msg)
 {
-    Object::changeProperty(QStringLiteral("Discovering"), false);
+    if (m_stopDiscoveryDelay <= 0) {
+        Object::changeProperty(QStringLiteral("Discovering"), false);
+        return;
+    }
+
+    msg.setDelayedReply(true);
+
+    QTimer::singleShot(m_stopDiscoveryDelay, this, [this, msg]() {
+        Object::changeProperty(QStringLiteral("Discovering"), false);
+        QDBusConnection::sessionBus().send(msg.createReply());
+    });
+}
+
+void AdapterInterface::SetDiscoveryFilter(const QVariantMap &filter, const QDBusMessage &msg)
+{
+    const QString &transport = filter.value(QStringLiteral("Transport"), QStringLiteral("auto")).toString();
+
+    if (transport != QLatin1String("auto") && transport != QLatin1String("bredr") && transport != QLatin1String("le")) {
+        QDBusMessage error = msg.createErrorReply(QStringLiteral("org.bluez.Error.InvalidArguments"), QStringLiteral("Invalid arguments in method call"));
+        QDBusConnection::sessionBus().send(error);
+    }
 }
 
 void AdapterInterface::RemoveDevice(const QDBusObjectPath &device)
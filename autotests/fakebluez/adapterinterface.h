@@ -26,6 +26,7 @@
 #include <QDBusAbstractAdaptor>
 
 class QDBusObjectPath;
+class QDBusMessage;
 
 class AdapterObject : public QObject
 {
@@ -85,12 +86,16 @@ public:
 
 public Q_SLOTS:
     void StartDiscovery();
-    void StopDiscovery();
+    void StopDiscovery(const QDBusMessage &msg);
+    void SetDiscoveryFilter(const QVariantMap &filter, const QDBusMessage &msg);
     void RemoveDevice(const QDBusObjectPath &device);
 
 private Q_SLOTS:
     void resetPairable();
     void resetDiscoverable();
+
+private:
+    int m_stopDiscoveryDelay;
 };
 
 #endif // ADAPTERINTERFACE_H
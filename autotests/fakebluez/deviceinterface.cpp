@@ -26,8 +26,17 @@
 #include <QDBusMessage>
 #include <QDBusArgument>
 #include <QDBusConnection>
+#include <QTimer>
 
 static const QLatin1String MediaPlayerUuid ("0000110E-0000-1000-8000-00805F9B34FB");
+// ConnectProfile() with this UUID never replies
+static const QLatin1String NoReplyUuid ("0000FFFF-0000-1000-8000-00805F9B34FB");
+
+// ConnectProfile() with this UUID always fails with NotReady error
+static const QLatin1String NotReadyUuid ("0000FFFE-0000-1000-8000-00805F9B34FB");
+
+// ConnectProfile() with this UUID fails with InProgress error every other call
+static const QLatin1String InProgressUuid ("0000FFFD-0000-1000-8000-00805F9B34FB");
 
 // DeviceObject
 DeviceObject::DeviceObject(const QDBusObjectPath &path, QObject *parent)
@@ -40,10 +49,24 @@ DeviceObject::DeviceObject(const QDBusObjectPath &path, QObject *parent)
 DeviceInterface::DeviceInterface(const QDBusObjectPath &path, const QVariantMap &properties, QObject *parent)
     : QDBusAbstractAdaptor(parent)
     , m_mediaPlayer(nullptr)
+    , m_inProgressCalls(0)
+    , m_pairFailures(properties.value(QStringLiteral("PairFailures")).toInt())
+    , m_pairDelay(properties.value(QStringLiteral("PairDelay")).toInt())
+    , m_pairError(properties.value(QStringLiteral("PairError"), QStringLiteral("org.bluez.Error.AuthenticationTimeout")).toString())
+    , m_connectNoReply(properties.value(QStringLiteral("ConnectNoReply")).toBool())
 {
+    // PairFailures, PairError and PairDelay control the behaviour of Pair()
+    QVariantMap deviceProps = properties;
+    deviceProps.remove(QStringLiteral("PairFailures"));
+    deviceProps.remove(QStringLiteral("PairError"));
+    deviceProps.remove(QStringLiteral("PairDelay"));
+
+    // Connect() of device with ConnectNoReply never replies
+    deviceProps.remove(QStringLiteral("ConnectNoReply"));
+
     setPath(path);
     setObjectParent(parent);
-    setProperties(properties);
+    setProperties(deviceProps);
     setName(QStringLiteral("org.bluez.Device1"));
 
     // Alias needs special handling
@@ -57,7 +80,7 @@ DeviceInterface::DeviceInterface(const QDBusObjectPath &path, const QVariantMap
         ObjectManager *manager = ObjectManager::self();
         manager->addObject(input);
 
-        QVariantMap props = properties;
+        QVariantMap props = deviceProps;
         props.remove(QStringLiteral("Input"));
         setProperties(props);
     }
@@ -153,8 +176,13 @@ QString DeviceInterface::modalias() const
     return Object::property(QStringLiteral("Modalias")).toString();
 }
 
-void DeviceInterface::Connect()
+void DeviceInterface::Connect(const QDBusMessage &msg)
 {
+    if (m_connectNoReply) {
+        msg.setDelayedReply(true);
+        return;
+    }
+
     if (uuids().contains(MediaPlayerUuid)) {
         connectMediaPlayer();
     }
@@ -173,6 +201,27 @@ void DeviceInterface::Disconnect()
 
 void DeviceInterface::ConnectProfile(const QString &uuid, const QDBusMessage &msg)
 {
+    if (uuid == NoReplyUuid) {
+        msg.setDelayedReply(true);
+        return;
+    }
+
+    if (uuid == NotReadyUuid) {
+        QDBusMessage error = msg.createErrorReply(QStringLiteral("org.bluez.Error.NotReady"), QStringLiteral("Resource Not Ready"));
+        QDBusConnection::sessionBus().send(error);
+        return;
+    }
+
+    if (uuid == InProgressUuid) {
+        if (m_inProgressCalls++ % 2 == 0) {
+            QDBusMessage error = msg.createErrorReply(QStringLiteral("org.bluez.Error.InProgress"), QStringLiteral("In Progress"));
+            QDBusConnection::sessionBus().send(error);
+            return;
+        }
+        Object::changeProperty(QStringLiteral("Connected"), true);
+        return;
+    }
+
     if (!uuids().contains(uuid)) {
         QDBusMessage error = msg.createErrorReply(QStringLiteral("org.bluez.Error.DoesNotExist"), QStringLiteral("Profile UUID not supported"));
         QDBusConnection::sessionBus().send(error);
@@ -217,9 +266,28 @@ void DeviceInterface::DisconnectProfile(const QString &uuid, const QDBusMessage
     Object::changeProperty(QStringLiteral("Connected"), false);
 }
 
-void DeviceInterface::Pair()
+void DeviceInterface::Pair(const QDBusMessage &msg)
 {
-    Q_UNIMPLEMENTED();
+    if (paired()) {
+        QDBusMessage error = msg.createErrorReply(QStringLiteral("org.bluez.Error.AlreadyExists"), QStringLiteral("Already Paired"));
+        QDBusConnection::sessionBus().send(error);
+        return;
+    }
+
+    msg.setDelayedReply(true);
+
+    QTimer::singleShot(m_pairDelay, this, [this, msg]() {
+        // Fails with PairError the first PairFailures times
+        if (m_pairFailures > 0) {
+            m_pairFailures--;
+            QDBusMessage error = msg.createErrorReply(m_pairError, QStringLiteral("Pairing failed"));
+            QDBusConnection::sessionBus().send(error);
+            return;
+        }
+
+        Object::changeProperty(QStringLiteral("Paired"), true);
+        QDBusConnection::sessionBus().send(msg.createReply());
+    });
 }
 
 void DeviceInterface::CancelPairing()
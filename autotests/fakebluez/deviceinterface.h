@@ -92,11 +92,11 @@ public:
     QString modalias() const;
 
 public Q_SLOTS:
-    void Connect();
+    void Connect(const QDBusMessage &msg);
     void Disconnect();
     void ConnectProfile(const QString &uuid, const QDBusMessage &msg);
     void DisconnectProfile(const QString &uuid, const QDBusMessage &msg);
-    void Pair();
+    void Pair(const QDBusMessage &msg);
     void CancelPairing();
 
 private:
@@ -105,6 +105,11 @@ private:
 
     QStringList m_connectedUuids;
     Object *m_mediaPlayer;
+    int m_inProgressCalls;
+    int m_pairFailures;
+    int m_pairDelay;
+    QString m_pairError;
+    bool m_connectNoReply;
 };
 
 #endif // DEVICEINTERFACE_H
@@ -22,6 +22,8 @@
 #include "objectmanager.h"
 #include "adapterinterface.h"
 #include "deviceinterface.h"
+#include "gattinterface.h"
+#include "gattmanager.h"
 
 DeviceManager::DeviceManager(ObjectManager *parent)
     : QObject(parent)
@@ -35,6 +37,8 @@ void DeviceManager::runAction(const QString &actionName, const QVariantMap &prop
         runCreateAdapterAction(properties);
     } else if (actionName == QLatin1String("create-device")) {
         runCreateDeviceAction(properties);
+    } else if (actionName == QLatin1String("create-devices")) {
+        runCreateDevicesAction(properties);
     } else if (actionName == QLatin1String("remove-adapter")) {
         runRemoveAdapterAction(properties);
     } else if (actionName == QLatin1String("remove-device")) {
@@ -43,6 +47,16 @@ void DeviceManager::runAction(const QString &actionName, const QVariantMap &prop
         runChangeAdapterProperty(properties);
     } else if (actionName == QLatin1String("change-device-property")) {
         runChangeDeviceProperty(properties);
+    } else if (actionName == QLatin1String("create-gatt-service")) {
+        runCreateGattServiceAction(properties);
+    } else if (actionName == QLatin1String("create-gatt-characteristic")) {
+        runCreateGattCharacteristicAction(properties);
+    } else if (actionName == QLatin1String("create-gatt-descriptor")) {
+        runCreateGattDescriptorAction(properties);
+    } else if (actionName == QLatin1String("remove-gatt-object")) {
+        runRemoveGattObjectAction(properties);
+    } else if (actionName == QLatin1String("notify-gatt-characteristic")) {
+        runNotifyGattCharacteristic(properties);
     } else if (actionName == QLatin1String("bug377405")) {
         runBug377405();
     }
@@ -56,6 +70,7 @@ void DeviceManager::runCreateAdapterAction(const QVariantMap &properties)
 
     AdapterObject *adapterObj = new AdapterObject(path);
     AdapterInterface *adapter = new AdapterInterface(path, props, adapterObj);
+    new GattManager(adapterObj);
     m_objectManager->addObject(adapter);
     m_objectManager->addAutoDeleteObject(adapterObj);
 }
@@ -72,6 +87,33 @@ void DeviceManager::runCreateDeviceAction(const QVariantMap &properties)
     m_objectManager->addAutoDeleteObject(deviceObj);
 }
 
+void DeviceManager::runCreateDevicesAction(const QVariantMap &properties)
+{
+    // Creates Count devices on Adapter with generated addresses, used by benchmarks
+    const QDBusObjectPath &adapterPath = properties.value(QStringLiteral("Adapter")).value<QDBusObjectPath>();
+    const int count = properties.value(QStringLiteral("Count")).toInt();
+
+    for (int i = 0; i < count; ++i) {
+        const QString address = QStringLiteral("10:00:00:%1:%2:%3")
+                .arg((i >> 16) & 0xff, 2, 16, QLatin1Char('0'))
+                .arg((i >> 8) & 0xff, 2, 16, QLatin1Char('0'))
+                .arg(i & 0xff, 2, 16, QLatin1Char('0'))
+                .toUpper();
+
+        QString pathSuffix = address;
+        pathSuffix.replace(QLatin1Char(':'), QLatin1Char('_'));
+
+        QVariantMap props;
+        props[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath.path() + QStringLiteral("/dev_") + pathSuffix));
+        props[QStringLiteral("Adapter")] = QVariant::fromValue(adapterPath);
+        props[QStringLiteral("Address")] = address;
+        props[QStringLiteral("Name")] = QStringLiteral("TestDevice%1").arg(i);
+        props[QStringLiteral("Alias")] = QStringLiteral("TestDevice%1").arg(i);
+
+        runCreateDeviceAction(props);
+    }
+}
+
 void DeviceManager::runRemoveAdapterAction(const QVariantMap &properties)
 {
     const QDBusObjectPath &path = properties.value(QStringLiteral("Path")).value<QDBusObjectPath>();
@@ -106,6 +148,65 @@ void DeviceManager::runChangeDeviceProperty(const QVariantMap &properties)
     device->changeProperty(properties.value(QStringLiteral("Name")).toString(), properties.value(QStringLiteral("Value")));
 }
 
+void DeviceManager::runCreateGattServiceAction(const QVariantMap &properties)
+{
+    const QDBusObjectPath &path = properties.value(QStringLiteral("Path")).value<QDBusObjectPath>();
+    QVariantMap props = properties;
+    props.remove(QStringLiteral("Path"));
+
+    GattObject *serviceObj = new GattObject(path);
+    GattServiceInterface *service = new GattServiceInterface(path, props, serviceObj);
+    m_objectManager->addObject(service);
+    m_objectManager->addAutoDeleteObject(serviceObj);
+}
+
+void DeviceManager::runCreateGattCharacteristicAction(const QVariantMap &properties)
+{
+    const QDBusObjectPath &path = properties.value(QStringLiteral("Path")).value<QDBusObjectPath>();
+    QVariantMap props = properties;
+    props.remove(QStringLiteral("Path"));
+
+    GattObject *characteristicObj = new GattObject(path);
+    GattCharacteristicInterface *characteristic = new GattCharacteristicInterface(path, props, characteristicObj);
+    m_objectManager->addObject(characteristic);
+    m_objectManager->addAutoDeleteObject(characteristicObj);
+}
+
+void DeviceManager::runCreateGattDescriptorAction(const QVariantMap &properties)
+{
+    const QDBusObjectPath &path = properties.value(QStringLiteral("Path")).value<QDBusObjectPath>();
+    QVariantMap props = properties;
+    props.remove(QStringLiteral("Path"));
+
+    GattObject *descriptorObj = new GattObject(path);
+    GattDescriptorInterface *descriptor = new GattDescriptorInterface(path, props, descriptorObj);
+    m_objectManager->addObject(descriptor);
+    m_objectManager->addAutoDeleteObject(descriptorObj);
+}
+
+void DeviceManager::runRemoveGattObjectAction(const QVariantMap &properties)
+{
+    const QDBusObjectPath &path = properties.value(QStringLiteral("Path")).value<QDBusObjectPath>();
+    Object *object = m_objectManager->objectByPath(path);
+    if (!object) {
+        return;
+    }
+
+    m_objectManager->removeObject(object);
+}
+
+void DeviceManager::runNotifyGattCharacteristic(const QVariantMap &properties)
+{
+    const QDBusObjectPath &path = properties.value(QStringLiteral("Path")).value<QDBusObjectPath>();
+    Object *object = m_objectManager->objectByPath(path);
+    if (!object || object->name() != QLatin1String("org.bluez.GattCharacteristic1")) {
+        return;
+    }
+
+    GattCharacteristicInterface *characteristic = static_cast<GattCharacteristicInterface*>(object);
+    characteristic->notify(properties.value(QStringLiteral("Value")).toByteArray(), properties.value(QStringLiteral("Count"), 1).toInt());
+}
+
 void DeviceManager::runBug377405()
 {
     QDBusObjectPath adapter1path = QDBusObjectPath(QStringLiteral("/org/bluez/hci0"));
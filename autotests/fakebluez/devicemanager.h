@@ -37,10 +37,16 @@ public:
 private:
     void runCreateAdapterAction(const QVariantMap &properties);
     void runCreateDeviceAction(const QVariantMap &properties);
+    void runCreateDevicesAction(const QVariantMap &properties);
     void runRemoveAdapterAction(const QVariantMap &properties);
     void runRemoveDeviceAction(const QVariantMap &properties);
     void runChangeAdapterProperty(const QVariantMap &properties);
     void runChangeDeviceProperty(const QVariantMap &properties);
+    void runCreateGattServiceAction(const QVariantMap &properties);
+    void runCreateGattCharacteristicAction(const QVariantMap &properties);
+    void runCreateGattDescriptorAction(const QVariantMap &properties);
+    void runRemoveGattObjectAction(const QVariantMap &properties);
+    void runNotifyGattCharacteristic(const QVariantMap &properties);
     void runBug377405();
 
     ObjectManager *m_objectManager;
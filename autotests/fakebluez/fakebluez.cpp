@@ -99,6 +99,8 @@ void FakeBluez::doRunAction()
 {
     if (m_actionObject == QLatin1String("agentmanager")) {
         m_agentManager->runAction(m_actionName, m_actionProperties);
+    } else if (m_actionObject == QLatin1String("profilemanager")) {
+        m_profileManager->runAction(m_actionName, m_actionProperties);
     } else if (m_actionObject == QLatin1String("devicemanager")) {
         m_deviceManager->runAction(m_actionName, m_actionProperties);
     }
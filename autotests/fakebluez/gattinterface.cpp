@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattinterface.h"
+
+#include <QDBusMessage>
+#include <QDBusArgument>
+#include <QDBusConnection>
+#include <QSocketNotifier>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Fixed ATT MTU reported by AcquireNotify and AcquireWrite
+static const quint16 Mtu = 23;
+
+// Small send buffer of acquired write socket, so writers hit backpressure
+static const int WriteSendBufferSize = 4096;
+
+// GattObject
+GattObject::GattObject(const QDBusObjectPath &path, QObject *parent)
+    : QObject(parent)
+{
+    QDBusConnection::sessionBus().registerObject(path.path(), this);
+}
+
+// GattServiceInterface
+GattServiceInterface::GattServiceInterface(const QDBusObjectPath &path, const QVariantMap &properties, QObject *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+    setPath(path);
+    setObjectParent(parent);
+    setProperties(properties);
+    setName(QStringLiteral("org.bluez.GattService1"));
+}
+
+QString GattServiceInterface::uuid() const
+{
+    return Object::property(QStringLiteral("UUID")).toString();
+}
+
+bool GattServiceInterface::primary() const
+{
+    return Object::property(QStringLiteral("Primary")).toBool();
+}
+
+QDBusObjectPath GattServiceInterface::device() const
+{
+    return Object::property(QStringLiteral("Device")).value<QDBusObjectPath>();
+}
+
+// GattCharacteristicInterface
+GattCharacteristicInterface::GattCharacteristicInterface(const QDBusObjectPath &path, const QVariantMap &properties, QObject *parent)
+    : QDBusAbstractAdaptor(parent)
+    , m_notifyFd(-1)
+    , m_writeFd(-1)
+    , m_writeMtu(properties.value(QStringLiteral("WriteMtu"), Mtu).value<quint16>())
+    , m_writeNotifier(nullptr)
+{
+    // WriteMtu overrides the MTU reported by AcquireWrite()
+    QVariantMap characteristicProps = properties;
+    characteristicProps.remove(QStringLiteral("WriteMtu"));
+
+    setPath(path);
+    setObjectParent(parent);
+    setProperties(characteristicProps);
+    setName(QStringLiteral("org.bluez.GattCharacteristic1"));
+}
+
+GattCharacteristicInterface::~GattCharacteristicInterface()
+{
+    if (m_notifyFd != -1) {
+        ::close(m_notifyFd);
+    }
+    closeWrite();
+}
+
+QString GattCharacteristicInterface::uuid() const
+{
+    return Object::property(QStringLiteral("UUID")).toString();
+}
+
+QDBusObjectPath GattCharacteristicInterface::service() const
+{
+    return Object::property(QStringLiteral("Service")).value<QDBusObjectPath>();
+}
+
+QByteArray GattCharacteristicInterface::value() const
+{
+    return Object::property(QStringLiteral("Value")).toByteArray();
+}
+
+bool GattCharacteristicInterface::notifying() const
+{
+    return Object::property(QStringLiteral("Notifying")).toBool();
+}
+
+QStringList GattCharacteristicInterface::flags() const
+{
+    return Object::property(QStringLiteral("Flags")).toStringList();
+}
+
+void GattCharacteristicInterface::notify(const QByteArray &value, int count)
+{
+    if (m_notifyFd == -1) {
+        return;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        if (::write(m_notifyFd, value.constData(), value.size()) < 0) {
+            return;
+        }
+    }
+}
+
+QByteArray GattCharacteristicInterface::ReadValue(const QVariantMap &options)
+{
+    Q_UNUSED(options)
+
+    return value();
+}
+
+void GattCharacteristicInterface::WriteValue(const QByteArray &value, const QVariantMap &options)
+{
+    Q_UNUSED(options)
+
+    Object::changeProperty(QStringLiteral("Value"), value);
+}
+
+QDBusUnixFileDescriptor GattCharacteristicInterface::AcquireNotify(const QVariantMap &options, quint16 &mtu)
+{
+    Q_UNUSED(options)
+
+    if (m_notifyFd != -1) {
+        ::close(m_notifyFd);
+        m_notifyFd = -1;
+    }
+
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) < 0) {
+        return QDBusUnixFileDescriptor();
+    }
+
+    m_notifyFd = fds[0];
+    mtu = Mtu;
+
+    // QDBusUnixFileDescriptor keeps its own duplicate
+    const QDBusUnixFileDescriptor fd(fds[1]);
+    ::close(fds[1]);
+    return fd;
+}
+
+QDBusUnixFileDescriptor GattCharacteristicInterface::AcquireWrite(const QVariantMap &options, quint16 &mtu)
+{
+    Q_UNUSED(options)
+
+    closeWrite();
+
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) < 0) {
+        return QDBusUnixFileDescriptor();
+    }
+
+    ::setsockopt(fds[1], SOL_SOCKET, SO_SNDBUF, &WriteSendBufferSize, sizeof(WriteSendBufferSize));
+    ::fcntl(fds[0], F_SETFL, ::fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+
+    m_writeFd = fds[0];
+    m_writeNotifier = new QSocketNotifier(m_writeFd, QSocketNotifier::Read, this);
+    connect(m_writeNotifier, &QSocketNotifier::activated, this, &GattCharacteristicInterface::readWrites);
+    mtu = m_writeMtu;
+
+    const QDBusUnixFileDescriptor fd(fds[1]);
+    ::close(fds[1]);
+    return fd;
+}
+
+void GattCharacteristicInterface::readWrites()
+{
+    char buffer[512];
+    bool changed = false;
+
+    Q_FOREVER {
+        const ssize_t size = ::recv(m_writeFd, buffer, sizeof(buffer), 0);
+        if (size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        // Like BlueZ, close the socket on packets larger than MTU without ATT header
+        if (size <= 0 || size > Mtu - 3) {
+            closeWrite();
+            break;
+        }
+        m_writtenData.append(buffer, int(size));
+        changed = true;
+    }
+
+    // All data written through the socket are exposed as Value, so tests can verify them
+    if (changed) {
+        Object::changeProperty(QStringLiteral("Value"), m_writtenData);
+    }
+}
+
+void GattCharacteristicInterface::closeWrite()
+{
+    if (m_writeFd == -1) {
+        return;
+    }
+
+    delete m_writeNotifier;
+    m_writeNotifier = nullptr;
+
+    ::close(m_writeFd);
+    m_writeFd = -1;
+}
+
+void GattCharacteristicInterface::StartNotify()
+{
+    Object::changeProperty(QStringLiteral("Notifying"), true);
+}
+
+void GattCharacteristicInterface::StopNotify()
+{
+    Object::changeProperty(QStringLiteral("Notifying"), false);
+}
+
+// GattDescriptorInterface
+GattDescriptorInterface::GattDescriptorInterface(const QDBusObjectPath &path, const QVariantMap &properties, QObject *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+    setPath(path);
+    setObjectParent(parent);
+    setProperties(properties);
+    setName(QStringLiteral("org.bluez.GattDescriptor1"));
+}
+
+QString GattDescriptorInterface::uuid() const
+{
+    return Object::property(QStringLiteral("UUID")).toString();
+}
+
+QDBusObjectPath GattDescriptorInterface::characteristic() const
+{
+    return Object::property(QStringLiteral("Characteristic")).value<QDBusObjectPath>();
+}
+
+QByteArray GattDescriptorInterface::value() const
+{
+    return Object::property(QStringLiteral("Value")).toByteArray();
+}
+
+QByteArray GattDescriptorInterface::ReadValue(const QVariantMap &options)
+{
+    Q_UNUSED(options)
+
+    return value();
+}
+
+void GattDescriptorInterface::WriteValue(const QByteArray &value, const QVariantMap &options)
+{
+    Q_UNUSED(options)
+
+    Object::changeProperty(QStringLiteral("Value"), value);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GATTINTERFACE_H
+#define GATTINTERFACE_H
+
+#include "object.h"
+
+#include <QDBusAbstractAdaptor>
+#include <QDBusUnixFileDescriptor>
+
+class QDBusMessage;
+class QDBusObjectPath;
+class QSocketNotifier;
+
+class GattObject : public QObject
+{
+public:
+    explicit GattObject(const QDBusObjectPath &path, QObject *parent = nullptr);
+};
+
+class GattServiceInterface : public QDBusAbstractAdaptor, public Object
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.bluez.GattService1")
+    Q_PROPERTY(QString UUID READ uuid)
+    Q_PROPERTY(bool Primary READ primary)
+    Q_PROPERTY(QDBusObjectPath Device READ device)
+
+public:
+    explicit GattServiceInterface(const QDBusObjectPath &path, const QVariantMap &properties, QObject *parent = nullptr);
+
+    QString uuid() const;
+    bool primary() const;
+    QDBusObjectPath device() const;
+};
+
+class GattCharacteristicInterface : public QDBusAbstractAdaptor, public Object
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.bluez.GattCharacteristic1")
+    Q_PROPERTY(QString UUID READ uuid)
+    Q_PROPERTY(QDBusObjectPath Service READ service)
+    Q_PROPERTY(QByteArray Value READ value)
+    Q_PROPERTY(bool Notifying READ notifying)
+    Q_PROPERTY(QStringList Flags READ flags)
+
+public:
+    explicit GattCharacteristicInterface(const QDBusObjectPath &path, const QVariantMap &properties, QObject *parent = nullptr);
+    ~GattCharacteristicInterface();
+
+    QString uuid() const;
+    QDBusObjectPath service() const;
+    QByteArray value() const;
+    bool notifying() const;
+    QStringList flags() const;
+
+    // Sends the value count times over the socket passed to AcquireNotify
+    void notify(const QByteArray &value, int count);
+
+public Q_SLOTS:
+    QByteArray ReadValue(const QVariantMap &options);
+    void WriteValue(const QByteArray &value, const QVariantMap &options);
+    QDBusUnixFileDescriptor AcquireNotify(const QVariantMap &options, quint16 &mtu);
+    QDBusUnixFileDescriptor AcquireWrite(const QVariantMap &options, quint16 &mtu);
+    void StartNotify();
+    void StopNotify();
+
+private:
+    void readWrites();
+    void closeWrite();
+
+    int m_notifyFd;
+    int m_writeFd;
+    quint16 m_writeMtu;
+    QSocketNotifier *m_writeNotifier;
+    QByteArray m_writtenData;
+};
+
+class GattDescriptorInterface : public QDBusAbstractAdaptor, public Object
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.bluez.GattDescriptor1")
+    Q_PROPERTY(QString UUID READ uuid)
+    Q_PROPERTY(QDBusObjectPath Characteristic READ characteristic)
+    Q_PROPERTY(QByteArray Value READ value)
+
+public:
+    explicit GattDescriptorInterface(const QDBusObjectPath &path, const QVariantMap &properties, QObject *parent = nullptr);
+
+    QString uuid() const;
+    QDBusObjectPath characteristic() const;
+    QByteArray value() const;
+
+public Q_SLOTS:
+    QByteArray ReadValue(const QVariantMap &options);
+    void WriteValue(const QByteArray &value, const QVariantMap &options);
+};
+
+#endif // GATTINTERFACE_H
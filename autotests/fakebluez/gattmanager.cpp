@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattmanager.h"
+#include "objectmanager.h"
+
+#include <QDBusMessage>
+#include <QDBusConnection>
+#include <QDBusPendingReply>
+#include <QDBusPendingCallWatcher>
+
+GattManager::GattManager(QObject *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+}
+
+void GattManager::RegisterApplication(const QDBusObjectPath &path, const QVariantMap &options, const QDBusMessage &msg)
+{
+    Q_UNUSED(options)
+
+    const QString application = msg.service() + path.path();
+    if (m_applications.contains(application)) {
+        QDBusConnection::sessionBus().send(msg.createErrorReply(QStringLiteral("org.bluez.Error.AlreadyExists"), QStringLiteral("Already Exists")));
+        return;
+    }
+
+    msg.setDelayedReply(true);
+
+    // Like BlueZ, read the application objects before replying
+    QDBusMessage call = QDBusMessage::createMethodCall(msg.service(), path.path(),
+                                                       QStringLiteral("org.freedesktop.DBus.ObjectManager"),
+                                                       QStringLiteral("GetManagedObjects"));
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(QDBusConnection::sessionBus().asyncCall(call), this);
+
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, msg, application](QDBusPendingCallWatcher *watcher) {
+        const QDBusPendingReply<DBusManagerStruct> &reply = *watcher;
+        watcher->deleteLater();
+
+        if (reply.isError()) {
+            QDBusConnection::sessionBus().send(msg.createErrorReply(QStringLiteral("org.bluez.Error.Failed"), reply.error().message()));
+            return;
+        }
+
+        bool haveService = false;
+        Q_FOREACH (const QVariantMapMap &interfaces, reply.value()) {
+            haveService |= interfaces.contains(QStringLiteral("org.bluez.GattService1"));
+        }
+
+        if (!haveService) {
+            QDBusConnection::sessionBus().send(msg.createErrorReply(QStringLiteral("org.bluez.Error.InvalidArguments"), QStringLiteral("No object received")));
+            return;
+        }
+
+        m_applications.insert(application);
+        QDBusConnection::sessionBus().send(msg.createReply());
+    });
+}
+
+void GattManager::UnregisterApplication(const QDBusObjectPath &path, const QDBusMessage &msg)
+{
+    if (!m_applications.remove(msg.service() + path.path())) {
+        QDBusConnection::sessionBus().send(msg.createErrorReply(QStringLiteral("org.bluez.Error.DoesNotExist"), QStringLiteral("Does Not Exist")));
+    }
+}
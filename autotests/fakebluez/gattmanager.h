@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GATTMANAGER_H
+#define GATTMANAGER_H
+
+#include <QSet>
+#include <QDBusAbstractAdaptor>
+
+class QDBusMessage;
+class QDBusObjectPath;
+
+class GattManager : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.bluez.GattManager1")
+
+public:
+    explicit GattManager(QObject *parent = nullptr);
+
+public Q_SLOTS:
+    void RegisterApplication(const QDBusObjectPath &path, const QVariantMap &options, const QDBusMessage &msg);
+    void UnregisterApplication(const QDBusObjectPath &path, const QDBusMessage &msg);
+
+private:
+    QSet<QString> m_applications;
+};
+
+#endif // GATTMANAGER_H
@@ -21,8 +21,81 @@
 #include "profilemanager.h"
 
 #include <QDebug>
+#include <QSocketNotifier>
 #include <QDBusMessage>
 #include <QDBusConnection>
+#include <QDBusUnixFileDescriptor>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Remote side of a profile connection, sends back all received data
+class EchoConnection : public QObject
+{
+public:
+    explicit EchoConnection(int fd, QObject *parent)
+        : QObject(parent)
+        , m_fd(fd)
+        , m_readNotifier(new QSocketNotifier(fd, QSocketNotifier::Read, this))
+        , m_writeNotifier(new QSocketNotifier(fd, QSocketNotifier::Write, this))
+    {
+        ::fcntl(m_fd, F_SETFL, ::fcntl(m_fd, F_GETFL) | O_NONBLOCK);
+
+        m_writeNotifier->setEnabled(false);
+        connect(m_readNotifier, &QSocketNotifier::activated, this, [this]() { readData(); });
+        connect(m_writeNotifier, &QSocketNotifier::activated, this, [this]() { writeData(); });
+    }
+
+    ~EchoConnection()
+    {
+        ::close(m_fd);
+    }
+
+private:
+    void readData()
+    {
+        char buffer[65536];
+        const ssize_t ret = ::read(m_fd, buffer, sizeof(buffer));
+
+        if (ret == 0 || (ret < 0 && errno != EAGAIN && errno != EINTR)) {
+            m_readNotifier->setEnabled(false);
+            deleteLater();
+            return;
+        }
+
+        if (ret > 0) {
+            m_pending.append(buffer, int(ret));
+            writeData();
+        }
+    }
+
+    void writeData()
+    {
+        const ssize_t ret = ::send(m_fd, m_pending.constData(), size_t(m_pending.size()), MSG_NOSIGNAL);
+
+        if (ret < 0 && errno != EAGAIN && errno != EINTR) {
+            m_readNotifier->setEnabled(false);
+            m_writeNotifier->setEnabled(false);
+            deleteLater();
+            return;
+        }
+
+        if (ret > 0) {
+            m_pending.remove(0, int(ret));
+        }
+
+        // Stop reading until the data are sent back
+        m_readNotifier->setEnabled(m_pending.isEmpty());
+        m_writeNotifier->setEnabled(!m_pending.isEmpty());
+    }
+
+    int m_fd;
+    QByteArray m_pending;
+    QSocketNotifier *m_readNotifier;
+    QSocketNotifier *m_writeNotifier;
+};
 
 ProfileManager::ProfileManager(QObject *parent)
     : QDBusAbstractAdaptor(parent)
@@ -31,16 +104,54 @@ ProfileManager::ProfileManager(QObject *parent)
     setPath(QDBusObjectPath(QStringLiteral("/org/bluez")));
 }
 
+void ProfileManager::runAction(const QString &actionName, const QVariantMap &properties)
+{
+    if (actionName == QLatin1String("create-connections")) {
+        runCreateConnectionsAction(properties);
+    }
+}
+
 void ProfileManager::RegisterProfile(const QDBusObjectPath &path, const QString &uuid, const QVariantMap &options, const QDBusMessage &msg)
 {
-    Q_UNUSED(path)
     Q_UNUSED(uuid)
     Q_UNUSED(options)
-    Q_UNUSED(msg)
+
+    m_profile = path;
+    m_service = msg.service();
 }
 
 void ProfileManager::UnregisterProfile(const QDBusObjectPath &path, const QDBusMessage &msg)
 {
-    Q_UNUSED(path)
-    Q_UNUSED(msg)
+    if (m_profile == path && m_service == msg.service()) {
+        m_profile = QDBusObjectPath();
+        m_service.clear();
+    }
+}
+
+void ProfileManager::runCreateConnectionsAction(const QVariantMap &properties)
+{
+    const QDBusObjectPath &device = properties.value(QStringLiteral("Device")).value<QDBusObjectPath>();
+    const int count = properties.value(QStringLiteral("Count"), 1).toInt();
+
+    for (int i = 0; i < count; ++i) {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0) {
+            qWarning() << "Cannot create socket pair";
+            return;
+        }
+
+        new EchoConnection(fds[1], this);
+
+        QDBusMessage call = QDBusMessage::createMethodCall(m_service,
+                            m_profile.path(),
+                            QStringLiteral("org.bluez.Profile1"),
+                            QStringLiteral("NewConnection"));
+
+        call << QVariant::fromValue(device);
+        call << QVariant::fromValue(QDBusUnixFileDescriptor(fds[0]));
+        call << QVariantMap();
+        QDBusConnection::sessionBus().asyncCall(call);
+
+        ::close(fds[0]);
+    }
 }
@@ -35,9 +35,17 @@ class ProfileManager : public QDBusAbstractAdaptor, public Object
 public:
     explicit ProfileManager(QObject *parent = nullptr);
 
+    void runAction(const QString &actionName, const QVariantMap &properties);
+
 public Q_SLOTS:
     void RegisterProfile(const QDBusObjectPath &path, const QString &uuid, const QVariantMap &options, const QDBusMessage &msg);
     void UnregisterProfile(const QDBusObjectPath &path, const QDBusMessage &msg);
+
+private:
+    void runCreateConnectionsAction(const QVariantMap &properties);
+
+    QDBusObjectPath m_profile;
+    QString m_service;
 };
 
 #endif // PROFILEMANAGER_H
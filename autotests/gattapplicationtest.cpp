@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattapplicationtest.h"
+#include "autotests.h"
+#include "pendingcall.h"
+#include "initmanagerjob.h"
+#include "bluezqt_dbustypes.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+#include <QDBusConnection>
+#include <QDBusUnixFileDescriptor>
+
+#include <sys/socket.h>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static int waitForFinished(PendingCall *call)
+{
+    QSignalSpy spy(call, SIGNAL(finished(PendingCall*)));
+    // Do not block, fake bluez calls GetManagedObjects of the application before replying
+    spy.wait();
+    return call->error();
+}
+
+GattApplicationTest::GattApplicationTest()
+    : m_manager(nullptr)
+    , m_application(nullptr)
+    , m_control(nullptr)
+    , m_measurement(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void GattApplicationTest::propertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated)
+{
+    Q_UNUSED(invalidated)
+
+    if (interface == QLatin1String("org.bluez.GattCharacteristic1") && changed.contains(QStringLiteral("Value"))) {
+        m_notifiedValues.append(changed.value(QStringLiteral("Value")).toByteArray());
+    }
+}
+
+void GattApplicationTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    // Create adapter
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    adapterProps[QStringLiteral("Powered")] = true;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+
+    QCOMPARE(m_manager->adapters().count(), 1);
+    m_adapter = m_manager->adapters().first();
+
+    // Heart rate service
+    m_application = new GattApplication(QStringLiteral("/org/kde/bluezqt/test"), this);
+    GattServerService *service = new GattServerService(QStringLiteral("0000180d-0000-1000-8000-00805f9b34fb"), true, m_application);
+    m_measurement = new GattServerCharacteristic(QStringLiteral("00002a37-0000-1000-8000-00805f9b34fb"), QStringList(QStringLiteral("notify")), service);
+    m_control = new GattServerCharacteristic(QStringLiteral("00002a39-0000-1000-8000-00805f9b34fb"),
+                                             QStringList() << QStringLiteral("read") << QStringLiteral("write"), service);
+    m_control->setValue(QByteArray("\x00", 1));
+}
+
+void GattApplicationTest::cleanupTestCase()
+{
+    delete m_application;
+    m_adapter.clear();
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void GattApplicationTest::registerTest()
+{
+    QCOMPARE(m_application->objectPath().path(), QStringLiteral("/org/kde/bluezqt/test/app0"));
+    QCOMPARE(m_application->services().count(), 1);
+
+    GattServerService *service = m_application->services().first();
+    QCOMPARE(service->objectPath().path(), QStringLiteral("/org/kde/bluezqt/test/app0/service0"));
+    QCOMPARE(service->characteristics().count(), 2);
+    QCOMPARE(m_measurement->objectPath().path(), QStringLiteral("/org/kde/bluezqt/test/app0/service0/char0"));
+    QCOMPARE(m_control->objectPath().path(), QStringLiteral("/org/kde/bluezqt/test/app0/service0/char1"));
+
+    QCOMPARE(waitForFinished(m_adapter->registerGattApplication(m_application)), int(PendingCall::NoError));
+    QCOMPARE(waitForFinished(m_adapter->registerGattApplication(m_application)), int(PendingCall::AlreadyExists));
+
+    // Application without services is rejected
+    GattApplication emptyApplication(QStringLiteral("/org/kde/bluezqt/test"));
+    QCOMPARE(waitForFinished(m_adapter->registerGattApplication(&emptyApplication)), int(PendingCall::InvalidArguments));
+    waitForFinished(m_adapter->unregisterGattApplication(&emptyApplication));
+}
+
+void GattApplicationTest::managedObjectsTest()
+{
+    QDBusMessage call = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(),
+                                                       m_application->objectPath().path(),
+                                                       QStringLiteral("org.freedesktop.DBus.ObjectManager"),
+                                                       QStringLiteral("GetManagedObjects"));
+    QDBusMessage reply = QDBusConnection::sessionBus().call(call);
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+
+    const DBusManagerStruct objects = qdbus_cast<DBusManagerStruct>(reply.arguments().first());
+    QCOMPARE(objects.count(), 3);
+
+    const QVariantMap service = objects.value(m_application->services().first()->objectPath()).value(QStringLiteral("org.bluez.GattService1"));
+    QCOMPARE(service.value(QStringLiteral("UUID")).toString(), QStringLiteral("0000180d-0000-1000-8000-00805f9b34fb"));
+    QCOMPARE(service.value(QStringLiteral("Primary")).toBool(), true);
+
+    const QVariantMap control = objects.value(m_control->objectPath()).value(QStringLiteral("org.bluez.GattCharacteristic1"));
+    QCOMPARE(control.value(QStringLiteral("UUID")).toString(), QStringLiteral("00002a39-0000-1000-8000-00805f9b34fb"));
+    QCOMPARE(qdbus_cast<QDBusObjectPath>(control.value(QStringLiteral("Service"))), m_application->services().first()->objectPath());
+    QCOMPARE(control.value(QStringLiteral("Flags")).toStringList(), QStringList() << QStringLiteral("read") << QStringLiteral("write"));
+    QCOMPARE(control.value(QStringLiteral("Value")).toByteArray(), QByteArray("\x00", 1));
+}
+
+void GattApplicationTest::readWriteTest()
+{
+    QSignalSpy writtenSpy(m_control, SIGNAL(valueWritten(QByteArray)));
+
+    QDBusMessage reply = callCharacteristic(m_control, QStringLiteral("ReadValue"), QVariantList() << QVariantMap());
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(reply.arguments().first().toByteArray(), QByteArray("\x00", 1));
+
+    reply = callCharacteristic(m_control, QStringLiteral("WriteValue"), QVariantList() << QByteArray("\x01", 1) << QVariantMap());
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+
+    QCOMPARE(writtenSpy.count(), 1);
+    QCOMPARE(writtenSpy.first().first().toByteArray(), QByteArray("\x01", 1));
+    QCOMPARE(m_control->value(), QByteArray("\x01", 1));
+
+    // Long write continues at offset
+    QVariantMap options;
+    options[QStringLiteral("offset")] = QVariant::fromValue(quint16(1));
+    reply = callCharacteristic(m_control, QStringLiteral("WriteValue"), QVariantList() << QByteArray("\x02\x03", 2) << options);
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(m_control->value(), QByteArray("\x01\x02\x03", 3));
+
+    // Long read continues at offset
+    options[QStringLiteral("offset")] = QVariant::fromValue(quint16(2));
+    reply = callCharacteristic(m_control, QStringLiteral("ReadValue"), QVariantList() << options);
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(reply.arguments().first().toByteArray(), QByteArray("\x03", 1));
+
+    // Offset past the end of value
+    options[QStringLiteral("offset")] = QVariant::fromValue(quint16(4));
+    reply = callCharacteristic(m_control, QStringLiteral("ReadValue"), QVariantList() << options);
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), QStringLiteral("org.bluez.Error.InvalidOffset"));
+
+    reply = callCharacteristic(m_control, QStringLiteral("WriteValue"), QVariantList() << QByteArray("\x04", 1) << options);
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), QStringLiteral("org.bluez.Error.InvalidOffset"));
+    QCOMPARE(writtenSpy.count(), 2);
+    QCOMPARE(m_control->value(), QByteArray("\x01\x02\x03", 3));
+}
+
+void GattApplicationTest::notifyTest()
+{
+    QSignalSpy notifyingSpy(m_measurement, SIGNAL(notifyingChanged(bool)));
+
+    QVERIFY(QDBusConnection::sessionBus().connect(QString(), m_measurement->objectPath().path(),
+                                                  QStringLiteral("org.freedesktop.DBus.Properties"),
+                                                  QStringLiteral("PropertiesChanged"),
+                                                  this, SLOT(propertiesChanged(QString,QVariantMap,QStringList))));
+
+    // No notifications until subscribed
+    m_measurement->setValue(QByteArray("\x06\x00", 2));
+
+    QCOMPARE(callCharacteristic(m_measurement, QStringLiteral("StartNotify"), QVariantList()).type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(notifyingSpy.count(), 1);
+    QVERIFY(m_measurement->isNotifying());
+
+    m_measurement->setNotificationInterval(100);
+
+    // First update is sent right away, the rest within the interval is coalesced
+    for (int i = 1; i <= 50; ++i) {
+        m_measurement->setValue(QByteArray("\x06", 1) + char(i));
+    }
+
+    QTRY_COMPARE(m_notifiedValues.count(), 2);
+    QCOMPARE(m_notifiedValues.at(0), QByteArray("\x06\x01", 2));
+    QCOMPARE(m_notifiedValues.at(1), QByteArray("\x06\x32", 2));
+
+    // Nothing else is pending
+    QTest::qWait(200);
+    QCOMPARE(m_notifiedValues.count(), 2);
+
+    QCOMPARE(callCharacteristic(m_measurement, QStringLiteral("StopNotify"), QVariantList()).type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(notifyingSpy.count(), 2);
+    QVERIFY(!m_measurement->isNotifying());
+
+    QDBusConnection::sessionBus().disconnect(QString(), m_measurement->objectPath().path(),
+                                             QStringLiteral("org.freedesktop.DBus.Properties"),
+                                             QStringLiteral("PropertiesChanged"),
+                                             this, SLOT(propertiesChanged(QString,QVariantMap,QStringList)));
+}
+
+void GattApplicationTest::acquireNotifyTest()
+{
+    QSignalSpy acquiredSpy(m_measurement, SIGNAL(notifyAcquiredChanged(bool)));
+
+    QVariantMap options;
+    options[QStringLiteral("mtu")] = QVariant::fromValue(quint16(185));
+    QDBusMessage reply = callCharacteristic(m_measurement, QStringLiteral("AcquireNotify"), QVariantList() << options);
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+
+    QCOMPARE(reply.arguments().count(), 2);
+    QDBusUnixFileDescriptor fd = qdbus_cast<QDBusUnixFileDescriptor>(reply.arguments().at(0));
+    QVERIFY(fd.isValid());
+    QCOMPARE(reply.arguments().at(1).value<quint16>(), quint16(185));
+    QVERIFY(m_measurement->isNotifyAcquired());
+    QCOMPARE(acquiredSpy.count(), 1);
+
+    m_measurement->setNotificationInterval(50);
+    for (int i = 1; i <= 100; ++i) {
+        m_measurement->setValue(QByteArray("\x06", 1) + char(i));
+    }
+
+    QList<QByteArray> packets;
+    auto readPackets = [&]() {
+        char buffer[32];
+        ssize_t size;
+        while ((size = ::recv(fd.fileDescriptor(), buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+            packets.append(QByteArray(buffer, int(size)));
+        }
+        return packets.count();
+    };
+
+    QTRY_COMPARE(readPackets(), 2);
+
+    QCOMPARE(packets.at(0), QByteArray("\x06\x01", 2));
+    QCOMPARE(packets.at(1), QByteArray("\x06\x64", 2));
+
+    // Closing the socket releases the notifications
+    fd = QDBusUnixFileDescriptor();
+    reply = QDBusMessage();
+    QTRY_VERIFY(!m_measurement->isNotifyAcquired());
+    QCOMPARE(acquiredSpy.count(), 2);
+}
+
+void GattApplicationTest::unregisterTest()
+{
+    QCOMPARE(waitForFinished(m_adapter->unregisterGattApplication(m_application)), int(PendingCall::NoError));
+    QCOMPARE(waitForFinished(m_adapter->unregisterGattApplication(m_application)), int(PendingCall::DoesNotExist));
+}
+
+QDBusMessage GattApplicationTest::callCharacteristic(GattServerCharacteristic *characteristic, const QString &method, const QVariantList &args)
+{
+    // Calls the exported object the same way BlueZ would
+    QDBusMessage call = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(),
+                                                       characteristic->objectPath().path(),
+                                                       QStringLiteral("org.bluez.GattCharacteristic1"),
+                                                       method);
+    call.setArguments(args);
+    return QDBusConnection::sessionBus().call(call);
+}
+
+QTEST_MAIN(GattApplicationTest)
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GATTAPPLICATIONTEST_H
+#define GATTAPPLICATIONTEST_H
+
+#include <QObject>
+#include <QDBusMessage>
+
+#include "manager.h"
+#include "adapter.h"
+#include "gattapplication.h"
+#include "gattserverservice.h"
+#include "gattservercharacteristic.h"
+
+class GattApplicationTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit GattApplicationTest();
+
+public Q_SLOTS:
+    void propertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated);
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void registerTest();
+    void managedObjectsTest();
+    void readWriteTest();
+    void notifyTest();
+    void acquireNotifyTest();
+    void unregisterTest();
+
+private:
+    QDBusMessage callCharacteristic(BluezQt::GattServerCharacteristic *characteristic, const QString &method, const QVariantList &args);
+
+    BluezQt::Manager *m_manager;
+    BluezQt::AdapterPtr m_adapter;
+    BluezQt::GattApplication *m_application;
+    BluezQt::GattServerCharacteristic *m_control;
+    BluezQt::GattServerCharacteristic *m_measurement;
+    QList<QByteArray> m_notifiedValues;
+};
+
+#endif // GATTAPPLICATIONTEST_H
@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattcharacteristictest.h"
+#include "autotests.h"
+#include "pendingcall.h"
+#include "pendingreply.h"
+#include "initmanagerjob.h"
+#include "gattdescriptor.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString adapterPath = QStringLiteral("/org/bluez/hci0");
+static const QString devicePath = adapterPath + QStringLiteral("/dev_40_79_6A_0C_39_75");
+static const QString servicePath = devicePath + QStringLiteral("/service0010");
+static const QString characteristicPath = servicePath + QStringLiteral("/char0011");
+static const QString descriptorPath = characteristicPath + QStringLiteral("/desc0013");
+
+GattCharacteristicTest::GattCharacteristicTest()
+    : m_manager(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void GattCharacteristicTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    // Create adapter
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    // Create device
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(devicePath));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    deviceProps[QStringLiteral("Connected")] = true;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    // Create heart rate service
+    QVariantMap serviceProps;
+    serviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(servicePath));
+    serviceProps[QStringLiteral("UUID")] = QStringLiteral("0000180d-0000-1000-8000-00805f9b34fb");
+    serviceProps[QStringLiteral("Primary")] = true;
+    serviceProps[QStringLiteral("Device")] = QVariant::fromValue(QDBusObjectPath(devicePath));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-gatt-service"), serviceProps);
+
+    QVariantMap characteristicProps;
+    characteristicProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(characteristicPath));
+    characteristicProps[QStringLiteral("UUID")] = QStringLiteral("00002a37-0000-1000-8000-00805f9b34fb");
+    characteristicProps[QStringLiteral("Service")] = QVariant::fromValue(QDBusObjectPath(servicePath));
+    characteristicProps[QStringLiteral("Value")] = QByteArray("\x06\x48", 2);
+    characteristicProps[QStringLiteral("Notifying")] = false;
+    characteristicProps[QStringLiteral("Flags")] = QStringList() << QStringLiteral("read") << QStringLiteral("write") << QStringLiteral("notify");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-gatt-characteristic"), characteristicProps);
+
+    QVariantMap descriptorProps;
+    descriptorProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(descriptorPath));
+    descriptorProps[QStringLiteral("UUID")] = QStringLiteral("00002902-0000-1000-8000-00805f9b34fb");
+    descriptorProps[QStringLiteral("Characteristic")] = QVariant::fromValue(QDBusObjectPath(characteristicPath));
+    descriptorProps[QStringLiteral("Value")] = QByteArray("\x00\x00", 2);
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-gatt-descriptor"), descriptorProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+
+    QCOMPARE(m_manager->devices().count(), 1);
+    m_device = m_manager->devices().first();
+
+    QCOMPARE(m_device->gattServices().count(), 1);
+    QCOMPARE(m_device->gattServices().first()->characteristics().count(), 1);
+    m_characteristic = m_device->gattServices().first()->characteristics().first();
+}
+
+void GattCharacteristicTest::cleanupTestCase()
+{
+    m_characteristic.clear();
+    m_device.clear();
+
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void GattCharacteristicTest::servicesTest()
+{
+    GattServicePtr service = m_device->gattServiceForUuid(QStringLiteral("0000180d-0000-1000-8000-00805f9b34fb"));
+    QVERIFY(service);
+    QCOMPARE(service->ubi(), servicePath);
+    QCOMPARE(service->uuid(), QStringLiteral("0000180D-0000-1000-8000-00805F9B34FB"));
+    QVERIFY(service->isPrimary());
+    QCOMPARE(service->characteristicForUuid(QStringLiteral("00002A37-0000-1000-8000-00805F9B34FB")), m_characteristic);
+    QCOMPARE(m_characteristic->service(), service);
+
+    // Services added after init
+    QSignalSpy serviceAddedSpy(m_device.data(), SIGNAL(gattServiceAdded(GattServicePtr)));
+    QSignalSpy serviceRemovedSpy(m_device.data(), SIGNAL(gattServiceRemoved(GattServicePtr)));
+
+    const QString service2Path = devicePath + QStringLiteral("/service0020");
+    QVariantMap serviceProps;
+    serviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(service2Path));
+    serviceProps[QStringLiteral("UUID")] = QStringLiteral("0000180f-0000-1000-8000-00805f9b34fb");
+    serviceProps[QStringLiteral("Primary")] = false;
+    serviceProps[QStringLiteral("Device")] = QVariant::fromValue(QDBusObjectPath(devicePath));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-gatt-service"), serviceProps);
+
+    QTRY_COMPARE(serviceAddedSpy.count(), 1);
+    QCOMPARE(m_device->gattServices().count(), 2);
+    QVERIFY(!m_device->gattServiceForUuid(QStringLiteral("0000180F-0000-1000-8000-00805F9B34FB"))->isPrimary());
+
+    QVariantMap removeProps;
+    removeProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(service2Path));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("remove-gatt-object"), removeProps);
+
+    QTRY_COMPARE(serviceRemovedSpy.count(), 1);
+    QCOMPARE(m_device->gattServices().count(), 1);
+}
+
+void GattCharacteristicTest::getPropertiesTest()
+{
+    QCOMPARE(m_characteristic->ubi(), characteristicPath);
+    QCOMPARE(m_characteristic->uuid(), QStringLiteral("00002A37-0000-1000-8000-00805F9B34FB"));
+    QCOMPARE(m_characteristic->value(), QByteArray("\x06\x48", 2));
+    QCOMPARE(m_characteristic->flags(), QStringList() << QStringLiteral("read") << QStringLiteral("write") << QStringLiteral("notify"));
+    QVERIFY(!m_characteristic->isNotifying());
+    QVERIFY(!m_characteristic->isNotifyAcquired());
+    QCOMPARE(m_characteristic->notifyMtu(), quint16(0));
+
+    QCOMPARE(m_characteristic->descriptors().count(), 1);
+    GattDescriptorPtr descriptor = m_characteristic->descriptors().first();
+    QCOMPARE(descriptor->ubi(), descriptorPath);
+    QCOMPARE(descriptor->uuid(), QStringLiteral("00002902-0000-1000-8000-00805F9B34FB"));
+    QCOMPARE(descriptor->value(), QByteArray("\x00\x00", 2));
+    QCOMPARE(descriptor->characteristic(), m_characteristic);
+}
+
+void GattCharacteristicTest::readValueTest()
+{
+    PendingReply<QByteArray> *reply = m_characteristic->readValue();
+    reply->waitForFinished();
+
+    QVERIFY(!reply->error());
+    QCOMPARE(reply->result(), QByteArray("\x06\x48", 2));
+
+    PendingReply<QByteArray> *descriptorReply = m_characteristic->descriptors().first()->readValue();
+    descriptorReply->waitForFinished();
+
+    QVERIFY(!descriptorReply->error());
+    QCOMPARE(descriptorReply->result(), QByteArray("\x00\x00", 2));
+}
+
+void GattCharacteristicTest::writeValueTest()
+{
+    QSignalSpy valueSpy(m_characteristic.data(), SIGNAL(valueChanged(QByteArray)));
+
+    PendingCall *call = m_characteristic->writeValue(QByteArray("\x01", 1));
+    call->waitForFinished();
+    QVERIFY(!call->error());
+
+    QTRY_COMPARE(valueSpy.count(), 1);
+    QCOMPARE(m_characteristic->value(), QByteArray("\x01", 1));
+
+    GattDescriptorPtr descriptor = m_characteristic->descriptors().first();
+    QSignalSpy descriptorValueSpy(descriptor.data(), SIGNAL(valueChanged(QByteArray)));
+
+    call = descriptor->writeValue(QByteArray("\x01\x00", 2));
+    call->waitForFinished();
+    QVERIFY(!call->error());
+
+    QTRY_COMPARE(descriptorValueSpy.count(), 1);
+    QCOMPARE(descriptor->value(), QByteArray("\x01\x00", 2));
+}
+
+void GattCharacteristicTest::startNotifyTest()
+{
+    QSignalSpy notifyingSpy(m_characteristic.data(), SIGNAL(notifyingChanged(bool)));
+
+    m_characteristic->startNotify()->waitForFinished();
+    QTRY_COMPARE(notifyingSpy.count(), 1);
+    QVERIFY(m_characteristic->isNotifying());
+
+    m_characteristic->stopNotify()->waitForFinished();
+    QTRY_COMPARE(notifyingSpy.count(), 2);
+    QVERIFY(!m_characteristic->isNotifying());
+}
+
+void GattCharacteristicTest::acquireNotifyTest()
+{
+    QSignalSpy acquiredSpy(m_characteristic.data(), SIGNAL(notifyAcquiredChanged(bool)));
+
+    // Notified values are owned copies, they can be kept after the slot returns
+    QSignalSpy notifiedSpy(m_characteristic.data(), SIGNAL(valueNotified(QByteArray)));
+
+    PendingCall *call = m_characteristic->acquireNotify();
+    call->waitForFinished();
+    QVERIFY(!call->error());
+
+    // Socket is ready when the call is finished
+    QVERIFY(m_characteristic->isNotifyAcquired());
+    QCOMPARE(acquiredSpy.count(), 1);
+    QCOMPARE(m_characteristic->notifyMtu(), quint16(23));
+
+    QVariantMap notifyProps;
+    notifyProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(characteristicPath));
+    notifyProps[QStringLiteral("Value")] = QByteArray("\x06\x50", 2);
+    notifyProps[QStringLiteral("Count")] = 100;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("notify-gatt-characteristic"), notifyProps);
+
+    QTRY_COMPARE(notifiedSpy.count(), 100);
+    for (int i = 0; i < notifiedSpy.count(); ++i) {
+        QCOMPARE(notifiedSpy.at(i).at(0).toByteArray(), QByteArray("\x06\x50", 2));
+    }
+
+    m_characteristic->releaseNotify();
+    QVERIFY(!m_characteristic->isNotifyAcquired());
+    QCOMPARE(m_characteristic->notifyMtu(), quint16(0));
+    QCOMPARE(acquiredSpy.count(), 2);
+}
+
+void GattCharacteristicTest::removeCharacteristicTest()
+{
+    GattServicePtr service = m_characteristic->service();
+    QSignalSpy removedSpy(service.data(), SIGNAL(characteristicRemoved(GattCharacteristicPtr)));
+
+    QVariantMap removeProps;
+    removeProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(descriptorPath));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("remove-gatt-object"), removeProps);
+
+    QTRY_VERIFY(m_characteristic->descriptors().isEmpty());
+
+    removeProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(characteristicPath));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("remove-gatt-object"), removeProps);
+
+    QTRY_COMPARE(removedSpy.count(), 1);
+    QVERIFY(service->characteristics().isEmpty());
+}
+
+QTEST_MAIN(GattCharacteristicTest)
@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattwritestreamtest.h"
+#include "autotests.h"
+#include "pendingcall.h"
+#include "initmanagerjob.h"
+#include "device.h"
+#include "gattservice.h"
+#include "gattwritestream.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString adapterPath = QStringLiteral("/org/bluez/hci0");
+static const QString devicePath = adapterPath + QStringLiteral("/dev_40_79_6A_0C_39_75");
+static const QString servicePath = devicePath + QStringLiteral("/service0010");
+static const QString characteristicPath = servicePath + QStringLiteral("/char0011");
+static const QString smallMtuCharacteristicPath = servicePath + QStringLiteral("/char0013");
+
+static QByteArray testData(int size)
+{
+    QByteArray data;
+    data.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        data.append(char(i % 251));
+    }
+    return data;
+}
+
+GattWriteStreamTest::GattWriteStreamTest()
+    : m_manager(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void GattWriteStreamTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    // Create adapter
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    // Create device
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(devicePath));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    deviceProps[QStringLiteral("Connected")] = true;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    // Create firmware update service
+    QVariantMap serviceProps;
+    serviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(servicePath));
+    serviceProps[QStringLiteral("UUID")] = QStringLiteral("0000fe59-0000-1000-8000-00805f9b34fb");
+    serviceProps[QStringLiteral("Primary")] = true;
+    serviceProps[QStringLiteral("Device")] = QVariant::fromValue(QDBusObjectPath(devicePath));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-gatt-service"), serviceProps);
+
+    QVariantMap characteristicProps;
+    characteristicProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(characteristicPath));
+    characteristicProps[QStringLiteral("UUID")] = QStringLiteral("8ec90002-f315-4f60-9fb8-838830daea50");
+    characteristicProps[QStringLiteral("Service")] = QVariant::fromValue(QDBusObjectPath(servicePath));
+    characteristicProps[QStringLiteral("Value")] = QByteArray();
+    characteristicProps[QStringLiteral("Flags")] = QStringList(QStringLiteral("write-without-response"));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-gatt-characteristic"), characteristicProps);
+
+    // Write socket of this characteristic has no room for data
+    characteristicProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(smallMtuCharacteristicPath));
+    characteristicProps[QStringLiteral("UUID")] = QStringLiteral("8ec90003-f315-4f60-9fb8-838830daea50");
+    characteristicProps[QStringLiteral("WriteMtu")] = QVariant::fromValue(quint16(3));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-gatt-characteristic"), characteristicProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+
+    QCOMPARE(m_manager->devices().count(), 1);
+    QCOMPARE(m_manager->devices().first()->gattServices().count(), 1);
+    GattServicePtr service = m_manager->devices().first()->gattServices().first();
+    QCOMPARE(service->characteristics().count(), 2);
+    m_characteristic = service->characteristicForUuid(QStringLiteral("8ec90002-f315-4f60-9fb8-838830daea50"));
+    m_smallMtuCharacteristic = service->characteristicForUuid(QStringLiteral("8ec90003-f315-4f60-9fb8-838830daea50"));
+    QVERIFY(m_characteristic);
+    QVERIFY(m_smallMtuCharacteristic);
+}
+
+void GattWriteStreamTest::cleanupTestCase()
+{
+    m_characteristic.clear();
+    m_smallMtuCharacteristic.clear();
+
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void GattWriteStreamTest::openTest()
+{
+    GattWriteStream stream(m_characteristic);
+    QSignalSpy openSpy(&stream, SIGNAL(openChanged(bool)));
+
+    QVERIFY(!stream.isOpen());
+    QCOMPARE(stream.mtu(), quint16(0));
+    QCOMPARE(stream.write(QByteArray("data")), qint64(-1));
+
+    PendingCall *call = stream.open();
+    call->waitForFinished();
+    QVERIFY(!call->error());
+
+    QTRY_VERIFY(stream.isOpen());
+    QCOMPARE(openSpy.count(), 1);
+    QCOMPARE(stream.mtu(), quint16(23));
+    QCOMPARE(stream.chunkSize(), 20);
+
+    call = stream.open();
+    call->waitForFinished();
+    QCOMPARE(call->error(), int(PendingCall::AlreadyExists));
+}
+
+void GattWriteStreamTest::invalidMtuTest()
+{
+    GattWriteStream stream(m_smallMtuCharacteristic);
+    QSignalSpy openSpy(&stream, SIGNAL(openChanged(bool)));
+
+    PendingCall *call = stream.open();
+    call->waitForFinished();
+    QCOMPARE(call->error(), int(PendingCall::Failed));
+
+    QVERIFY(!stream.isOpen());
+    QCOMPARE(openSpy.count(), 0);
+    QCOMPARE(stream.mtu(), quint16(0));
+    QCOMPARE(stream.write(QByteArray("data")), qint64(-1));
+}
+
+void GattWriteStreamTest::writeTest()
+{
+    GattWriteStream stream(m_characteristic);
+    stream.open()->waitForFinished();
+    QTRY_VERIFY(stream.isOpen());
+
+    // Small writes are batched into packets of chunkSize() bytes
+    const QByteArray data = testData(2000);
+    for (int i = 0; i < data.size(); i += 8) {
+        QCOMPARE(stream.write(data.mid(i, 8)), qint64(8));
+    }
+    QCOMPARE(stream.bytesToWrite(), qint64(2000));
+
+    QTRY_COMPARE(stream.bytesToWrite(), qint64(0));
+    QCOMPARE(stream.totalBytesWritten(), qint64(2000));
+    QCOMPARE(stream.packetsWritten(), qint64(100));
+
+    QTRY_VERIFY(m_characteristic->value().endsWith(data));
+
+    // Fake bluez closes the socket when it receives a packet larger than MTU
+    QVERIFY(stream.isOpen());
+}
+
+void GattWriteStreamTest::backpressureTest()
+{
+    GattWriteStream stream(m_characteristic);
+    stream.setMaximumBufferSize(100);
+    stream.open()->waitForFinished();
+    QTRY_VERIFY(stream.isOpen());
+
+    const QByteArray data = testData(5000);
+    int offset = 0;
+
+    connect(&stream, &GattWriteStream::bytesWritten, this, [&]() {
+        offset += stream.write(data.mid(offset));
+    });
+
+    offset += stream.write(data);
+    QCOMPARE(offset, 100);
+    QCOMPARE(stream.write(data.mid(offset)), qint64(0));
+
+    QTRY_COMPARE_WITH_TIMEOUT(offset, data.size(), 10000);
+    QTRY_COMPARE(stream.bytesToWrite(), qint64(0));
+    QCOMPARE(stream.totalBytesWritten(), qint64(data.size()));
+
+    QTRY_VERIFY_WITH_TIMEOUT(m_characteristic->value().endsWith(data), 10000);
+    QVERIFY(stream.isOpen());
+}
+
+void GattWriteStreamTest::statisticsTest()
+{
+    GattWriteStream stream(m_characteristic);
+    stream.open()->waitForFinished();
+    QTRY_VERIFY(stream.isOpen());
+
+    QCOMPARE(stream.throughput(), qreal(0));
+    QCOMPARE(stream.averageLatency(), qint64(0));
+
+    const QByteArray data = testData(1000);
+    stream.write(data);
+    QTRY_COMPARE(stream.totalBytesWritten(), qint64(1000));
+    QCOMPARE(stream.packetsWritten(), qint64(50));
+
+    QTest::qWait(10);
+    stream.write(data);
+    QTRY_COMPARE(stream.totalBytesWritten(), qint64(2000));
+
+    QVERIFY(stream.throughput() > 0);
+    QVERIFY(stream.maximumLatency() >= stream.averageLatency());
+
+    stream.resetStatistics();
+    QCOMPARE(stream.totalBytesWritten(), qint64(0));
+    QCOMPARE(stream.packetsWritten(), qint64(0));
+    QCOMPARE(stream.throughput(), qreal(0));
+    QCOMPARE(stream.averageLatency(), qint64(0));
+    QCOMPARE(stream.maximumLatency(), qint64(0));
+}
+
+void GattWriteStreamTest::closeTest()
+{
+    GattWriteStream stream(m_characteristic);
+    QSignalSpy openSpy(&stream, SIGNAL(openChanged(bool)));
+
+    stream.open()->waitForFinished();
+    QTRY_VERIFY(stream.isOpen());
+
+    stream.write(testData(100));
+    stream.close();
+
+    QVERIFY(!stream.isOpen());
+    QCOMPARE(openSpy.count(), 2);
+    QCOMPARE(stream.bytesToWrite(), qint64(0));
+    QCOMPARE(stream.mtu(), quint16(0));
+    QCOMPARE(stream.write(testData(100)), qint64(-1));
+}
+
+QTEST_MAIN(GattWriteStreamTest)
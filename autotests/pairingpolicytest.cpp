@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pairingpolicytest.h"
+#include "autotests.h"
+#include "device.h"
+#include "pendingcall.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QElapsedTimer>
+#include <QDBusObjectPath>
+#include <QDBusPendingCall>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString adapterPath = QStringLiteral("/org/bluez/hci0");
+static const QString device1Path = adapterPath + QStringLiteral("/dev_40_79_6A_0C_39_75");
+static const QString device2Path = adapterPath + QStringLiteral("/dev_50_79_6A_0C_39_75");
+
+static const QString rejectedError = QStringLiteral("org.bluez.Agent1.Rejected");
+static const QString canceledError = QStringLiteral("org.bluez.Agent1.Canceled");
+
+// Agent getting forwarded requests, it answers only if asked to
+class ForwardAgent : public Agent
+{
+public:
+    explicit ForwardAgent(QObject *parent)
+        : Agent(parent)
+        , answer(true)
+        , requests(0)
+    {
+    }
+
+    QDBusObjectPath objectPath() const override
+    {
+        return QDBusObjectPath(QStringLiteral("/forwardagent"));
+    }
+
+    void requestAuthorization(DevicePtr device, const Request<> &request) override
+    {
+        Q_UNUSED(device)
+
+        requests++;
+        if (answer) {
+            request.accept();
+        }
+    }
+
+    bool answer;
+    int requests;
+};
+
+PairingPolicyTest::PairingPolicyTest()
+    : m_manager(nullptr)
+    , m_policy(nullptr)
+    , m_agent(nullptr)
+    , m_connection(QDBusConnection::connectToBus(QDBusConnection::SessionBus, QStringLiteral("pairingpolicytest")))
+{
+    Autotests::registerMetatypes();
+}
+
+void PairingPolicyTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    // Create adapter
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    // Create devices
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device1Path));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device2Path));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("50:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice2");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+    QCOMPARE(m_manager->devices().count(), 2);
+
+    m_agent = new ForwardAgent(this);
+    m_policy = new PairingPolicy(this);
+    QCOMPARE(m_policy->objectPath().path(), QStringLiteral("/org/kde/bluezqt/PairingPolicy"));
+
+    PendingCall *call = m_manager->registerAgent(m_policy);
+    call->waitForFinished();
+    QVERIFY(!call->error());
+}
+
+void PairingPolicyTest::cleanupTestCase()
+{
+    m_manager->unregisterAgent(m_policy)->waitForFinished();
+    delete m_policy;
+    delete m_agent;
+    delete m_manager;
+
+    QDBusConnection::disconnectFromBus(QStringLiteral("pairingpolicytest"));
+
+    FakeBluez::stop();
+}
+
+void PairingPolicyTest::init()
+{
+    m_policy->setAgent(nullptr);
+    m_policy->setAllowAll(true);
+    m_policy->setAllowedAddresses(QStringList());
+    m_policy->setAllowedServices(QStringList());
+    m_policy->setPinCode(QString());
+    m_policy->setPinCodeFunction(nullptr);
+    m_policy->setPasskeyFunction(nullptr);
+    m_policy->setRequestTimeout(-1);
+    m_policy->resetStatistics();
+
+    m_agent->answer = true;
+    m_agent->requests = 0;
+}
+
+void PairingPolicyTest::denyByDefaultTest()
+{
+    PairingPolicy policy;
+    QVERIFY(!policy.allowAll());
+
+    // Without allowed addresses, requests are rejected even with the PIN code set
+    m_policy->setAllowAll(false);
+    m_policy->setPinCode(QStringLiteral("0000"));
+    m_policy->setAgent(m_agent);
+
+    QDBusMessage reply = callAgent(QStringLiteral("RequestPinCode"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), rejectedError);
+    QCOMPARE(m_agent->requests, 0);
+}
+
+void PairingPolicyTest::allowedAddressesTest()
+{
+    m_policy->setAllowAll(false);
+    m_policy->setAllowedAddresses(QStringList() << QStringLiteral("40:79:6a:0c:39:75"));
+
+    // Allowed device is authorized, other devices are rejected
+    QDBusMessage reply = callAgent(QStringLiteral("RequestAuthorization"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+
+    reply = callAgent(QStringLiteral("RequestAuthorization"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device2Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), rejectedError);
+
+    // Just Works confirmation of allowed device
+    reply = callAgent(QStringLiteral("RequestConfirmation"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)) << quint32(123456));
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+
+    // With all devices allowed, only the listed devices are authorized without asking the agent
+    m_policy->setAllowAll(true);
+    reply = callAgent(QStringLiteral("RequestAuthorization"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device2Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), rejectedError);
+
+    m_policy->setAgent(m_agent);
+    reply = callAgent(QStringLiteral("RequestAuthorization"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device2Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(m_agent->requests, 1);
+}
+
+void PairingPolicyTest::passkeyTest()
+{
+    m_policy->setPasskeyFunction([](DevicePtr device) {
+        return device->address().startsWith(QLatin1String("40")) ? quint32(4079) : quint32(5079);
+    });
+
+    QDBusMessage reply = callAgent(QStringLiteral("RequestPasskey"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(reply.arguments().first().toUInt(), quint32(4079));
+
+    reply = callAgent(QStringLiteral("RequestPasskey"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device2Path)));
+    QCOMPARE(reply.arguments().first().toUInt(), quint32(5079));
+
+    // Confirmation only with matching passkey
+    reply = callAgent(QStringLiteral("RequestConfirmation"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)) << quint32(4079));
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+
+    reply = callAgent(QStringLiteral("RequestConfirmation"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)) << quint32(5079));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), rejectedError);
+}
+
+void PairingPolicyTest::pinCodeTest()
+{
+    m_policy->setPinCode(QStringLiteral("0000"));
+
+    QDBusMessage reply = callAgent(QStringLiteral("RequestPinCode"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(reply.arguments().first().toString(), QStringLiteral("0000"));
+}
+
+void PairingPolicyTest::servicesTest()
+{
+    m_policy->setAllowedServices(QStringList() << QStringLiteral("00001101-0000-1000-8000-00805f9b34fb"));
+
+    QDBusMessage reply = callAgent(QStringLiteral("AuthorizeService"), QVariantList()
+                                   << QVariant::fromValue(QDBusObjectPath(device1Path))
+                                   << QStringLiteral("00001101-0000-1000-8000-00805F9B34FB"));
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+
+    reply = callAgent(QStringLiteral("AuthorizeService"), QVariantList()
+                      << QVariant::fromValue(QDBusObjectPath(device1Path))
+                      << QStringLiteral("0000110a-0000-1000-8000-00805f9b34fb"));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), rejectedError);
+}
+
+void PairingPolicyTest::forwardTest()
+{
+    // Without agent, requests not covered by the policy are rejected
+    QDBusMessage reply = callAgent(QStringLiteral("RequestAuthorization"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+
+    m_policy->setAgent(m_agent);
+    QCOMPARE(m_policy->agent(), m_agent);
+
+    reply = callAgent(QStringLiteral("RequestAuthorization"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(m_agent->requests, 1);
+    QCOMPARE(m_policy->forwardedCount(), 1);
+}
+
+void PairingPolicyTest::timeoutTest()
+{
+    m_policy->setAgent(m_agent);
+    m_policy->setRequestTimeout(5000);
+    m_policy->setRequestTimeout(QStringLiteral("40:79:6A:0C:39:75"), 100);
+    m_agent->answer = false;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QDBusMessage reply = callAgent(QStringLiteral("RequestAuthorization"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), canceledError);
+    QVERIFY(timer.elapsed() < 5000);
+    QCOMPARE(m_agent->requests, 1);
+    QCOMPARE(m_policy->timedOutCount(), 1);
+}
+
+void PairingPolicyTest::statisticsTest()
+{
+    m_policy->setPasskey(123456);
+    m_policy->setAllowAll(false);
+    m_policy->setAllowedAddresses(QStringList() << QStringLiteral("40:79:6A:0C:39:75"));
+
+    callAgent(QStringLiteral("RequestPasskey"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    callAgent(QStringLiteral("RequestPasskey"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device1Path)));
+    callAgent(QStringLiteral("RequestPasskey"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device2Path)));
+
+    QCOMPARE(m_policy->acceptedCount(), 2);
+    QCOMPARE(m_policy->rejectedCount(), 1);
+    QCOMPARE(m_policy->forwardedCount(), 0);
+    QCOMPARE(m_policy->pairingRate(), 2.0);
+
+    m_policy->resetStatistics();
+    QCOMPARE(m_policy->acceptedCount(), 0);
+    QCOMPARE(m_policy->rejectedCount(), 0);
+    QCOMPARE(m_policy->pairingRate(), 0.0);
+}
+
+QDBusMessage PairingPolicyTest::callAgent(const QString &method, const QVariantList &args)
+{
+    QDBusMessage call = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(),
+                                                       m_policy->objectPath().path(),
+                                                       QStringLiteral("org.bluez.Agent1"),
+                                                       method);
+    call.setArguments(args);
+
+    QDBusPendingCall pending = m_connection.asyncCall(call);
+
+    QElapsedTimer timer;
+    timer.start();
+    while (!pending.isFinished() && timer.elapsed() < 10000) {
+        QTest::qWait(10);
+    }
+    return pending.reply();
+}
+
+QTEST_MAIN(PairingPolicyTest)
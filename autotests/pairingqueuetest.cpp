@@ -0,0 +1,324 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pairingqueuetest.h"
+#include "autotests.h"
+#include "adapter.h"
+#include "device.h"
+#include "pendingcall.h"
+#include "pairingjob.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString adapterPath = QStringLiteral("/org/bluez/hci0");
+
+// Devices 1-3 pair after 200 ms, device 4 fails pairing twice, device 5 always fails
+// and device 6 fails pairing once with InProgress
+static const QString device1Address = QStringLiteral("10:79:6A:0C:39:75");
+static const QString device2Address = QStringLiteral("20:79:6A:0C:39:75");
+static const QString device3Address = QStringLiteral("30:79:6A:0C:39:75");
+static const QString device4Address = QStringLiteral("40:79:6A:0C:39:75");
+static const QString device5Address = QStringLiteral("50:79:6A:0C:39:75");
+static const QString device6Address = QStringLiteral("60:79:6A:0C:39:75");
+
+PairingQueueTest::PairingQueueTest()
+    : m_manager(nullptr)
+    , m_pairingQueue(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void PairingQueueTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    const QStringList addresses = QStringList() << device1Address << device2Address << device3Address
+                                                << device4Address << device5Address << device6Address;
+    const QList<int> failures = QList<int>() << 0 << 0 << 0 << 2 << 100 << 1;
+
+    for (int i = 0; i < addresses.count(); ++i) {
+        QString path = addresses.at(i);
+        path.replace(QLatin1Char(':'), QLatin1Char('_'));
+
+        QVariantMap deviceProps;
+        deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath + QStringLiteral("/dev_") + path));
+        deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+        deviceProps[QStringLiteral("Address")] = addresses.at(i);
+        deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice%1").arg(i + 1);
+        deviceProps[QStringLiteral("PairDelay")] = 200;
+        deviceProps[QStringLiteral("PairFailures")] = failures.at(i);
+        if (addresses.at(i) == device6Address) {
+            deviceProps[QStringLiteral("PairError")] = QStringLiteral("org.bluez.Error.InProgress");
+        }
+        FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+    }
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+    QCOMPARE(m_manager->devices().count(), addresses.count());
+}
+
+void PairingQueueTest::cleanupTestCase()
+{
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void PairingQueueTest::init()
+{
+    m_pairingQueue = new PairingQueue();
+    m_pairingQueue->setInitialBackoff(10);
+    m_pairingQueue->setMaximumBackoff(40);
+}
+
+void PairingQueueTest::cleanup()
+{
+    QTRY_COMPARE(m_pairingQueue->pendingCount(), 0);
+
+    delete m_pairingQueue;
+    m_pairingQueue = nullptr;
+
+    Q_FOREACH (DevicePtr device, m_manager->devices()) {
+        if (device->isConnected()) {
+            device->disconnectFromDevice()->waitForFinished();
+            QTRY_VERIFY(!device->isConnected());
+        }
+        changeDeviceProperty(device, QStringLiteral("Paired"), false);
+        changeDeviceProperty(device, QStringLiteral("Trusted"), false);
+        QTRY_VERIFY(!device->isPaired());
+        QTRY_VERIFY(!device->isTrusted());
+    }
+}
+
+void PairingQueueTest::pairTest()
+{
+    AdapterPtr adapter = m_manager->adapterForUbi(adapterPath);
+    DevicePtr device1 = m_manager->deviceForAddress(device1Address);
+    DevicePtr device2 = m_manager->deviceForAddress(device2Address);
+
+    PairingJob *job = m_pairingQueue->pairDevices(QList<DevicePtr>() << device1 << device2);
+    job->setConnectAfterPairing(true);
+
+    int maxActive = 0;
+    connect(job, &PairingJob::progress, this, [this, adapter, &maxActive]() {
+        maxActive = qMax(maxActive, m_pairingQueue->activeCount(adapter));
+    });
+
+    QSignalSpy progressSpy(job, SIGNAL(progress(PairingJob*,int)));
+    QSignalSpy deviceSpy(job, SIGNAL(deviceFinished(PairingJob*,int)));
+    QSignalSpy resultSpy(job, SIGNAL(result(PairingJob*)));
+    job->start();
+
+    QTRY_COMPARE(m_pairingQueue->pendingCount(), 2);
+    QCOMPARE(m_pairingQueue->activeCount(adapter), 1);
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::NoError));
+    QCOMPARE(job->finishedCount(), 2);
+    QCOMPARE(job->failedCount(), 0);
+    QCOMPARE(job->percent(), 100);
+    QCOMPARE(job->itemStage(0), PairingJob::Done);
+    QCOMPARE(job->itemAttempts(0), 3);
+    QCOMPARE(maxActive, 1);
+
+    // Three steps for each device
+    QCOMPARE(progressSpy.count(), 6);
+    QCOMPARE(progressSpy.first().at(1).toInt(), 16);
+    QCOMPARE(progressSpy.last().at(1).toInt(), 100);
+    QCOMPARE(deviceSpy.count(), 2);
+
+    QTRY_VERIFY(device1->isPaired());
+    QTRY_VERIFY(device1->isTrusted());
+    QTRY_VERIFY(device1->isConnected());
+    QTRY_VERIFY(device2->isPaired());
+    QTRY_VERIFY(device2->isTrusted());
+    QTRY_VERIFY(device2->isConnected());
+}
+
+void PairingQueueTest::concurrencyTest()
+{
+    AdapterPtr adapter = m_manager->adapterForUbi(adapterPath);
+    m_pairingQueue->setMaxPairings(adapter, 2);
+    QCOMPARE(m_pairingQueue->maxPairings(adapter), 2);
+    QCOMPARE(m_pairingQueue->maxPairingsPerAdapter(), 1);
+
+    PairingJob *job = m_pairingQueue->pairDevices(QList<DevicePtr>()
+                                                  << m_manager->deviceForAddress(device1Address)
+                                                  << m_manager->deviceForAddress(device2Address)
+                                                  << m_manager->deviceForAddress(device3Address));
+
+    int maxActive = 0;
+    connect(job, &PairingJob::progress, this, [this, adapter, &maxActive]() {
+        maxActive = qMax(maxActive, m_pairingQueue->activeCount(adapter));
+    });
+
+    QSignalSpy resultSpy(job, SIGNAL(result(PairingJob*)));
+    job->start();
+
+    QTRY_COMPARE(m_pairingQueue->activeCount(adapter), 2);
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::NoError));
+    QCOMPARE(maxActive, 2);
+
+    m_pairingQueue->setMaxPairings(adapter, -1);
+    QCOMPARE(m_pairingQueue->maxPairings(adapter), 1);
+}
+
+void PairingQueueTest::retryTest()
+{
+    DevicePtr device = m_manager->deviceForAddress(device4Address);
+
+    PairingJob *job = m_pairingQueue->pairDevice(device);
+    QSignalSpy resultSpy(job, SIGNAL(result(PairingJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::NoError));
+    QCOMPARE(job->itemError(0), int(PendingCall::NoError));
+
+    // Two failed pairing attempts, successful one and trust
+    QCOMPARE(job->itemAttempts(0), 4);
+    QTRY_VERIFY(device->isPaired());
+    QTRY_VERIFY(device->isTrusted());
+}
+
+void PairingQueueTest::inProgressRetryTest()
+{
+    DevicePtr device = m_manager->deviceForAddress(device6Address);
+
+    PairingJob *job = m_pairingQueue->pairDevice(device);
+    QSignalSpy resultSpy(job, SIGNAL(result(PairingJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::NoError));
+    QCOMPARE(job->itemError(0), int(PendingCall::NoError));
+
+    // Pairing attempt failed with InProgress, successful one and trust
+    QCOMPARE(job->itemAttempts(0), 3);
+    QTRY_VERIFY(device->isPaired());
+}
+
+void PairingQueueTest::retryFailedTest()
+{
+    DevicePtr device = m_manager->deviceForAddress(device5Address);
+    m_pairingQueue->setMaxRetries(2);
+
+    PairingJob *job = m_pairingQueue->pairDevices(QList<DevicePtr>() << device << m_manager->deviceForAddress(device1Address));
+    job->setConnectAfterPairing(true);
+
+    QSignalSpy resultSpy(job, SIGNAL(result(PairingJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::UserDefinedError));
+    QCOMPARE(job->finishedCount(), 2);
+    QCOMPARE(job->failedCount(), 1);
+    QCOMPARE(job->percent(), 100);
+
+    QCOMPARE(job->itemStage(0), PairingJob::Pairing);
+    QCOMPARE(job->itemError(0), int(PendingCall::AuthenticationTimeout));
+    QVERIFY(!job->itemErrorText(0).isEmpty());
+    QCOMPARE(job->itemAttempts(0), 3);
+    QVERIFY(!device->isPaired());
+
+    QCOMPARE(job->itemStage(1), PairingJob::Done);
+    QCOMPARE(job->itemError(1), int(PendingCall::NoError));
+}
+
+void PairingQueueTest::alreadyPairedTest()
+{
+    DevicePtr device = m_manager->deviceForAddress(device1Address);
+    changeDeviceProperty(device, QStringLiteral("Paired"), true);
+    changeDeviceProperty(device, QStringLiteral("Trusted"), true);
+    QTRY_VERIFY(device->isPaired());
+    QTRY_VERIFY(device->isTrusted());
+
+    PairingJob *job = m_pairingQueue->pairDevice(device);
+    QSignalSpy resultSpy(job, SIGNAL(result(PairingJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::NoError));
+    QCOMPARE(job->itemAttempts(0), 0);
+    QCOMPARE(job->percent(), 100);
+}
+
+void PairingQueueTest::invalidDeviceTest()
+{
+    PairingJob *job = m_pairingQueue->pairDevices(QList<DevicePtr>() << DevicePtr());
+    QSignalSpy resultSpy(job, SIGNAL(result(PairingJob*)));
+    job->start();
+
+    QTRY_COMPARE(resultSpy.count(), 1);
+    QCOMPARE(job->error(), int(Job::UserDefinedError));
+    QCOMPARE(job->itemError(0), int(PendingCall::InvalidArguments));
+    QCOMPARE(job->percent(), 100);
+}
+
+void PairingQueueTest::killTest()
+{
+    AdapterPtr adapter = m_manager->adapterForUbi(adapterPath);
+
+    PairingJob *job = m_pairingQueue->pairDevices(QList<DevicePtr>()
+                                                  << m_manager->deviceForAddress(device1Address)
+                                                  << m_manager->deviceForAddress(device2Address));
+    QSignalSpy resultSpy(job, SIGNAL(result(PairingJob*)));
+    job->start();
+
+    QTRY_COMPARE(m_pairingQueue->activeCount(adapter), 1);
+    job->kill();
+
+    QTRY_COMPARE(m_pairingQueue->pendingCount(), 0);
+    QCOMPARE(m_pairingQueue->activeCount(adapter), 0);
+    QCOMPARE(resultSpy.count(), 0);
+}
+
+void PairingQueueTest::changeDeviceProperty(DevicePtr device, const QString &name, const QVariant &value)
+{
+    QVariantMap properties;
+    properties[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device->ubi()));
+    properties[QStringLiteral("Name")] = name;
+    properties[QStringLiteral("Value")] = value;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("change-device-property"), properties);
+}
+
+QTEST_MAIN(PairingQueueTest)
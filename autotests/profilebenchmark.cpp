@@ -0,0 +1,307 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profilebenchmark.h"
+#include "autotests.h"
+#include "profile.h"
+#include "profileconnection.h"
+#include "pendingcall.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QTimer>
+#include <QEventLoop>
+#include <QElapsedTimer>
+#include <QDBusUnixFileDescriptor>
+
+#include <algorithm>
+
+#include <string.h>
+#include <sys/resource.h>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+// Measures the data path of profile connections.
+//
+// Fake bluez creates socket pairs, passes one end to the profile with NewConnection
+// and sends back all data received on the other end. Each connection keeps a window
+// of timestamped messages in flight, the round-trip time of every message is recorded.
+//
+// The benchmark is not run by ctest, run the profilebenchmark binary manually.
+// The amount of data for each run can be set with BLUEZQT_BENCHMARK_MBYTES (default 16).
+
+static const QString adapterPath = QStringLiteral("/org/bluez/hci0");
+static const QString devicePath = adapterPath + QStringLiteral("/dev_40_79_6A_0C_39_75");
+
+static const int MessageSize = 256;
+static const int Window = 8;
+
+Q_DECLARE_METATYPE(ProfileConnection::Backend)
+
+class BenchmarkProfile : public Profile
+{
+public:
+    explicit BenchmarkProfile(QObject *parent)
+        : Profile(parent)
+        , backend(ProfileConnection::NotifierBackend)
+    {
+        setName(QStringLiteral("Benchmark"));
+        setChannel(0);
+    }
+
+    QDBusObjectPath objectPath() const override
+    {
+        return QDBusObjectPath(QStringLiteral("/BenchmarkProfile"));
+    }
+
+    QString uuid() const override
+    {
+        return QStringLiteral("00001101-0000-1000-8000-00805f9b34fb");
+    }
+
+    void newConnection(DevicePtr device, const QDBusUnixFileDescriptor &fd, const QVariantMap &properties, const Request<> &request) override
+    {
+        Q_UNUSED(device)
+        Q_UNUSED(properties)
+
+        ProfileConnection *connection = new ProfileConnection(fd);
+        if (!connection->isOpen() || !connection->setBackend(backend)) {
+            delete connection;
+            request.cancel();
+            return;
+        }
+
+        connections.append(connection);
+        request.accept();
+    }
+
+    ProfileConnection::Backend backend;
+    QList<ProfileConnection*> connections;
+};
+
+struct Stream
+{
+    ProfileConnection *connection;
+    QByteArray received;
+    int sent;
+    int completed;
+};
+
+static qint64 cpuTime()
+{
+    struct rusage usage;
+    ::getrusage(RUSAGE_SELF, &usage);
+    return (qint64(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000000000
+           + (qint64(usage.ru_utime.tv_usec) + usage.ru_stime.tv_usec) * 1000;
+}
+
+static qint64 percentile(const QVector<qint64> &sorted, int percent)
+{
+    if (sorted.isEmpty()) {
+        return 0;
+    }
+    return sorted.at(qMin(sorted.size() - 1, sorted.size() * percent / 100));
+}
+
+ProfileBenchmark::ProfileBenchmark()
+    : m_manager(nullptr)
+    , m_profile(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void ProfileBenchmark::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    // Create adapter
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    // Create device
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(devicePath));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+
+    m_profile = new BenchmarkProfile(this);
+    PendingCall *call = m_manager->registerProfile(m_profile);
+    call->waitForFinished();
+    QVERIFY(!call->error());
+}
+
+void ProfileBenchmark::cleanupTestCase()
+{
+    m_manager->unregisterProfile(m_profile)->waitForFinished();
+    delete m_profile;
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void ProfileBenchmark::echoBenchmark_data()
+{
+    QTest::addColumn<ProfileConnection::Backend>("backend");
+    QTest::addColumn<int>("count");
+
+    const QList<int> counts = QList<int>() << 1 << 16 << 128;
+
+    Q_FOREACH (int count, counts) {
+        QTest::newRow(qPrintable(QStringLiteral("notifier-%1").arg(count))) << ProfileConnection::NotifierBackend << count;
+    }
+    Q_FOREACH (int count, counts) {
+        QTest::newRow(qPrintable(QStringLiteral("io_uring-%1").arg(count))) << ProfileConnection::IoUringBackend << count;
+    }
+}
+
+void ProfileBenchmark::echoBenchmark()
+{
+    QFETCH(ProfileConnection::Backend, backend);
+    QFETCH(int, count);
+
+    if (backend == ProfileConnection::IoUringBackend && !ProfileConnection::isIoUringSupported()) {
+        QSKIP("io_uring is not supported");
+    }
+
+    bool ok;
+    qint64 totalBytes = qgetenv("BLUEZQT_BENCHMARK_MBYTES").toLongLong(&ok) * 1024 * 1024;
+    if (!ok || totalBytes <= 0) {
+        totalBytes = 16 * 1024 * 1024;
+    }
+    const int messages = int(qMax(qint64(Window), totalBytes / MessageSize / count));
+
+    // Create connections
+    m_profile->backend = backend;
+
+    QVariantMap props;
+    props[QStringLiteral("Device")] = QVariant::fromValue(QDBusObjectPath(devicePath));
+    props[QStringLiteral("Count")] = count;
+    FakeBluez::runAction(QStringLiteral("profilemanager"), QStringLiteral("create-connections"), props);
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_profile->connections.count(), count, 10000);
+
+    QElapsedTimer clock;
+    QEventLoop loop;
+    QVector<Stream> streams(count);
+    QVector<qint64> latencies;
+    latencies.reserve(messages * count);
+    int finished = 0;
+
+    auto sendMessage = [&clock](Stream &stream) {
+        QByteArray message(MessageSize, 'x');
+        const qint64 timestamp = clock.nsecsElapsed();
+        memcpy(message.data(), &timestamp, sizeof(timestamp));
+        stream.connection->write(message);
+        stream.sent++;
+    };
+
+    for (int i = 0; i < count; ++i) {
+        Stream &stream = streams[i];
+        stream.connection = m_profile->connections.at(i);
+        stream.sent = 0;
+        stream.completed = 0;
+
+        connect(stream.connection, &ProfileConnection::readyRead, &loop, [&, i]() {
+            Stream &stream = streams[i];
+            char buffer[65536];
+            qint64 size;
+
+            while ((size = stream.connection->read(buffer, sizeof(buffer))) > 0) {
+                stream.received.append(buffer, int(size));
+            }
+
+            const qint64 now = clock.nsecsElapsed();
+            int offset = 0;
+
+            while (stream.received.size() - offset >= MessageSize) {
+                qint64 timestamp;
+                memcpy(&timestamp, stream.received.constData() + offset, sizeof(timestamp));
+                latencies.append(now - timestamp);
+                offset += MessageSize;
+
+                if (++stream.completed == messages && ++finished == count) {
+                    loop.quit();
+                }
+                if (stream.sent < messages) {
+                    sendMessage(stream);
+                }
+            }
+
+            stream.received.remove(0, offset);
+        });
+        connect(stream.connection, &ProfileConnection::disconnected, &loop, &QEventLoop::quit);
+    }
+
+    // Run
+    const qint64 cpuStart = cpuTime();
+    clock.start();
+
+    for (int i = 0; i < count; ++i) {
+        for (int j = 0; j < Window; ++j) {
+            sendMessage(streams[i]);
+        }
+    }
+
+    QTimer::singleShot(120000, &loop, &QEventLoop::quit);
+    loop.exec();
+
+    const qint64 elapsed = clock.nsecsElapsed();
+    const qint64 cpu = cpuTime() - cpuStart;
+
+    QCOMPARE(finished, count);
+
+    // Results
+    const qint64 bytes = qint64(messages) * count * MessageSize;
+    std::sort(latencies.begin(), latencies.end());
+
+    QTest::setBenchmarkResult(qreal(bytes) * 1000000000 / elapsed, QTest::BytesPerSecond);
+
+    qDebug("%d connections: %.1f MB/s, latency p50 %lld us, p90 %lld us, p99 %lld us, max %lld us, CPU %.2f ns/byte",
+           count,
+           double(bytes) * 1000 / elapsed,
+           percentile(latencies, 50) / 1000,
+           percentile(latencies, 90) / 1000,
+           percentile(latencies, 99) / 1000,
+           latencies.isEmpty() ? 0 : latencies.last() / 1000,
+           double(cpu) / (2 * bytes));
+
+    qDeleteAll(m_profile->connections);
+    m_profile->connections.clear();
+}
+
+QTEST_MAIN(ProfileBenchmark)
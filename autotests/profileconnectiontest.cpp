@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profileconnectiontest.h"
+#include "profileconnection.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+#include <QScopedPointer>
+#include <QDBusUnixFileDescriptor>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace BluezQt;
+
+Q_DECLARE_METATYPE(ProfileConnection::Backend)
+
+// Creates a connection for one end of a socket pair, returns the other end
+static int createConnection(int type, ProfileConnection **connection)
+{
+    QFETCH_GLOBAL(ProfileConnection::Backend, backend);
+
+    int fds[2];
+    if (::socketpair(AF_UNIX, type | SOCK_CLOEXEC, 0, fds) < 0) {
+        return -1;
+    }
+
+    *connection = new ProfileConnection(QDBusUnixFileDescriptor(fds[0]));
+    ::close(fds[0]);
+
+    if (!(*connection)->setBackend(backend)) {
+        delete *connection;
+        ::close(fds[1]);
+        return -1;
+    }
+    return fds[1];
+}
+
+static QByteArray readPeer(int fd, int size)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    const ssize_t ret = ::recv(fd, data.data(), size, MSG_DONTWAIT);
+    data.resize(ret > 0 ? int(ret) : 0);
+    return data;
+}
+
+void ProfileConnectionTest::initTestCase_data()
+{
+    QTest::addColumn<ProfileConnection::Backend>("backend");
+
+    QTest::newRow("notifier") << ProfileConnection::NotifierBackend;
+    QTest::newRow("io_uring") << ProfileConnection::IoUringBackend;
+}
+
+void ProfileConnectionTest::init()
+{
+    QFETCH_GLOBAL(ProfileConnection::Backend, backend);
+
+    if (backend == ProfileConnection::IoUringBackend && !ProfileConnection::isIoUringSupported()) {
+        QSKIP("io_uring is not supported");
+    }
+}
+
+void ProfileConnectionTest::readWriteTest()
+{
+    ProfileConnection *connection;
+    const int peer = createConnection(SOCK_STREAM, &connection);
+    QVERIFY(peer >= 0);
+    QVERIFY(connection->isOpen());
+    QVERIFY(!connection->isPacketBased());
+
+    // Write
+    QCOMPARE(connection->write(QByteArrayLiteral("test-data")), qint64(9));
+    QTRY_COMPARE(connection->bytesToWrite(), qint64(0));
+    QCOMPARE(readPeer(peer, 64), QByteArrayLiteral("test-data"));
+
+    // Read
+    char buffer[64];
+    QCOMPARE(connection->read(buffer, sizeof(buffer)), qint64(0));
+
+    QSignalSpy readyReadSpy(connection, SIGNAL(readyRead()));
+    QCOMPARE(::write(peer, "reply", 5), ssize_t(5));
+    QTRY_COMPARE(readyReadSpy.count(), 1);
+
+    QCOMPARE(connection->read(buffer, sizeof(buffer)), qint64(5));
+    QCOMPARE(QByteArray(buffer, 5), QByteArrayLiteral("reply"));
+    QCOMPARE(connection->read(buffer, sizeof(buffer)), qint64(0));
+
+    delete connection;
+    ::close(peer);
+}
+
+void ProfileConnectionTest::scatterGatherTest()
+{
+    ProfileConnection *connection;
+    const int peer = createConnection(SOCK_STREAM, &connection);
+    QVERIFY(peer >= 0);
+
+    QList<QByteArray> buffers;
+    buffers << QByteArrayLiteral("header:") << QByteArray() << QByteArrayLiteral("payload");
+
+    QCOMPARE(connection->write(buffers), qint64(14));
+    QTRY_COMPARE(connection->bytesToWrite(), qint64(0));
+    QCOMPARE(readPeer(peer, 64), QByteArrayLiteral("header:payload"));
+
+    delete connection;
+    ::close(peer);
+}
+
+void ProfileConnectionTest::packetBoundariesTest()
+{
+    ProfileConnection *connection;
+    const int peer = createConnection(SOCK_SEQPACKET, &connection);
+    QVERIFY(peer >= 0);
+    QVERIFY(connection->isPacketBased());
+
+    // Each write() is sent as one packet
+    connection->write(QList<QByteArray>() << QByteArrayLiteral("ab") << QByteArrayLiteral("cd"));
+    connection->write(QByteArrayLiteral("ef"));
+    QTRY_COMPARE(connection->bytesToWrite(), qint64(0));
+
+    QCOMPARE(readPeer(peer, 64), QByteArrayLiteral("abcd"));
+    QCOMPARE(readPeer(peer, 64), QByteArrayLiteral("ef"));
+
+    // Packet with more buffers than one writev() takes is not split
+    QList<QByteArray> buffers;
+    for (int i = 0; i < 100; ++i) {
+        buffers << QByteArray(1, char('a' + i % 26));
+    }
+    QCOMPARE(connection->write(buffers), qint64(100));
+    connection->write(QByteArrayLiteral("gh"));
+    QTRY_COMPARE(connection->bytesToWrite(), qint64(0));
+
+    QCOMPARE(readPeer(peer, 256).size(), 100);
+    QCOMPARE(readPeer(peer, 256), QByteArrayLiteral("gh"));
+
+    delete connection;
+    ::close(peer);
+}
+
+void ProfileConnectionTest::watermarkTest()
+{
+    ProfileConnection *connection;
+    const int peer = createConnection(SOCK_STREAM, &connection);
+    QVERIFY(peer >= 0);
+
+    int size = 4096;
+    ::setsockopt(connection->socketDescriptor(), SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+    ::setsockopt(peer, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+
+    connection->setHighWatermark(32 * 1024);
+    connection->setLowWatermark(8 * 1024);
+
+    QSignalSpy highSpy(connection, SIGNAL(highWatermarkReached()));
+    QSignalSpy lowSpy(connection, SIGNAL(lowWatermarkReached()));
+    QSignalSpy bytesWrittenSpy(connection, SIGNAL(bytesWritten(qint64)));
+
+    // The peer does not read, so data are queued
+    const QByteArray chunk(1024, 'x');
+    qint64 total = 0;
+    while (highSpy.isEmpty() && total < 1024 * 1024) {
+        connection->write(chunk);
+        total += chunk.size();
+    }
+
+    QCOMPARE(highSpy.count(), 1);
+    QVERIFY(connection->bytesToWrite() >= connection->highWatermark());
+    QCOMPARE(lowSpy.count(), 0);
+
+    // Drain the peer until the queue is flushed
+    qint64 received = 0;
+    QTRY_VERIFY_WITH_TIMEOUT((received += readPeer(peer, 64 * 1024).size(), received == total), 5000);
+
+    QCOMPARE(connection->bytesToWrite(), qint64(0));
+    QCOMPARE(highSpy.count(), 1);
+    QCOMPARE(lowSpy.count(), 1);
+    QVERIFY(bytesWrittenSpy.count() > 0);
+
+    delete connection;
+    ::close(peer);
+}
+
+void ProfileConnectionTest::disconnectTest()
+{
+    // Connections are deleted also when a check fails
+    ProfileConnection *connection;
+    const int peer = createConnection(SOCK_STREAM, &connection);
+    QVERIFY(peer >= 0);
+    QScopedPointer<ProfileConnection> connection1(connection);
+
+    QSignalSpy disconnectedSpy(connection1.data(), SIGNAL(disconnected()));
+    ::close(peer);
+
+    QTRY_COMPARE(disconnectedSpy.count(), 1);
+    QVERIFY(!connection1->isOpen());
+
+    char buffer[16];
+    QCOMPARE(connection1->read(buffer, sizeof(buffer)), qint64(-1));
+    QCOMPARE(connection1->write(QByteArrayLiteral("data")), qint64(-1));
+
+    // Closing explicitly does not emit disconnected()
+    const int peer2 = createConnection(SOCK_STREAM, &connection);
+    QVERIFY(peer2 >= 0);
+    QScopedPointer<ProfileConnection> connection2(connection);
+
+    QSignalSpy disconnectedSpy2(connection2.data(), SIGNAL(disconnected()));
+    connection2->close();
+    ::close(peer2);
+    QVERIFY(!connection2->isOpen());
+    QCOMPARE(disconnectedSpy2.count(), 0);
+}
+
+void ProfileConnectionTest::writeFailureTest()
+{
+    ProfileConnection *connection;
+    const int peer = createConnection(SOCK_STREAM, &connection);
+    QVERIFY(peer >= 0);
+    QScopedPointer<ProfileConnection> guard(connection);
+
+    // Slot may delete the connection
+    QSignalSpy disconnectedSpy(connection, SIGNAL(disconnected()));
+    connect(connection, &ProfileConnection::disconnected, this, [&guard]() {
+        guard.reset();
+    });
+
+    ::close(peer);
+
+    const bool notifier = connection->backend() == ProfileConnection::NotifierBackend;
+    const qint64 ret = connection->write(QByteArrayLiteral("data"));
+
+    // Failed write is reported by write(), disconnected() is emitted later
+    if (notifier) {
+        QCOMPARE(ret, qint64(-1));
+        QVERIFY(!connection->isOpen());
+    }
+    QCOMPARE(disconnectedSpy.count(), 0);
+
+    QTRY_VERIFY(!guard);
+    QCOMPARE(disconnectedSpy.count(), 1);
+}
+
+void ProfileConnectionTest::statisticsTest()
+{
+    ProfileConnection *connection;
+    const int peer = createConnection(SOCK_STREAM, &connection);
+    QVERIFY(peer >= 0);
+
+    connection->write(QByteArray(100, 'a'));
+    connection->write(QByteArray(50, 'b'));
+    QTRY_COMPARE(connection->totalBytesWritten(), qint64(150));
+    QVERIFY(connection->averageWriteLatency() >= 0);
+    QVERIFY(connection->maximumWriteLatency() >= connection->averageWriteLatency());
+
+    QSignalSpy readyReadSpy(connection, SIGNAL(readyRead()));
+    QCOMPARE(::write(peer, "1234", 4), ssize_t(4));
+    QTRY_COMPARE(readyReadSpy.count(), 1);
+
+    char buffer[16];
+    QCOMPARE(connection->read(buffer, sizeof(buffer)), qint64(4));
+    QCOMPARE(connection->totalBytesRead(), qint64(4));
+
+    connection->resetStatistics();
+    QCOMPARE(connection->totalBytesWritten(), qint64(0));
+    QCOMPARE(connection->totalBytesRead(), qint64(0));
+    QCOMPARE(connection->averageWriteLatency(), qint64(0));
+    QCOMPARE(connection->maximumWriteLatency(), qint64(0));
+
+    delete connection;
+    ::close(peer);
+}
+
+QTEST_MAIN(ProfileConnectionTest)
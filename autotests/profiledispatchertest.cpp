@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profiledispatchertest.h"
+#include "autotests.h"
+#include "profile.h"
+#include "profiledispatcher.h"
+#include "pendingcall.h"
+#include "device.h"
+#include "initmanagerjob.h"
+
+#include <QThread>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <QtTest/QTest>
+#include <QDBusPendingCall>
+#include <QDBusUnixFileDescriptor>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString adapterPath = QStringLiteral("/org/bluez/hci0");
+static const QString device1Path = adapterPath + QStringLiteral("/dev_40_79_6A_0C_39_75");
+static const QString device2Path = adapterPath + QStringLiteral("/dev_50_79_6A_0C_39_75");
+
+class TestProfile : public Profile
+{
+public:
+    explicit TestProfile(QObject *parent)
+        : Profile(parent)
+    {
+    }
+
+    QDBusObjectPath objectPath() const override
+    {
+        return QDBusObjectPath(QStringLiteral("/TestProfile"));
+    }
+
+    QString uuid() const override
+    {
+        return QStringLiteral("00001101-0000-1000-8000-00805f9b34fb");
+    }
+
+    void newConnection(DevicePtr device, const QDBusUnixFileDescriptor &fd, const QVariantMap &properties, const Request<> &request) override
+    {
+        Q_UNUSED(device)
+        Q_UNUSED(fd)
+        Q_UNUSED(properties)
+
+        QMutexLocker locker(&mutex);
+        threads.append(QThread::currentThread());
+        request.accept();
+    }
+
+    void requestDisconnection(DevicePtr device, const Request<> &request) override
+    {
+        Q_UNUSED(device)
+
+        QMutexLocker locker(&mutex);
+        threads.append(QThread::currentThread());
+        request.accept();
+    }
+
+    QThread *lastThread()
+    {
+        QMutexLocker locker(&mutex);
+        return threads.isEmpty() ? nullptr : threads.last();
+    }
+
+    QMutex mutex;
+    QList<QThread*> threads;
+};
+
+ProfileDispatcherTest::ProfileDispatcherTest()
+    : m_manager(nullptr)
+    , m_dispatcher(nullptr)
+    , m_profile(nullptr)
+    , m_connection(QDBusConnection::connectToBus(QDBusConnection::SessionBus, QStringLiteral("profiledispatchertest")))
+{
+    Autotests::registerMetatypes();
+}
+
+void ProfileDispatcherTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    // Create adapter
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    // Create devices
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device1Path));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device2Path));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("50:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice2");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+    QCOMPARE(m_manager->devices().count(), 2);
+
+    m_dispatcher = new ProfileDispatcher(2);
+    QCOMPARE(m_dispatcher->threadCount(), 2);
+    QCOMPARE(m_dispatcher->policy(), ProfileDispatcher::RoundRobin);
+
+    m_profile = new TestProfile(this);
+    m_profile->setDispatcher(m_dispatcher);
+    QCOMPARE(m_profile->dispatcher(), m_dispatcher);
+
+    PendingCall *call = m_manager->registerProfile(m_profile);
+    call->waitForFinished();
+    QVERIFY(!call->error());
+}
+
+void ProfileDispatcherTest::cleanupTestCase()
+{
+    m_manager->unregisterProfile(m_profile)->waitForFinished();
+    delete m_dispatcher;
+    delete m_profile;
+    delete m_manager;
+
+    QDBusConnection::disconnectFromBus(QStringLiteral("profiledispatchertest"));
+
+    FakeBluez::stop();
+}
+
+void ProfileDispatcherTest::roundRobinTest()
+{
+    m_dispatcher->setPolicy(ProfileDispatcher::RoundRobin);
+
+    // Connections are handled in worker threads, in turns
+    QCOMPARE(newConnection(device1Path).type(), QDBusMessage::ReplyMessage);
+    QThread *thread1 = m_profile->lastThread();
+    QCOMPARE(newConnection(device2Path).type(), QDBusMessage::ReplyMessage);
+    QThread *thread2 = m_profile->lastThread();
+
+    QVERIFY(thread1 != QThread::currentThread());
+    QVERIFY(thread2 != QThread::currentThread());
+    QVERIFY(thread1 != thread2);
+    QVERIFY(thread1 == m_dispatcher->workerThread(0) || thread1 == m_dispatcher->workerThread(1));
+    QCOMPARE(m_dispatcher->connectionCount(0), 1);
+    QCOMPARE(m_dispatcher->connectionCount(1), 1);
+
+    QCOMPARE(requestDisconnection(device1Path).type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(requestDisconnection(device2Path).type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(m_dispatcher->connectionCount(0), 0);
+    QCOMPARE(m_dispatcher->connectionCount(1), 0);
+}
+
+void ProfileDispatcherTest::deviceAffinityTest()
+{
+    m_dispatcher->setPolicy(ProfileDispatcher::DeviceAffinity);
+
+    // Connections from the same device always use the same thread
+    QCOMPARE(newConnection(device1Path).type(), QDBusMessage::ReplyMessage);
+    QThread *thread = m_profile->lastThread();
+    QCOMPARE(requestDisconnection(device1Path).type(), QDBusMessage::ReplyMessage);
+
+    for (int i = 0; i < 5; ++i) {
+        QCOMPARE(newConnection(device1Path).type(), QDBusMessage::ReplyMessage);
+        QCOMPARE(m_profile->lastThread(), thread);
+        QCOMPARE(requestDisconnection(device1Path).type(), QDBusMessage::ReplyMessage);
+        QCOMPARE(m_profile->lastThread(), thread);
+    }
+}
+
+void ProfileDispatcherTest::disconnectionTest()
+{
+    m_dispatcher->setPolicy(ProfileDispatcher::RoundRobin);
+
+    // Disconnection is handled in the thread of the connection
+    QCOMPARE(newConnection(device1Path).type(), QDBusMessage::ReplyMessage);
+    QThread *thread = m_profile->lastThread();
+    QCOMPARE(newConnection(device2Path).type(), QDBusMessage::ReplyMessage);
+
+    QCOMPARE(requestDisconnection(device1Path).type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(m_profile->lastThread(), thread);
+    QCOMPARE(requestDisconnection(device2Path).type(), QDBusMessage::ReplyMessage);
+
+    // Unknown device is canceled in the thread of Manager
+    QDBusMessage reply = newConnection(adapterPath + QStringLiteral("/dev_60_79_6A_0C_39_75"));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), QStringLiteral("org.bluez.Profile1.Canceled"));
+}
+
+void ProfileDispatcherTest::remoteDisconnectTest()
+{
+    m_dispatcher->setPolicy(ProfileDispatcher::RoundRobin);
+
+    DevicePtr device = m_manager->deviceForUbi(device1Path);
+    changeDeviceProperty(device, QStringLiteral("Connected"), true);
+    QTRY_VERIFY(device->isConnected());
+
+    QCOMPARE(newConnection(device1Path).type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(newConnection(device1Path).type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(m_dispatcher->connectionCount(0) + m_dispatcher->connectionCount(1), 2);
+
+    // Link dropped by the remote side, without any request for disconnection
+    changeDeviceProperty(device, QStringLiteral("Connected"), false);
+    QTRY_COMPARE(m_dispatcher->connectionCount(0) + m_dispatcher->connectionCount(1), 0);
+
+    // Released device is counted again when it reconnects
+    changeDeviceProperty(device, QStringLiteral("Connected"), true);
+    QTRY_VERIFY(device->isConnected());
+    QCOMPARE(newConnection(device1Path).type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(m_dispatcher->connectionCount(0) + m_dispatcher->connectionCount(1), 1);
+
+    changeDeviceProperty(device, QStringLiteral("Connected"), false);
+    QTRY_COMPARE(m_dispatcher->connectionCount(0) + m_dispatcher->connectionCount(1), 0);
+}
+
+void ProfileDispatcherTest::changeDeviceProperty(DevicePtr device, const QString &name, const QVariant &value)
+{
+    QVariantMap properties;
+    properties[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device->ubi()));
+    properties[QStringLiteral("Name")] = name;
+    properties[QStringLiteral("Value")] = value;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("change-device-property"), properties);
+}
+
+QDBusMessage ProfileDispatcherTest::newConnection(const QString &device)
+{
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0) {
+        return QDBusMessage();
+    }
+
+    const QDBusMessage &reply = callProfile(QStringLiteral("NewConnection"), QVariantList()
+                                            << QVariant::fromValue(QDBusObjectPath(device))
+                                            << QVariant::fromValue(QDBusUnixFileDescriptor(fds[0]))
+                                            << QVariantMap());
+    ::close(fds[0]);
+    ::close(fds[1]);
+    return reply;
+}
+
+QDBusMessage ProfileDispatcherTest::requestDisconnection(const QString &device)
+{
+    return callProfile(QStringLiteral("RequestDisconnection"), QVariantList() << QVariant::fromValue(QDBusObjectPath(device)));
+}
+
+QDBusMessage ProfileDispatcherTest::callProfile(const QString &method, const QVariantList &args)
+{
+    // Called through a separate connection, so the reply is sent back from the worker thread
+    QDBusMessage call = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(),
+                                                       m_profile->objectPath().path(),
+                                                       QStringLiteral("org.bluez.Profile1"),
+                                                       method);
+    call.setArguments(args);
+
+    QDBusPendingCall pending = m_connection.asyncCall(call);
+    QElapsedTimer timer;
+    timer.start();
+    while (!pending.isFinished() && timer.elapsed() < 5000) {
+        QTest::qWait(10);
+    }
+    return pending.reply();
+}
+
+QTEST_MAIN(ProfileDispatcherTest)
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+import QtTest 1.0
+import QtQuick 2.2
+import org.kde.bluezqt.fakebluez 1.0
+import org.kde.bluezqt 1.0 as BluezQt
+
+TestCase {
+    name: "Benchmark"
+    property QtObject manager : BluezQt.Manager;
+    // Set BLUEZQT_BENCHMARK_DEVICES environment variable (eg. to 5000) for real measurements
+    property int devicesCount : FakeBluez.benchmarkDevicesCount();
+    width: 400
+    height: 400
+
+    ListView {
+        id: devicesView
+        anchors.fill: parent
+        model: BluezQt.DevicesModel { }
+        delegate: Text {
+            height: 20
+            text: "%1 %2 %3 %4 %5".arg(FriendlyName).arg(Address).arg(Type).arg(Rssi).arg(AdapterName)
+            font.bold: Connected || Paired
+        }
+    }
+
+    function initTestCase()
+    {
+        FakeBluez.start();
+        FakeBluez.runTest("bluez-standard");
+
+        var adapter1path = "/org/bluez/hci0";
+        var adapter1props = {
+            Path: adapter1path,
+            Address: "1C:E5:C3:BC:94:7E",
+            Name: "TestAdapter",
+            _toDBusObjectPath: [ "Path" ]
+        }
+        FakeBluez.runAction("devicemanager", "create-adapter", adapter1props);
+
+        var devicesProps = {
+            Adapter: adapter1path,
+            Count: devicesCount,
+            _toDBusObjectPath: [ "Adapter" ]
+        }
+        FakeBluez.runAction("devicemanager", "create-devices", devicesProps);
+
+        tryCompare(manager, "operational", true);
+        tryCompare(manager.devices, "length", devicesCount, 60000);
+        tryCompare(devicesView, "count", devicesCount);
+    }
+
+    function cleanupTestCase()
+    {
+        FakeBluez.stop();
+    }
+
+    function benchmark_iterateManagerDevices()
+    {
+        var devices = manager.devices;
+        var count = 0;
+        for (var i = 0; i < devices.length; ++i) {
+            if (devices[i].ubi) {
+                count++;
+            }
+        }
+        compare(count, devicesCount);
+    }
+
+    function benchmark_iterateAdapterDevices()
+    {
+        var devices = manager.adapters[0].devices;
+        var count = 0;
+        for (var i = 0; i < devices.length; ++i) {
+            if (devices[i].ubi) {
+                count++;
+            }
+        }
+        compare(count, devicesCount);
+    }
+
+    function benchmark_scrollDevicesModel()
+    {
+        for (var y = 0; y < devicesView.contentHeight; y += devicesView.height) {
+            devicesView.contentY = y;
+            devicesView.forceLayout();
+        }
+        devicesView.contentY = 0;
+    }
+}
@@ -78,6 +78,14 @@ public Q_SLOTS:
         processProperties(properties);
         FakeBluez::runAction(object, actionName, properties);
     }
+
+    // Small by default so the benchmark is quick when run by ctest
+    int benchmarkDevicesCount()
+    {
+        bool ok;
+        const int count = qEnvironmentVariableIntValue("BLUEZQT_BENCHMARK_DEVICES", &ok);
+        return ok && count > 0 ? count : 100;
+    }
 };
 
 static QObject *fakebluez_singleton(QQmlEngine *engine, QJSEngine *scriptEngine)
@@ -0,0 +1,265 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "reconnectsupervisortest.h"
+#include "autotests.h"
+#include "device.h"
+#include "pendingcall.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const int DevicesCount = 4;
+
+ReconnectSupervisorTest::ReconnectSupervisorTest()
+    : m_manager(nullptr)
+    , m_supervisor(nullptr)
+{
+    Autotests::registerMetatypes();
+}
+
+void ReconnectSupervisorTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    for (int i = 0; i < DevicesCount; ++i) {
+        const QString address = QStringLiteral("40:79:6A:0C:39:7%1").arg(i);
+        QString path = QStringLiteral("/org/bluez/hci0/dev_") + address;
+        path.replace(QLatin1Char(':'), QLatin1Char('_'));
+
+        QVariantMap deviceProps;
+        deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(path));
+        deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+        deviceProps[QStringLiteral("Address")] = address;
+        deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice%1").arg(i);
+        deviceProps[QStringLiteral("Trusted")] = true;
+        deviceProps[QStringLiteral("UUIDs")] = QStringList();
+        FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+    }
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+    QCOMPARE(m_manager->devices().count(), DevicesCount);
+}
+
+void ReconnectSupervisorTest::cleanupTestCase()
+{
+    delete m_manager;
+
+    FakeBluez::stop();
+}
+
+void ReconnectSupervisorTest::init()
+{
+    m_supervisor = new ReconnectSupervisor();
+    m_supervisor->setInitialBackoff(50);
+    m_supervisor->setMaximumBackoff(200);
+}
+
+void ReconnectSupervisorTest::cleanup()
+{
+    QTRY_COMPARE(m_supervisor->inFlightCount(), 0);
+
+    delete m_supervisor;
+    m_supervisor = nullptr;
+
+    Q_FOREACH (DevicePtr device, m_manager->devices()) {
+        device->setTrusted(true)->waitForFinished();
+        if (device->isConnected()) {
+            disconnectDevice(device);
+        }
+    }
+}
+
+void ReconnectSupervisorTest::disconnectDevice(DevicePtr device)
+{
+    // Simulates link loss
+    QVariantMap props;
+    props[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(device->ubi()));
+    props[QStringLiteral("Name")] = QStringLiteral("Connected");
+    props[QStringLiteral("Value")] = false;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("change-device-property"), props);
+
+    QTRY_VERIFY(!device->isConnected());
+}
+
+void ReconnectSupervisorTest::addDeviceTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    QVERIFY(!device->isConnected());
+
+    QSignalSpy reconnectedSpy(m_supervisor, SIGNAL(reconnected(DevicePtr)));
+
+    m_supervisor->addDevice(device);
+    QVERIFY(m_supervisor->contains(device));
+    QCOMPARE(m_supervisor->devices().count(), 1);
+
+    // Device that is not connected is connected right away
+    QTRY_COMPARE(reconnectedSpy.count(), 1);
+    QTRY_VERIFY(device->isConnected());
+}
+
+void ReconnectSupervisorTest::linkLossTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    QSignalSpy reconnectingSpy(m_supervisor, SIGNAL(reconnecting(DevicePtr,int)));
+
+    m_supervisor->addDevice(device);
+    QTRY_VERIFY(device->isConnected());
+    QTRY_COMPARE(m_supervisor->inFlightCount(), 0);
+
+    reconnectingSpy.clear();
+    disconnectDevice(device);
+
+    QTRY_VERIFY(device->isConnected());
+    QCOMPARE(reconnectingSpy.count(), 1);
+    QCOMPARE(reconnectingSpy.first().at(1).toInt(), 1);
+}
+
+void ReconnectSupervisorTest::trustedOnlyTest()
+{
+    DevicePtr device = m_manager->devices().first();
+    device->setTrusted(false)->waitForFinished();
+    QTRY_VERIFY(!device->isTrusted());
+
+    QSignalSpy reconnectingSpy(m_supervisor, SIGNAL(reconnecting(DevicePtr,int)));
+
+    m_supervisor->addDevice(device);
+    QTest::qWait(50);
+    QCOMPARE(reconnectingSpy.count(), 0);
+    QVERIFY(!device->isConnected());
+
+    m_supervisor->removeDevice(device);
+    m_supervisor->setTrustedOnly(false);
+    m_supervisor->addDevice(device);
+
+    QTRY_VERIFY(device->isConnected());
+    QCOMPARE(reconnectingSpy.count(), 1);
+}
+
+void ReconnectSupervisorTest::concurrencyTest()
+{
+    m_supervisor->setMaxConcurrentAttempts(2);
+    m_supervisor->setMaxAttemptsPerAdapter(2);
+
+    int maxInFlight = 0;
+    connect(m_supervisor, &ReconnectSupervisor::reconnecting, this, [this, &maxInFlight]() {
+        maxInFlight = qMax(maxInFlight, m_supervisor->inFlightCount());
+    });
+
+    Q_FOREACH (DevicePtr device, m_manager->devices()) {
+        m_supervisor->addDevice(device);
+    }
+    QCOMPARE(m_supervisor->inFlightCount(), 2);
+
+    Q_FOREACH (DevicePtr device, m_manager->devices()) {
+        QTRY_VERIFY(device->isConnected());
+    }
+    QCOMPARE(maxInFlight, 2);
+
+    // Per adapter budget limits the concurrency as well
+    m_supervisor->setMaxAttemptsPerAdapter(1);
+    maxInFlight = 0;
+
+    Q_FOREACH (DevicePtr device, m_manager->devices()) {
+        disconnectDevice(device);
+    }
+    Q_FOREACH (DevicePtr device, m_manager->devices()) {
+        QTRY_VERIFY(device->isConnected());
+    }
+    QCOMPARE(maxInFlight, 1);
+}
+
+void ReconnectSupervisorTest::removeDeviceTest()
+{
+    DevicePtr device = m_manager->devices().first();
+
+    m_supervisor->addDevice(device);
+    QTRY_VERIFY(device->isConnected());
+    QTRY_COMPARE(m_supervisor->inFlightCount(), 0);
+
+    m_supervisor->removeDevice(device);
+    QVERIFY(!m_supervisor->contains(device));
+    QCOMPARE(m_supervisor->devices().count(), 0);
+
+    QSignalSpy reconnectingSpy(m_supervisor, SIGNAL(reconnecting(DevicePtr,int)));
+    disconnectDevice(device);
+    QTest::qWait(50);
+    QCOMPARE(reconnectingSpy.count(), 0);
+    QVERIFY(!device->isConnected());
+}
+
+void ReconnectSupervisorTest::removeDeviceInFlightTest()
+{
+    const QString path = QStringLiteral("/org/bluez/hci0/dev_40_79_6A_0C_39_7F");
+    m_supervisor->setMaxConcurrentAttempts(1);
+
+    // Device whose Connect() never replies
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(path));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(QStringLiteral("/org/bluez/hci0")));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:7F");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("NoReplyDevice");
+    deviceProps[QStringLiteral("Trusted")] = true;
+    deviceProps[QStringLiteral("ConnectNoReply")] = true;
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    QTRY_VERIFY(m_manager->deviceForUbi(path));
+    m_supervisor->addDevice(m_manager->deviceForUbi(path));
+    QCOMPARE(m_supervisor->inFlightCount(), 1);
+
+    // Removing the device destroys it together with the pending reconnect
+    QVariantMap removeProps;
+    removeProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(path));
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("remove-device"), removeProps);
+
+    QTRY_VERIFY(!m_manager->deviceForUbi(path));
+    QTRY_COMPARE(m_supervisor->inFlightCount(), 0);
+    QCOMPARE(m_supervisor->devices().count(), 0);
+
+    // Released slot is available for other devices
+    DevicePtr device = m_manager->devices().first();
+    m_supervisor->addDevice(device);
+    QTRY_VERIFY(device->isConnected());
+}
+
+QTEST_MAIN(ReconnectSupervisorTest)
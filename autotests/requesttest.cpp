@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "requesttest.h"
+#include "autotests.h"
+#include "agent.h"
+#include "request.h"
+#include "requestmonitor.h"
+#include "pendingcall.h"
+#include "initmanagerjob.h"
+
+#include <QtTest/QTest>
+#include <QThread>
+#include <QElapsedTimer>
+#include <QDBusObjectPath>
+
+namespace BluezQt
+{
+extern void bluezqt_initFakeBluezTestRun();
+}
+
+using namespace BluezQt;
+
+static const QString adapterPath = QStringLiteral("/org/bluez/hci0");
+static const QString devicePath = adapterPath + QStringLiteral("/dev_40_79_6A_0C_39_75");
+
+// Agent keeping requests for the test to answer
+class RequestAgent : public Agent
+{
+public:
+    explicit RequestAgent(QObject *parent)
+        : Agent(parent)
+        , keep(true)
+    {
+    }
+
+    QDBusObjectPath objectPath() const override
+    {
+        return QDBusObjectPath(QStringLiteral("/requestagent"));
+    }
+
+    void requestPasskey(DevicePtr device, const Request<quint32> &request) override
+    {
+        Q_UNUSED(device)
+
+        if (keep) {
+            passkeyRequests.append(request);
+        }
+    }
+
+    void requestAuthorization(DevicePtr device, const Request<> &request) override
+    {
+        Q_UNUSED(device)
+
+        if (keep) {
+            requests.append(request);
+        }
+    }
+
+    bool keep;
+    QList<Request<> > requests;
+    QList<Request<quint32> > passkeyRequests;
+};
+
+// Thread accepting the request
+class ReplyThread : public QThread
+{
+public:
+    explicit ReplyThread(const Request<> &request)
+        : m_request(request)
+    {
+    }
+
+protected:
+    void run() override
+    {
+        m_request.accept();
+    }
+
+private:
+    Request<> m_request;
+};
+
+RequestTest::RequestTest()
+    : m_manager(nullptr)
+    , m_agent(nullptr)
+    , m_connection(QDBusConnection::connectToBus(QDBusConnection::SessionBus, QStringLiteral("requesttest")))
+{
+    Autotests::registerMetatypes();
+}
+
+void RequestTest::initTestCase()
+{
+    bluezqt_initFakeBluezTestRun();
+
+    FakeBluez::start();
+    FakeBluez::runTest(QStringLiteral("bluez-standard"));
+
+    QVariantMap adapterProps;
+    adapterProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    adapterProps[QStringLiteral("Address")] = QStringLiteral("1C:E5:C3:BC:94:7E");
+    adapterProps[QStringLiteral("Name")] = QStringLiteral("TestAdapter");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-adapter"), adapterProps);
+
+    QVariantMap deviceProps;
+    deviceProps[QStringLiteral("Path")] = QVariant::fromValue(QDBusObjectPath(devicePath));
+    deviceProps[QStringLiteral("Adapter")] = QVariant::fromValue(QDBusObjectPath(adapterPath));
+    deviceProps[QStringLiteral("Address")] = QStringLiteral("40:79:6A:0C:39:75");
+    deviceProps[QStringLiteral("Name")] = QStringLiteral("TestDevice");
+    FakeBluez::runAction(QStringLiteral("devicemanager"), QStringLiteral("create-device"), deviceProps);
+
+    m_manager = new Manager();
+    InitManagerJob *initJob = m_manager->init();
+    initJob->exec();
+    QVERIFY(!initJob->error());
+
+    m_agent = new RequestAgent(this);
+    PendingCall *call = m_manager->registerAgent(m_agent);
+    call->waitForFinished();
+    QVERIFY(!call->error());
+}
+
+void RequestTest::cleanupTestCase()
+{
+    m_manager->unregisterAgent(m_agent)->waitForFinished();
+    delete m_agent;
+    delete m_manager;
+
+    QDBusConnection::disconnectFromBus(QStringLiteral("requesttest"));
+
+    FakeBluez::stop();
+}
+
+void RequestTest::init()
+{
+    m_agent->keep = true;
+    m_agent->requests.clear();
+    m_agent->passkeyRequests.clear();
+
+    RequestMonitor::setDefaultDeadline(-1);
+    RequestMonitor::resetStatistics();
+}
+
+void RequestTest::deadlineTest()
+{
+    QDBusPendingCall call = callAgent(QStringLiteral("RequestAuthorization"));
+    QTRY_COMPARE(m_agent->requests.count(), 1);
+
+    const Request<> request = m_agent->requests.first();
+    QVERIFY(request.isPending());
+    QCOMPARE(RequestMonitor::pendingCount(), 1);
+
+    request.setDeadline(100, RejectOnDeadline);
+
+    const QDBusMessage &reply = waitForReply(call);
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), QStringLiteral("org.bluez.Agent1.Rejected"));
+
+    QVERIFY(!request.isPending());
+    QVERIFY(request.pendingTime() >= 100);
+    QCOMPARE(RequestMonitor::pendingCount(), 0);
+    QCOMPARE(RequestMonitor::expiredCount(), qint64(1));
+
+    // Reply after deadline is ignored
+    request.accept();
+    QCOMPARE(RequestMonitor::repliedCount(), qint64(1));
+}
+
+void RequestTest::replaceDeadlineTest()
+{
+    QDBusPendingCall call = callAgent(QStringLiteral("RequestAuthorization"));
+    QTRY_COMPARE(m_agent->requests.count(), 1);
+
+    const Request<> request = m_agent->requests.first();
+    request.setDeadline(50);
+    request.setDeadline(-1);
+
+    QTest::qWait(200);
+    QVERIFY(request.isPending());
+    QVERIFY(!call.isFinished());
+
+    request.accept();
+
+    const QDBusMessage &reply = waitForReply(call);
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(RequestMonitor::expiredCount(), qint64(0));
+}
+
+void RequestTest::defaultDeadlineTest()
+{
+    RequestMonitor::setDefaultDeadline(100);
+    QCOMPARE(RequestMonitor::defaultDeadline(), 100);
+    QCOMPARE(RequestMonitor::defaultDeadlineAction(), CancelOnDeadline);
+
+    // Agent drops the request without answering
+    m_agent->keep = false;
+
+    const QDBusMessage &reply = waitForReply(callAgent(QStringLiteral("RequestAuthorization")));
+    QCOMPARE(reply.type(), QDBusMessage::ErrorMessage);
+    QCOMPARE(reply.errorName(), QStringLiteral("org.bluez.Agent1.Canceled"));
+    QCOMPARE(RequestMonitor::expiredCount(), qint64(1));
+    QCOMPARE(RequestMonitor::abandonedCount(), qint64(0));
+}
+
+void RequestTest::threadReplyTest()
+{
+    QDBusPendingCall call = callAgent(QStringLiteral("RequestAuthorization"));
+    QTRY_COMPARE(m_agent->requests.count(), 1);
+
+    QList<ReplyThread*> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.append(new ReplyThread(m_agent->requests.first()));
+    }
+    Q_FOREACH (ReplyThread *thread, threads) {
+        thread->start();
+    }
+    Q_FOREACH (ReplyThread *thread, threads) {
+        QVERIFY(thread->wait(5000));
+    }
+    qDeleteAll(threads);
+
+    QVERIFY(!m_agent->requests.first().isPending());
+
+    // Reply is sent from main thread
+    const QDBusMessage &reply = waitForReply(call);
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(RequestMonitor::repliedCount(), qint64(1));
+}
+
+void RequestTest::statisticsTest()
+{
+    QDBusPendingCall call = callAgent(QStringLiteral("RequestPasskey"));
+    QTRY_COMPARE(m_agent->passkeyRequests.count(), 1);
+
+    QTest::qWait(50);
+    m_agent->passkeyRequests.first().accept(1234);
+
+    const QDBusMessage &reply = waitForReply(call);
+    QCOMPARE(reply.type(), QDBusMessage::ReplyMessage);
+    QCOMPARE(reply.arguments().first().toUInt(), quint32(1234));
+
+    QCOMPARE(RequestMonitor::pendingCount(), 0);
+    QCOMPARE(RequestMonitor::repliedCount(), qint64(1));
+    QCOMPARE(RequestMonitor::expiredCount(), qint64(0));
+    QVERIFY(RequestMonitor::maximumPendingTime() >= 50);
+    QCOMPARE(RequestMonitor::averagePendingTime(), RequestMonitor::maximumPendingTime());
+
+    RequestMonitor::resetStatistics();
+    QCOMPARE(RequestMonitor::repliedCount(), qint64(0));
+    QCOMPARE(RequestMonitor::maximumPendingTime(), qint64(0));
+    QCOMPARE(RequestMonitor::averagePendingTime(), qint64(0));
+}
+
+void RequestTest::abandonedTest()
+{
+    callAgent(QStringLiteral("RequestAuthorization"));
+    QTRY_COMPARE(m_agent->requests.count(), 1);
+    QCOMPARE(RequestMonitor::pendingCount(), 1);
+
+    m_agent->requests.clear();
+
+    QCOMPARE(RequestMonitor::pendingCount(), 0);
+    QCOMPARE(RequestMonitor::abandonedCount(), qint64(1));
+}
+
+QDBusPendingCall RequestTest::callAgent(const QString &method)
+{
+    QDBusMessage call = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(),
+                                                       m_agent->objectPath().path(),
+                                                       QStringLiteral("org.bluez.Agent1"),
+                                                       method);
+    call.setArguments(QVariantList() << QVariant::fromValue(QDBusObjectPath(devicePath)));
+    return m_connection.asyncCall(call);
+}
+
+QDBusMessage RequestTest::waitForReply(const QDBusPendingCall &call)
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (!call.isFinished() && timer.elapsed() < 10000) {
+        QTest::qWait(10);
+    }
+    return call.reply();
+}
+
+QTEST_MAIN(RequestTest)
@@ -25,6 +25,10 @@
 #include "device.h"
 #include "device_p.h"
 #include "pendingcall.h"
+#include "callscheduler_p.h"
+#include "batchjob.h"
+#include "gattapplication.h"
+#include "gattapplication_p.h"
 
 namespace BluezQt
 {
@@ -62,8 +66,9 @@ QString Adapter::name() const
 
 PendingCall *Adapter::setName(const QString &name)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Alias"), name),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Alias"), name));
+    }, this);
 }
 
 QString Adapter::systemName() const
@@ -83,8 +88,9 @@ bool Adapter::isPowered() const
 
 PendingCall *Adapter::setPowered(bool powered)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Powered"), powered),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Powered"), powered));
+    }, this);
 }
 
 bool Adapter::isDiscoverable() const
@@ -94,8 +100,9 @@ bool Adapter::isDiscoverable() const
 
 PendingCall *Adapter::setDiscoverable(bool discoverable)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Discoverable"), discoverable),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Discoverable"), discoverable));
+    }, this);
 }
 
 quint32 Adapter::discoverableTimeout() const
@@ -105,8 +112,9 @@ quint32 Adapter::discoverableTimeout() const
 
 PendingCall *Adapter::setDiscoverableTimeout(quint32 timeout)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("DiscoverableTimeout"), timeout),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("DiscoverableTimeout"), timeout));
+    }, this);
 }
 
 bool Adapter::isPairable() const
@@ -116,8 +124,9 @@ bool Adapter::isPairable() const
 
 PendingCall *Adapter::setPairable(bool pairable)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Pairable"), pairable),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Pairable"), pairable));
+    }, this);
 }
 
 quint32 Adapter::pairableTimeout() const
@@ -127,8 +136,9 @@ quint32 Adapter::pairableTimeout() const
 
 PendingCall *Adapter::setPairableTimeout(quint32 timeout)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("PairableTimeout"), timeout),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("PairableTimeout"), timeout));
+    }, this);
 }
 
 bool Adapter::isDiscovering()
@@ -161,21 +171,69 @@ DevicePtr Adapter::deviceForAddress(const QString &address) const
     return DevicePtr();
 }
 
+int Adapter::callTimeout() const
+{
+    return d->m_bluezAdapter->timeout();
+}
+
+void Adapter::setCallTimeout(int msecs)
+{
+    d->m_bluezAdapter->setTimeout(msecs);
+    d->m_dbusProperties->setTimeout(msecs);
+}
+
 PendingCall *Adapter::startDiscovery()
 {
-    return new PendingCall(d->m_bluezAdapter->StartDiscovery(),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezAdapter->StartDiscovery());
+    }, this);
 }
 
 PendingCall *Adapter::stopDiscovery()
 {
-    return new PendingCall(d->m_bluezAdapter->StopDiscovery(),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezAdapter->StopDiscovery());
+    }, this);
+}
+
+PendingCall *Adapter::setDiscoveryFilter(const QVariantMap &filter)
+{
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezAdapter->SetDiscoveryFilter(filter));
+    }, this);
 }
 
 PendingCall *Adapter::removeDevice(DevicePtr device)
 {
-    return new PendingCall(d->m_bluezAdapter->RemoveDevice(QDBusObjectPath(device->ubi())),
+    return CallSchedulerPrivate::createCall(d->m_bluezAdapter->path(), CallScheduler::Background, [=]() {
+        return QDBusPendingCall(d->m_bluezAdapter->RemoveDevice(QDBusObjectPath(device->ubi())));
+    }, this);
+}
+
+BatchJob *Adapter::removeDevices(const QList<DevicePtr> &devices)
+{
+    return new BatchJob(devices, [this](const DevicePtr &device) {
+        return removeDevice(device);
+    }, this);
+}
+
+PendingCall *Adapter::registerGattApplication(GattApplication *application)
+{
+    Q_ASSERT(application);
+
+    application->d->registerObjects();
+
+    return new PendingCall(d->m_bluezGattManager->RegisterApplication(application->objectPath(), QVariantMap()),
+                           PendingCall::ReturnVoid, this);
+}
+
+PendingCall *Adapter::unregisterGattApplication(GattApplication *application)
+{
+    Q_ASSERT(application);
+
+    application->d->unregisterObjects();
+
+    return new PendingCall(d->m_bluezGattManager->UnregisterApplication(application->objectPath()),
                            PendingCall::ReturnVoid, this);
 }
 
@@ -35,6 +35,7 @@ namespace BluezQt
 
 class Device;
 class PendingCall;
+class GattApplication;
 
 /**
  * @class BluezQt::Adapter adapter.h <BluezQt/Adapter>
@@ -245,6 +246,23 @@ public:
      */
     DevicePtr deviceForAddress(const QString &address) const;
 
+    /**
+     * Returns the D-Bus timeout of method calls.
+     *
+     * @return timeout in milliseconds, -1 means the default D-Bus timeout
+     */
+    int callTimeout() const;
+
+    /**
+     * Sets the D-Bus timeout of method calls.
+     *
+     * All following calls on this adapter that do not get a reply within
+     * the timeout finish with PendingCall::TimedOut error.
+     *
+     * @param msecs timeout in milliseconds, -1 to use the default D-Bus timeout
+     */
+    void setCallTimeout(int msecs);
+
     /**
      * Starts device discovery.
      *
@@ -264,6 +282,22 @@ public:
      */
     PendingCall *stopDiscovery();
 
+    /**
+     * Sets the device discovery filter.
+     *
+     * The filter is applied to discovery started with startDiscovery() by this client.
+     * Supported keys are "UUIDs" (QStringList), "RSSI" (qint16), "Pathloss" (quint16)
+     * and "Transport" (QString: "auto", "bredr" or "le").
+     * An empty filter removes the current filter.
+     *
+     * Possible errors: PendingCall::NotReady, PendingCall::NotSupported,
+     *                  PendingCall::InvalidArguments, PendingCall::Failed
+     *
+     * @param filter discovery filter
+     * @return void pending call
+     */
+    PendingCall *setDiscoveryFilter(const QVariantMap &filter);
+
     /**
      * Removes the specified device.
      *
@@ -276,6 +310,41 @@ public:
      */
     PendingCall *removeDevice(DevicePtr device);
 
+    /**
+     * Removes the specified devices.
+     *
+     * Devices are removed with pipelined removeDevice() calls.
+     * The returned job needs to be started with Job::start().
+     *
+     * @param devices devices to be removed
+     * @return batch job
+     */
+    BatchJob *removeDevices(const QList<DevicePtr> &devices);
+
+    /**
+     * Registers a GATT application.
+     *
+     * The services and characteristics of the application are exported
+     * on D-Bus and registered in this adapter's local GATT database.
+     * All services and characteristics must be created before registering.
+     *
+     * Possible errors: PendingCall::InvalidArguments, PendingCall::AlreadyExists
+     *
+     * @param application application to be registered
+     * @return void pending call
+     */
+    PendingCall *registerGattApplication(GattApplication *application);
+
+    /**
+     * Unregisters a GATT application.
+     *
+     * Possible errors: PendingCall::InvalidArguments, PendingCall::DoesNotExist
+     *
+     * @param application application to be unregistered
+     * @return void pending call
+     */
+    PendingCall *unregisterGattApplication(GattApplication *application);
+
 Q_SIGNALS:
     /**
      * Indicates that the adapter was removed.
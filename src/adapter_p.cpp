@@ -39,6 +39,7 @@ AdapterPrivate::AdapterPrivate(const QString &path, const QVariantMap &propertie
     , m_pairableTimeout(0)
 {
     m_bluezAdapter = new BluezAdapter(Strings::orgBluez(), path, DBusConnection::orgBluez(), this);
+    m_bluezGattManager = new BluezGattManager(Strings::orgBluez(), path, DBusConnection::orgBluez(), this);
 
     init(properties);
 }
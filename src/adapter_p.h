@@ -28,12 +28,14 @@
 
 #include "types.h"
 #include "bluezadapter1.h"
+#include "bluezgattmanager1.h"
 #include "dbusproperties.h"
 
 namespace BluezQt
 {
 
 typedef org::bluez::Adapter1 BluezAdapter;
+typedef org::bluez::GattManager1 BluezGattManager;
 typedef org::freedesktop::DBus::Properties DBusProperties;
 
 class AdapterPrivate : public QObject
@@ -53,6 +55,7 @@ public:
 
     QWeakPointer<Adapter> q;
     BluezAdapter *m_bluezAdapter;
+    BluezGattManager *m_bluezGattManager;
     DBusProperties *m_dbusProperties;
 
     QString m_address;
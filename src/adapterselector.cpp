@@ -0,0 +1,254 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "adapterselector.h"
+#include "adapterselector_p.h"
+#include "adapter.h"
+#include "device.h"
+
+namespace BluezQt
+{
+
+AdapterSelectorPrivate::AdapterSelectorPrivate(Manager *manager)
+    : m_manager(manager)
+    , m_policy(AdapterSelector::LeastConnected)
+{
+}
+
+AdapterPtr AdapterSelectorPrivate::choose(const QList<AdapterPtr> &candidates)
+{
+    if (candidates.isEmpty()) {
+        return AdapterPtr();
+    }
+
+    AdapterPtr selected = candidates.first();
+
+    switch (m_policy) {
+    case AdapterSelector::LeastConnected: {
+        int minLoad = load(selected);
+        Q_FOREACH (AdapterPtr adapter, candidates) {
+            const int adapterLoad = load(adapter);
+            if (adapterLoad < minLoad) {
+                minLoad = adapterLoad;
+                selected = adapter;
+            }
+        }
+        break;
+    }
+
+    case AdapterSelector::RoundRobin: {
+        // Candidates are in the order of Manager::adapters(), take the first one after last selected
+        const QList<AdapterPtr> &adapters = m_manager->adapters();
+        int lastIndex = -1;
+        for (int i = 0; i < adapters.count(); ++i) {
+            if (adapters.at(i)->ubi() == m_lastSelected) {
+                lastIndex = i;
+                break;
+            }
+        }
+        Q_FOREACH (AdapterPtr adapter, candidates) {
+            if (adapters.indexOf(adapter) > lastIndex) {
+                selected = adapter;
+                break;
+            }
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    m_lastSelected = selected->ubi();
+    m_selections[selected->ubi()]++;
+    return selected;
+}
+
+int AdapterSelectorPrivate::load(const AdapterPtr &adapter) const
+{
+    return connectedDevices(adapter) + pendingDevices(adapter);
+}
+
+int AdapterSelectorPrivate::connectedDevices(const AdapterPtr &adapter)
+{
+    int count = 0;
+    Q_FOREACH (DevicePtr device, adapter->devices()) {
+        if (device->isConnected()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int AdapterSelectorPrivate::pendingDevices(const AdapterPtr &adapter) const
+{
+    int count = 0;
+    Q_FOREACH (DevicePtr device, m_pending.value(adapter->ubi())) {
+        if (!device->isConnected()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void AdapterSelectorPrivate::prunePending()
+{
+    QHash<QString, QList<DevicePtr> >::iterator it;
+    for (it = m_pending.begin(); it != m_pending.end(); ++it) {
+        QList<DevicePtr> &devices = it.value();
+        for (int i = devices.count() - 1; i >= 0; --i) {
+            if (devices.at(i)->isConnected()) {
+                devices.removeAt(i);
+            }
+        }
+    }
+}
+
+AdapterSelector::AdapterSelector(Manager *manager, QObject *parent)
+    : QObject(parent)
+    , d(new AdapterSelectorPrivate(manager))
+{
+}
+
+AdapterSelector::~AdapterSelector()
+{
+    delete d;
+}
+
+AdapterSelector::Policy AdapterSelector::policy() const
+{
+    return d->m_policy;
+}
+
+void AdapterSelector::setPolicy(Policy policy)
+{
+    d->m_policy = policy;
+}
+
+void AdapterSelector::pinAddress(const QString &address, AdapterPtr adapter)
+{
+    if (!adapter) {
+        unpinAddress(address);
+        return;
+    }
+    d->m_pins.insert(address.toUpper(), adapter->ubi());
+}
+
+void AdapterSelector::unpinAddress(const QString &address)
+{
+    d->m_pins.remove(address.toUpper());
+}
+
+AdapterPtr AdapterSelector::pinnedAdapter(const QString &address) const
+{
+    if (!d->m_manager || !d->m_pins.contains(address.toUpper())) {
+        return AdapterPtr();
+    }
+    return d->m_manager->adapterForUbi(d->m_pins.value(address.toUpper()));
+}
+
+AdapterPtr AdapterSelector::selectAdapter()
+{
+    if (!d->m_manager) {
+        return AdapterPtr();
+    }
+
+    d->prunePending();
+
+    QList<AdapterPtr> candidates;
+    Q_FOREACH (AdapterPtr adapter, d->m_manager->adapters()) {
+        if (adapter->isPowered()) {
+            candidates.append(adapter);
+        }
+    }
+    return d->choose(candidates);
+}
+
+DevicePtr AdapterSelector::selectDevice(const QString &address)
+{
+    if (!d->m_manager) {
+        return DevicePtr();
+    }
+
+    d->prunePending();
+
+    QList<AdapterPtr> candidates;
+    const QString &pinned = d->m_pins.value(address.toUpper());
+
+    Q_FOREACH (AdapterPtr adapter, d->m_manager->adapters()) {
+        if (!adapter->isPowered() || !adapter->deviceForAddress(address)) {
+            continue;
+        }
+        if (!pinned.isEmpty() && adapter->ubi() != pinned) {
+            continue;
+        }
+        candidates.append(adapter);
+    }
+
+    AdapterPtr adapter = d->choose(candidates);
+    if (!adapter) {
+        return DevicePtr();
+    }
+
+    DevicePtr device = adapter->deviceForAddress(address);
+    if (!device->isConnected()) {
+        QList<DevicePtr> &pending = d->m_pending[adapter->ubi()];
+        if (!pending.contains(device)) {
+            pending.append(device);
+        }
+    }
+    return device;
+}
+
+void AdapterSelector::release(DevicePtr device)
+{
+    if (!device || !device->adapter()) {
+        return;
+    }
+    d->m_pending[device->adapter()->ubi()].removeOne(device);
+}
+
+int AdapterSelector::connectedCount(AdapterPtr adapter) const
+{
+    if (!adapter) {
+        return 0;
+    }
+    return d->connectedDevices(adapter);
+}
+
+int AdapterSelector::pendingCount(AdapterPtr adapter) const
+{
+    if (!adapter) {
+        return 0;
+    }
+    return d->pendingDevices(adapter);
+}
+
+int AdapterSelector::selectionCount(AdapterPtr adapter) const
+{
+    if (!adapter) {
+        return 0;
+    }
+    return d->m_selections.value(adapter->ubi());
+}
+
+} // namespace BluezQt
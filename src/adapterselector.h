@@ -0,0 +1,189 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_ADAPTERSELECTOR_H
+#define BLUEZQT_ADAPTERSELECTOR_H
+
+#include <QObject>
+
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class Manager;
+
+/**
+ * @class BluezQt::AdapterSelector adapterselector.h <BluezQt/AdapterSelector>
+ *
+ * Adapter selector.
+ *
+ * AdapterSelector spreads the work between multiple adapters (controllers).
+ *
+ * BlueZ creates a separate device object on each adapter that sees the remote device.
+ * selectDevice() picks one of those device objects according to the selection policy,
+ * selectAdapter() picks an adapter for work not tied to a remote device.
+ *
+ * Only powered adapters are selected. A remote device can also be pinned to an adapter,
+ * in which case it is always connected through the pinned adapter.
+ *
+ * The selector can be used with ConnectionManager, see ConnectionManager::setAdapterSelector().
+ * DiscoveryScheduler uses the selector to pause discovery on adapters with pending connections,
+ * see DiscoveryScheduler::setAdapterSelector().
+ */
+class BLUEZQT_EXPORT AdapterSelector : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(Policy policy READ policy WRITE setPolicy)
+
+public:
+    /**
+     * Selection policies.
+     */
+    enum Policy {
+        /** Selects the first powered adapter. */
+        FirstPowered,
+        /** Selects the adapter with the least connected and pending devices. */
+        LeastConnected,
+        /** Selects the adapters in turns. */
+        RoundRobin
+    };
+    Q_ENUM(Policy)
+
+    /**
+     * Creates a new AdapterSelector object.
+     *
+     * @param manager manager
+     * @param parent
+     */
+    explicit AdapterSelector(Manager *manager, QObject *parent = nullptr);
+
+    /**
+     * Destroys an AdapterSelector object.
+     */
+    ~AdapterSelector();
+
+    /**
+     * Returns the selection policy.
+     *
+     * @return selection policy
+     */
+    Policy policy() const;
+
+    /**
+     * Sets the selection policy.
+     *
+     * Default value is LeastConnected.
+     *
+     * @param policy selection policy
+     */
+    void setPolicy(Policy policy);
+
+    /**
+     * Pins the remote device to the adapter.
+     *
+     * selectDevice() will only return the device object of this adapter.
+     *
+     * @param address address of remote device
+     * @param adapter adapter
+     */
+    void pinAddress(const QString &address, AdapterPtr adapter);
+
+    /**
+     * Removes the pinning of the remote device.
+     *
+     * @param address address of remote device
+     */
+    void unpinAddress(const QString &address);
+
+    /**
+     * Returns the adapter the remote device is pinned to.
+     *
+     * @param address address of remote device
+     * @return null if device is not pinned
+     */
+    AdapterPtr pinnedAdapter(const QString &address) const;
+
+    /**
+     * Selects an adapter.
+     *
+     * @return null if there is no powered adapter
+     */
+    AdapterPtr selectAdapter();
+
+    /**
+     * Selects a device object of the remote device.
+     *
+     * The selected device is counted as pending on its adapter until it is
+     * connected or released with release().
+     *
+     * @param address address of remote device
+     * @return null if no powered adapter knows the device
+     */
+    DevicePtr selectDevice(const QString &address);
+
+    /**
+     * Releases the device selected with selectDevice().
+     *
+     * It should be called when the connection attempt of the device have failed.
+     *
+     * @param device device
+     */
+    void release(DevicePtr device);
+
+    /**
+     * Returns the number of connected devices of the adapter.
+     *
+     * @param adapter adapter
+     * @return number of connected devices
+     */
+    int connectedCount(AdapterPtr adapter) const;
+
+    /**
+     * Returns the number of selected devices of the adapter that are not yet connected.
+     *
+     * @param adapter adapter
+     * @return number of pending devices
+     */
+    int pendingCount(AdapterPtr adapter) const;
+
+    /**
+     * Returns how many times the adapter was selected.
+     *
+     * Both selectAdapter() and selectDevice() are counted.
+     *
+     * @param adapter adapter
+     * @return number of selections
+     */
+    int selectionCount(AdapterPtr adapter) const;
+
+private:
+    class AdapterSelectorPrivate *const d;
+
+    friend class AdapterSelectorPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_ADAPTERSELECTOR_H
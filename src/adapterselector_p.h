@@ -0,0 +1,56 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_ADAPTERSELECTOR_P_H
+#define BLUEZQT_ADAPTERSELECTOR_P_H
+
+#include <QHash>
+#include <QPointer>
+
+#include "adapterselector.h"
+#include "manager.h"
+
+namespace BluezQt
+{
+
+class AdapterSelectorPrivate
+{
+public:
+    explicit AdapterSelectorPrivate(Manager *manager);
+
+    AdapterPtr choose(const QList<AdapterPtr> &candidates);
+    int load(const AdapterPtr &adapter) const;
+    int pendingDevices(const AdapterPtr &adapter) const;
+    static int connectedDevices(const AdapterPtr &adapter);
+    void prunePending();
+
+    QPointer<Manager> m_manager;
+    AdapterSelector::Policy m_policy;
+    QHash<QString, QString> m_pins;
+    QHash<QString, QList<DevicePtr> > m_pending;
+    QHash<QString, int> m_selections;
+    QString m_lastSelected;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_ADAPTERSELECTOR_P_H
@@ -0,0 +1,212 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "batchjob.h"
+#include "pendingcall.h"
+#include "device.h"
+#include "debug.h"
+
+#include <QHash>
+#include <QVector>
+
+namespace BluezQt
+{
+
+class BatchJobPrivate : public QObject
+{
+public:
+    explicit BatchJobPrivate(BatchJob *q, const QList<DevicePtr> &devices, const BatchJob::CallFactory &factory);
+
+    void startNext();
+    void itemFinished(int index, int error, const QString &errorText);
+    void cancelPending();
+
+    BatchJob *q;
+    QList<DevicePtr> m_devices;
+    BatchJob::CallFactory m_factory;
+    QVector<int> m_errors;
+    QHash<int, QString> m_errorTexts;
+    QHash<PendingCall*, int> m_pending;
+    int m_window;
+    int m_next;
+    int m_finished;
+    int m_failed;
+};
+
+BatchJobPrivate::BatchJobPrivate(BatchJob *q, const QList<DevicePtr> &devices, const BatchJob::CallFactory &factory)
+    : QObject(q)
+    , q(q)
+    , m_devices(devices)
+    , m_factory(factory)
+    , m_errors(devices.count(), PendingCall::NoError)
+    , m_window(8)
+    , m_next(0)
+    , m_finished(0)
+    , m_failed(0)
+{
+}
+
+void BatchJobPrivate::startNext()
+{
+    // Killed job doesn't start new calls
+    if (!q->isRunning()) {
+        return;
+    }
+
+    while (m_pending.count() < m_window && m_next < m_devices.count()) {
+        const int index = m_next++;
+        const DevicePtr &device = m_devices.at(index);
+
+        if (!device) {
+            itemFinished(index, PendingCall::InvalidArguments, QStringLiteral("Invalid device"));
+            continue;
+        }
+
+        PendingCall *call = m_factory(device);
+        m_pending.insert(call, index);
+
+        connect(call, &PendingCall::finished, this, [this, index](PendingCall *finishedCall) {
+            m_pending.remove(finishedCall);
+            itemFinished(index, finishedCall->error(), finishedCall->errorText());
+        });
+        connect(call, &QObject::destroyed, this, [this, index](QObject *object) {
+            // Call deleted (eg. with its device) without finishing
+            if (m_pending.remove(static_cast<PendingCall*>(object))) {
+                itemFinished(index, PendingCall::InternalError, QStringLiteral("Call was deleted before finished"));
+            }
+        });
+    }
+}
+
+void BatchJobPrivate::itemFinished(int index, int error, const QString &errorText)
+{
+    if (!q->isRunning()) {
+        return;
+    }
+
+    m_errors[index] = error;
+    if (error != PendingCall::NoError) {
+        m_errorTexts.insert(index, errorText);
+        m_failed++;
+    }
+    m_finished++;
+
+    Q_EMIT q->progress(q, m_finished, m_devices.count());
+
+    if (m_finished == m_devices.count()) {
+        if (m_failed > 0) {
+            qCWarning(BLUEZQT) << "BatchJob Error:" << m_failed << "of" << m_devices.count() << "calls failed";
+            q->setError(BatchJob::UserDefinedError);
+            q->setErrorText(QStringLiteral("%1 of %2 calls failed").arg(m_failed).arg(m_devices.count()));
+        }
+        q->emitResult();
+        return;
+    }
+
+    startNext();
+}
+
+void BatchJobPrivate::cancelPending()
+{
+    const QList<PendingCall*> calls = m_pending.keys();
+    m_pending.clear();
+
+    Q_FOREACH (PendingCall *call, calls) {
+        call->cancel();
+    }
+}
+
+BatchJob::BatchJob(const QList<DevicePtr> &devices, const CallFactory &factory, QObject *parent)
+    : Job(parent)
+    , d(new BatchJobPrivate(this, devices, factory))
+{
+}
+
+BatchJob::~BatchJob()
+{
+    if (isRunning()) {
+        qCWarning(BLUEZQT) << "BatchJob Error: Job was deleted before finished!";
+
+        setError(UserDefinedError);
+        setErrorText(QStringLiteral("Job was deleted before finished."));
+        emitResult();
+    }
+    d->cancelPending();
+    delete d;
+}
+
+int BatchJob::count() const
+{
+    return d->m_devices.count();
+}
+
+DevicePtr BatchJob::device(int index) const
+{
+    return d->m_devices.value(index);
+}
+
+int BatchJob::finishedCount() const
+{
+    return d->m_finished;
+}
+
+int BatchJob::failedCount() const
+{
+    return d->m_failed;
+}
+
+int BatchJob::itemError(int index) const
+{
+    return d->m_errors.value(index, PendingCall::NoError);
+}
+
+QString BatchJob::itemErrorText(int index) const
+{
+    return d->m_errorTexts.value(index);
+}
+
+int BatchJob::window() const
+{
+    return d->m_window;
+}
+
+void BatchJob::setWindow(int window)
+{
+    d->m_window = qMax(1, window);
+}
+
+void BatchJob::doStart()
+{
+    if (d->m_devices.isEmpty()) {
+        emitResult();
+        return;
+    }
+
+    d->startNext();
+}
+
+void BatchJob::doEmitResult()
+{
+    Q_EMIT result(this);
+}
+
+} // namespace BluezQt
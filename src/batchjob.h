@@ -0,0 +1,159 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_BATCHJOB_H
+#define BLUEZQT_BATCHJOB_H
+
+#include <functional>
+
+#include <QObject>
+
+#include "job.h"
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class PendingCall;
+
+/**
+ * @class BluezQt::BatchJob batchjob.h <BluezQt/BatchJob>
+ *
+ * Batch job.
+ *
+ * This class represents a job that runs one method call for each device
+ * in a list, eg. Adapter::removeDevices() or Manager::setTrusted().
+ *
+ * Calls are pipelined: at most window() calls are waiting for reply
+ * at the same time. progress() is emitted after each finished call.
+ *
+ * When all calls have finished, result() is emitted. If any of the calls
+ * failed, error() is UserDefinedError and per-item errors can be read
+ * with itemError() and itemErrorText().
+ *
+ * Killing the job cancels all calls that are still waiting for reply.
+ */
+class BLUEZQT_EXPORT BatchJob : public Job
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count)
+    Q_PROPERTY(int finishedCount READ finishedCount)
+    Q_PROPERTY(int failedCount READ failedCount)
+    Q_PROPERTY(int window READ window WRITE setWindow)
+
+public:
+    /**
+     * Destroys a BatchJob object.
+     */
+    ~BatchJob() override;
+
+    /**
+     * Returns the number of items in the batch.
+     *
+     * @return number of items
+     */
+    int count() const;
+
+    /**
+     * Returns a device of item.
+     *
+     * @param index index of item
+     * @return device
+     */
+    DevicePtr device(int index) const;
+
+    /**
+     * Returns the number of finished items.
+     *
+     * @return number of finished items
+     */
+    int finishedCount() const;
+
+    /**
+     * Returns the number of failed items.
+     *
+     * @return number of failed items
+     */
+    int failedCount() const;
+
+    /**
+     * Returns an error code of item.
+     *
+     * @param index index of item
+     * @return PendingCall::Error of item call
+     */
+    int itemError(int index) const;
+
+    /**
+     * Returns an error text of item.
+     *
+     * @param index index of item
+     * @return error text of item call
+     */
+    QString itemErrorText(int index) const;
+
+    /**
+     * Returns the maximum number of calls waiting for reply at the same time.
+     *
+     * @return window size
+     */
+    int window() const;
+
+    /**
+     * Sets the maximum number of calls waiting for reply at the same time.
+     *
+     * It must be called before the job is started. Default value is 8.
+     *
+     * @param window window size (at least 1)
+     */
+    void setWindow(int window);
+
+Q_SIGNALS:
+    /**
+     * Indicates that an item of the job have finished.
+     */
+    void progress(BatchJob *job, int finishedCount, int count);
+
+    /**
+     * Indicates that the job have finished.
+     */
+    void result(BatchJob *job);
+
+private:
+    typedef std::function<PendingCall*(const DevicePtr &device)> CallFactory;
+
+    explicit BatchJob(const QList<DevicePtr> &devices, const CallFactory &factory, QObject *parent);
+
+    void doStart() override;
+    void doEmitResult() override;
+
+    class BatchJobPrivate *const d;
+
+    friend class BatchJobPrivate;
+    friend class Adapter;
+    friend class Manager;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_BATCHJOB_H
@@ -0,0 +1,307 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "callscheduler.h"
+#include "callscheduler_p.h"
+#include "pendingcall.h"
+#include "pendingcall_p.h"
+
+namespace BluezQt
+{
+
+static QPointer<CallScheduler> s_instance;
+
+CallSchedulerPrivate::Lane::Lane()
+    : inFlight(0)
+    , interactiveStreak(0)
+{
+}
+
+CallSchedulerPrivate::Metrics::Metrics()
+    : dispatched(0)
+    , totalWait(0)
+    , maxWait(0)
+{
+}
+
+CallSchedulerPrivate::CallSchedulerPrivate(CallScheduler *q)
+    : q(q)
+    , m_maxInFlight(2)
+    , m_interactiveBurst(4)
+{
+}
+
+PendingCall *CallSchedulerPrivate::createCall(const QString &path, CallScheduler::Priority priority,
+                                              const CallStarter &starter, QObject *parent)
+{
+    PendingCall *call = new PendingCall(PendingCall::ReturnVoid, parent);
+    scheduleCall(call, path, priority, starter);
+    return call;
+}
+
+void CallSchedulerPrivate::scheduleCall(PendingCall *call, const QString &path, CallScheduler::Priority priority,
+                                        const CallStarter &starter)
+{
+    CallScheduler *scheduler = s_instance.data();
+    if (!scheduler) {
+        call->d->startCall(starter());
+        return;
+    }
+
+    call->d->m_scheduler = scheduler;
+    scheduler->d->enqueue(path, priority, call, starter);
+}
+
+void CallSchedulerPrivate::startNow(PendingCall *call)
+{
+    CallScheduler *scheduler = call->d->m_scheduler.data();
+    if (!scheduler) {
+        return;
+    }
+
+    CallSchedulerPrivate *d = scheduler->d;
+
+    for (auto it = d->m_lanes.begin(); it != d->m_lanes.end(); ++it) {
+        for (int priority = CallScheduler::Interactive; priority <= CallScheduler::Background; ++priority) {
+            QQueue<QueuedCall> &queue = it.value().queues[priority];
+            for (int i = 0; i < queue.size(); ++i) {
+                if (queue.at(i).call == call) {
+                    QueuedCall queued = queue.takeAt(i);
+                    d->startCall(it.key(), queued, static_cast<CallScheduler::Priority>(priority));
+                    return;
+                }
+            }
+        }
+    }
+}
+
+CallScheduler *CallSchedulerPrivate::instance()
+{
+    return s_instance.data();
+}
+
+void CallSchedulerPrivate::setInstance(CallScheduler *scheduler)
+{
+    s_instance = scheduler;
+}
+
+void CallSchedulerPrivate::enqueue(const QString &path, CallScheduler::Priority priority, PendingCall *call, const CallStarter &starter)
+{
+    // Calls are limited per adapter, eg. /org/bluez/hci0/dev_XX -> /org/bluez/hci0
+    const QString &laneName = path.section(QLatin1Char('/'), 0, 3);
+
+    QueuedCall queued;
+    queued.call = call;
+    queued.starter = starter;
+    queued.waitTimer.start();
+
+    m_lanes[laneName].queues[priority].enqueue(queued);
+    dispatch(laneName);
+}
+
+void CallSchedulerPrivate::dispatch(const QString &laneName)
+{
+    auto it = m_lanes.find(laneName);
+    if (it == m_lanes.end()) {
+        return;
+    }
+
+    QueuedCall next;
+    CallScheduler::Priority priority;
+
+    while (it.value().inFlight < m_maxInFlight && takeNext(it.value(), &next, &priority)) {
+        startCall(laneName, next, priority);
+    }
+}
+
+bool CallSchedulerPrivate::takeNext(Lane &lane, QueuedCall *next, CallScheduler::Priority *priority)
+{
+    QQueue<QueuedCall> &interactive = lane.queues[CallScheduler::Interactive];
+    QQueue<QueuedCall> &background = lane.queues[CallScheduler::Background];
+
+    // Drop calls that were canceled or deleted while queued
+    while (!interactive.isEmpty() && !isAlive(interactive.head())) {
+        interactive.dequeue();
+    }
+    while (!background.isEmpty() && !isAlive(background.head())) {
+        background.dequeue();
+    }
+
+    if (interactive.isEmpty() && background.isEmpty()) {
+        return false;
+    }
+
+    // Let one background call through after interactive burst, so it doesn't starve
+    if (interactive.isEmpty() || (!background.isEmpty() && lane.interactiveStreak >= m_interactiveBurst)) {
+        *next = background.dequeue();
+        *priority = CallScheduler::Background;
+        lane.interactiveStreak = 0;
+    } else {
+        *next = interactive.dequeue();
+        *priority = CallScheduler::Interactive;
+        lane.interactiveStreak++;
+    }
+    return true;
+}
+
+void CallSchedulerPrivate::startCall(const QString &laneName, QueuedCall &queued, CallScheduler::Priority priority)
+{
+    PendingCall *call = queued.call.data();
+
+    Metrics &metrics = m_metrics[priority];
+    const qint64 wait = queued.waitTimer.elapsed();
+    metrics.dispatched++;
+    metrics.totalWait += wait;
+    metrics.maxWait = qMax(metrics.maxWait, wait);
+
+    m_lanes[laneName].inFlight++;
+    m_inFlight.insert(call, laneName);
+
+    QObject::connect(call, &PendingCall::finished, q, [this](PendingCall *finishedCall) {
+        callDone(finishedCall);
+    });
+    QObject::connect(call, &QObject::destroyed, q, [this](QObject *object) {
+        callDone(object);
+    });
+
+    call->d->startCall(queued.starter());
+}
+
+void CallSchedulerPrivate::callDone(QObject *call)
+{
+    auto it = m_inFlight.find(call);
+    if (it == m_inFlight.end()) {
+        return;
+    }
+
+    const QString laneName = it.value();
+    m_inFlight.erase(it);
+
+    Lane &lane = m_lanes[laneName];
+    lane.inFlight--;
+    dispatch(laneName);
+
+    if (lane.inFlight == 0 && lane.queues[0].isEmpty() && lane.queues[1].isEmpty()) {
+        m_lanes.remove(laneName);
+    }
+}
+
+void CallSchedulerPrivate::flush()
+{
+    Q_FOREACH (const Lane &lane, m_lanes) {
+        for (const QQueue<QueuedCall> &queue : lane.queues) {
+            Q_FOREACH (const QueuedCall &queued, queue) {
+                if (isAlive(queued)) {
+                    queued.call->d->startCall(queued.starter());
+                }
+            }
+        }
+    }
+    m_lanes.clear();
+    m_inFlight.clear();
+}
+
+bool CallSchedulerPrivate::isAlive(const QueuedCall &queued)
+{
+    return queued.call && !queued.call->d->m_done;
+}
+
+CallScheduler::CallScheduler(QObject *parent)
+    : QObject(parent)
+    , d(new CallSchedulerPrivate(this))
+{
+}
+
+CallScheduler::~CallScheduler()
+{
+    d->flush();
+    delete d;
+}
+
+int CallScheduler::maxInFlightPerAdapter() const
+{
+    return d->m_maxInFlight;
+}
+
+void CallScheduler::setMaxInFlightPerAdapter(int count)
+{
+    d->m_maxInFlight = qMax(1, count);
+
+    Q_FOREACH (const QString &laneName, d->m_lanes.keys()) {
+        d->dispatch(laneName);
+    }
+}
+
+int CallScheduler::interactiveBurst() const
+{
+    return d->m_interactiveBurst;
+}
+
+void CallScheduler::setInteractiveBurst(int count)
+{
+    d->m_interactiveBurst = qMax(1, count);
+}
+
+int CallScheduler::queueDepth(Priority priority) const
+{
+    int depth = 0;
+    Q_FOREACH (const CallSchedulerPrivate::Lane &lane, d->m_lanes) {
+        Q_FOREACH (const CallSchedulerPrivate::QueuedCall &queued, lane.queues[priority]) {
+            if (CallSchedulerPrivate::isAlive(queued)) {
+                depth++;
+            }
+        }
+    }
+    return depth;
+}
+
+int CallScheduler::inFlightCount() const
+{
+    return d->m_inFlight.count();
+}
+
+int CallScheduler::dispatchedCount(Priority priority) const
+{
+    return d->m_metrics[priority].dispatched;
+}
+
+int CallScheduler::averageWaitTime(Priority priority) const
+{
+    const CallSchedulerPrivate::Metrics &metrics = d->m_metrics[priority];
+    if (metrics.dispatched == 0) {
+        return 0;
+    }
+    return int(metrics.totalWait / metrics.dispatched);
+}
+
+int CallScheduler::maximumWaitTime(Priority priority) const
+{
+    return int(d->m_metrics[priority].maxWait);
+}
+
+void CallScheduler::resetMetrics()
+{
+    d->m_metrics[Interactive] = CallSchedulerPrivate::Metrics();
+    d->m_metrics[Background] = CallSchedulerPrivate::Metrics();
+}
+
+} // namespace BluezQt
@@ -0,0 +1,173 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_CALLSCHEDULER_H
+#define BLUEZQT_CALLSCHEDULER_H
+
+#include <QObject>
+
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::CallScheduler callscheduler.h <BluezQt/CallScheduler>
+ *
+ * Scheduler of method calls to bluetoothd.
+ *
+ * bluetoothd processes method calls one at a time. Without a scheduler, all calls
+ * are sent immediately, so a short interactive call (eg. Device::connectToDevice())
+ * may wait behind hundreds of bulk calls (eg. Adapter::removeDevice()).
+ *
+ * When a scheduler is installed with Manager::setCallScheduler(), calls of Adapter,
+ * Device and MediaPlayer are queued and only a limited number of calls per adapter
+ * is sent to bluetoothd at the same time. Calls are queued in two lanes:
+ *
+ *  - Background: Adapter::removeDevice() and Device property setters
+ *  - Interactive: all other calls
+ *
+ * Interactive calls are sent first, but after interactiveBurst() interactive calls
+ * in a row one background call is sent, so background calls never starve.
+ *
+ * Queued calls are returned as usual PendingCall objects, waiting in the queue
+ * counts towards their timeout. Canceling a queued call removes it from the queue.
+ */
+class BLUEZQT_EXPORT CallScheduler : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int maxInFlightPerAdapter READ maxInFlightPerAdapter WRITE setMaxInFlightPerAdapter)
+    Q_PROPERTY(int interactiveBurst READ interactiveBurst WRITE setInteractiveBurst)
+    Q_PROPERTY(int inFlightCount READ inFlightCount)
+
+public:
+    /**
+     * Priority of calls.
+     */
+    enum Priority {
+        /** Calls triggered directly by user. */
+        Interactive = 0,
+        /** Bulk and maintenance calls. */
+        Background = 1
+    };
+    Q_ENUM(Priority)
+
+    /**
+     * Creates a new CallScheduler object.
+     *
+     * @param parent
+     */
+    explicit CallScheduler(QObject *parent = nullptr);
+
+    /**
+     * Destroys a CallScheduler object.
+     *
+     * All still queued calls are sent immediately.
+     */
+    ~CallScheduler();
+
+    /**
+     * Returns the maximum number of calls per adapter waiting for reply.
+     *
+     * @return maximum number of in-flight calls
+     */
+    int maxInFlightPerAdapter() const;
+
+    /**
+     * Sets the maximum number of calls per adapter waiting for reply.
+     *
+     * Default value is 2.
+     *
+     * @param count maximum number of in-flight calls (at least 1)
+     */
+    void setMaxInFlightPerAdapter(int count);
+
+    /**
+     * Returns the number of interactive calls sent in a row while background calls are waiting.
+     *
+     * @return interactive burst
+     */
+    int interactiveBurst() const;
+
+    /**
+     * Sets the number of interactive calls sent in a row while background calls are waiting.
+     *
+     * Default value is 4.
+     *
+     * @param count interactive burst (at least 1)
+     */
+    void setInteractiveBurst(int count);
+
+    /**
+     * Returns the number of queued calls.
+     *
+     * @param priority lane
+     * @return number of queued calls
+     */
+    int queueDepth(Priority priority) const;
+
+    /**
+     * Returns the number of calls waiting for reply.
+     *
+     * @return number of in-flight calls
+     */
+    int inFlightCount() const;
+
+    /**
+     * Returns the number of calls sent since last resetMetrics().
+     *
+     * @param priority lane
+     * @return number of sent calls
+     */
+    int dispatchedCount(Priority priority) const;
+
+    /**
+     * Returns the average time calls spent in the queue since last resetMetrics().
+     *
+     * @param priority lane
+     * @return average wait time in milliseconds
+     */
+    int averageWaitTime(Priority priority) const;
+
+    /**
+     * Returns the longest time a call spent in the queue since last resetMetrics().
+     *
+     * @param priority lane
+     * @return maximum wait time in milliseconds
+     */
+    int maximumWaitTime(Priority priority) const;
+
+    /**
+     * Resets the dispatch and wait time metrics.
+     */
+    void resetMetrics();
+
+private:
+    class CallSchedulerPrivate *const d;
+
+    friend class CallSchedulerPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_CALLSCHEDULER_H
@@ -0,0 +1,103 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_CALLSCHEDULER_P_H
+#define BLUEZQT_CALLSCHEDULER_P_H
+
+#include <functional>
+
+#include <QHash>
+#include <QQueue>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QDBusPendingCall>
+
+#include "callscheduler.h"
+
+namespace BluezQt
+{
+
+class PendingCall;
+
+typedef std::function<QDBusPendingCall()> CallStarter;
+
+class CallSchedulerPrivate
+{
+public:
+    explicit CallSchedulerPrivate(CallScheduler *q);
+
+    // Creates a call that is either sent immediately or queued in installed scheduler
+    static PendingCall *createCall(const QString &path, CallScheduler::Priority priority,
+                                   const CallStarter &starter, QObject *parent);
+    // Same for calls created by caller, eg. PendingReply
+    static void scheduleCall(PendingCall *call, const QString &path, CallScheduler::Priority priority,
+                             const CallStarter &starter);
+    static void startNow(PendingCall *call);
+
+    static CallScheduler *instance();
+    static void setInstance(CallScheduler *scheduler);
+
+    struct QueuedCall
+    {
+        QPointer<PendingCall> call;
+        CallStarter starter;
+        QElapsedTimer waitTimer;
+    };
+
+    struct Lane
+    {
+        Lane();
+
+        QQueue<QueuedCall> queues[2];
+        int inFlight;
+        int interactiveStreak;
+    };
+
+    struct Metrics
+    {
+        Metrics();
+
+        int dispatched;
+        qint64 totalWait;
+        qint64 maxWait;
+    };
+
+    void enqueue(const QString &path, CallScheduler::Priority priority, PendingCall *call, const CallStarter &starter);
+    void dispatch(const QString &laneName);
+    bool takeNext(Lane &lane, QueuedCall *next, CallScheduler::Priority *priority);
+    void startCall(const QString &laneName, QueuedCall &queued, CallScheduler::Priority priority);
+    void callDone(QObject *call);
+    void flush();
+
+    static bool isAlive(const QueuedCall &queued);
+
+    CallScheduler *q;
+    QHash<QString, Lane> m_lanes;
+    QHash<QObject*, QString> m_inFlight;
+    int m_maxInFlight;
+    int m_interactiveBurst;
+    Metrics m_metrics[2];
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_CALLSCHEDULER_P_H
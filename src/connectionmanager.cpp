@@ -0,0 +1,297 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "connectionmanager.h"
+#include "connectionmanager_p.h"
+#include "connectjob.h"
+#include "connectjob_p.h"
+#include "device.h"
+#include "adapter.h"
+#include "adapterselector.h"
+#include "pendingcall.h"
+#include "utils.h"
+#include "debug.h"
+
+#include <QTimer>
+
+namespace BluezQt
+{
+
+ConnectionManagerPrivate::ConnectionManagerPrivate(ConnectionManager *q)
+    : QObject()
+    , q(q)
+    , m_maxAttempts(1)
+    , m_maxRetries(3)
+    , m_initialBackoff(500)
+    , m_maximumBackoff(8000)
+    , m_jitter(0.3)
+{
+}
+
+void ConnectionManagerPrivate::enqueue(ConnectJob *job)
+{
+    const QString &key = requestKey(job->d->m_device, job->d->m_uuid);
+
+    // Share the attempt with already queued request for the same device
+    RequestPtr request = m_requests.value(key);
+    if (request) {
+        request->jobs.append(job);
+        return;
+    }
+
+    request = RequestPtr(new Request);
+    request->device = job->d->m_device;
+    request->uuid = job->d->m_uuid;
+    request->adapter = request->device->adapter() ? request->device->adapter()->ubi() : QString();
+    request->jobs.append(job);
+    request->attempts = 0;
+    request->timer.start();
+
+    m_requests.insert(key, request);
+    m_queues[request->adapter].enqueue(request);
+    dispatch(request->adapter);
+}
+
+void ConnectionManagerPrivate::dispatch(const QString &adapter)
+{
+    QQueue<RequestPtr> &queue = m_queues[adapter];
+
+    while (!queue.isEmpty() && m_inFlight.value(adapter) < m_maxAttempts) {
+        const RequestPtr &request = queue.dequeue();
+
+        // All jobs were killed while waiting in the queue
+        if (!hasJobs(request)) {
+            m_requests.remove(requestKey(request->device, request->uuid));
+            if (m_selector) {
+                m_selector->release(request->device);
+            }
+            continue;
+        }
+
+        m_inFlight[adapter]++;
+        startAttempt(request);
+    }
+}
+
+void ConnectionManagerPrivate::startAttempt(const RequestPtr &request)
+{
+    request->attempts++;
+
+    PendingCall *call = request->uuid.isEmpty()
+            ? request->device->connectToDevice()
+            : request->device->connectProfile(request->uuid);
+
+    connect(call, &PendingCall::finished, this, [this, request](PendingCall *finishedCall) {
+        attemptFinished(request, finishedCall->error(), finishedCall->errorText());
+    });
+}
+
+void ConnectionManagerPrivate::attemptFinished(const RequestPtr &request, int error, const QString &errorText)
+{
+    if (error == PendingCall::AlreadyConnected) {
+        error = PendingCall::NoError;
+    }
+
+    if (Retry::isRetryable(error) && request->attempts <= m_maxRetries && hasJobs(request)) {
+        const int delay = Retry::backoffDelay(request->attempts - 1, m_initialBackoff, m_maximumBackoff, m_jitter);
+
+        qCDebug(BLUEZQT) << "ConnectionManager: Retrying" << request->device->ubi() << "in" << delay << "ms";
+
+        // Waiting request keeps its adapter slot, other requests don't overtake it
+        QTimer::singleShot(delay, this, [this, request, error, errorText]() {
+            if (hasJobs(request)) {
+                startAttempt(request);
+            } else {
+                attemptFinished(request, error, errorText);
+            }
+        });
+        return;
+    }
+
+    finishRequest(request, error, errorText);
+
+    m_inFlight[request->adapter]--;
+    dispatch(request->adapter);
+}
+
+void ConnectionManagerPrivate::finishRequest(const RequestPtr &request, int error, const QString &errorText)
+{
+    m_requests.remove(requestKey(request->device, request->uuid));
+
+    if (m_selector) {
+        m_selector->release(request->device);
+    }
+
+    const int latency = request->timer.elapsed();
+    m_latencies.insert(request->device->ubi(), latency);
+
+    Q_FOREACH (const QPointer<ConnectJob> &job, request->jobs) {
+        if (!job) {
+            continue;
+        }
+        job->d->m_attempts = request->attempts;
+        job->d->m_latency = latency;
+        job->d->m_callError = error;
+        if (error != PendingCall::NoError) {
+            job->setError(Job::UserDefinedError);
+            job->setErrorText(errorText);
+        }
+        job->emitResult();
+    }
+
+    Q_EMIT q->connectFinished(request->device, error, latency);
+}
+
+QString ConnectionManagerPrivate::requestKey(const DevicePtr &device, const QString &uuid)
+{
+    return device->ubi() + QLatin1Char('|') + uuid.toUpper();
+}
+
+bool ConnectionManagerPrivate::hasJobs(const RequestPtr &request)
+{
+    Q_FOREACH (const QPointer<ConnectJob> &job, request->jobs) {
+        if (job && job->isRunning()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ConnectionManager::ConnectionManager(QObject *parent)
+    : QObject(parent)
+    , d(new ConnectionManagerPrivate(this))
+{
+}
+
+ConnectionManager::~ConnectionManager()
+{
+    if (d->m_selector) {
+        Q_FOREACH (const ConnectionManagerPrivate::RequestPtr &request, d->m_requests) {
+            d->m_selector->release(request->device);
+        }
+    }
+
+    // Running jobs are deleted with the manager, ~ConnectJob() reports them as failed
+    delete d;
+}
+
+int ConnectionManager::maxAttemptsPerAdapter() const
+{
+    return d->m_maxAttempts;
+}
+
+void ConnectionManager::setMaxAttemptsPerAdapter(int count)
+{
+    d->m_maxAttempts = qMax(1, count);
+
+    const QStringList adapters = d->m_queues.keys();
+    Q_FOREACH (const QString &adapter, adapters) {
+        d->dispatch(adapter);
+    }
+}
+
+int ConnectionManager::maxRetries() const
+{
+    return d->m_maxRetries;
+}
+
+void ConnectionManager::setMaxRetries(int count)
+{
+    d->m_maxRetries = qMax(0, count);
+}
+
+int ConnectionManager::initialBackoff() const
+{
+    return d->m_initialBackoff;
+}
+
+void ConnectionManager::setInitialBackoff(int msecs)
+{
+    d->m_initialBackoff = qMax(0, msecs);
+}
+
+int ConnectionManager::maximumBackoff() const
+{
+    return d->m_maximumBackoff;
+}
+
+void ConnectionManager::setMaximumBackoff(int msecs)
+{
+    d->m_maximumBackoff = qMax(0, msecs);
+}
+
+qreal ConnectionManager::jitter() const
+{
+    return d->m_jitter;
+}
+
+void ConnectionManager::setJitter(qreal jitter)
+{
+    d->m_jitter = qBound<qreal>(0.0, jitter, 1.0);
+}
+
+AdapterSelector *ConnectionManager::adapterSelector() const
+{
+    return d->m_selector;
+}
+
+void ConnectionManager::setAdapterSelector(AdapterSelector *selector)
+{
+    d->m_selector = selector;
+}
+
+int ConnectionManager::pendingCount() const
+{
+    return d->m_requests.count();
+}
+
+int ConnectionManager::lastLatency(DevicePtr device) const
+{
+    if (!device) {
+        return -1;
+    }
+    return d->m_latencies.value(device->ubi(), -1);
+}
+
+ConnectJob *ConnectionManager::connectToDevice(DevicePtr device)
+{
+    return new ConnectJob(device, QString(), this);
+}
+
+ConnectJob *ConnectionManager::connectToAddress(const QString &address)
+{
+    DevicePtr device;
+    if (d->m_selector) {
+        device = d->m_selector->selectDevice(address);
+    }
+
+    ConnectJob *job = new ConnectJob(device, QString(), this);
+    job->d->m_selector = d->m_selector;
+    return job;
+}
+
+ConnectJob *ConnectionManager::connectProfile(DevicePtr device, const QString &uuid)
+{
+    return new ConnectJob(device, uuid, this);
+}
+
+} // namespace BluezQt
@@ -0,0 +1,260 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_CONNECTIONMANAGER_H
+#define BLUEZQT_CONNECTIONMANAGER_H
+
+#include <QObject>
+
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class ConnectJob;
+class AdapterSelector;
+
+/**
+ * @class BluezQt::ConnectionManager connectionmanager.h <BluezQt/ConnectionManager>
+ *
+ * Connection manager.
+ *
+ * bluetoothd rejects concurrent connection attempts on one controller.
+ * ConnectionManager queues connection requests per adapter and only runs
+ * maxAttemptsPerAdapter() attempts at the same time.
+ *
+ * Attempts that fail with PendingCall::ConnectionAttemptFailed, PendingCall::NotReady
+ * or PendingCall::InProgress are retried with exponential backoff up to maxRetries() times.
+ * The delays are randomized by jitter(), so requests failed at the same time are spread out.
+ * PendingCall::AlreadyConnected error is treated as success.
+ *
+ * Concurrent requests for the same device (and profile) are deduplicated,
+ * all of their jobs finish with the result of one shared connection attempt.
+ *
+ * With multiple adapters, connectToAddress() uses AdapterSelector to choose
+ * the adapter through which the device is connected.
+ *
+ * Example use:
+ * @code
+ * BluezQt::ConnectJob *job = connectionManager->connectToDevice(device);
+ * connect(job, &BluezQt::ConnectJob::result, this, [](BluezQt::ConnectJob *job) {
+ *     qDebug() << "Connected:" << !job->error() << "in" << job->latency() << "ms";
+ * });
+ * job->start();
+ * @endcode
+ */
+class BLUEZQT_EXPORT ConnectionManager : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int maxAttemptsPerAdapter READ maxAttemptsPerAdapter WRITE setMaxAttemptsPerAdapter)
+    Q_PROPERTY(int maxRetries READ maxRetries WRITE setMaxRetries)
+    Q_PROPERTY(int initialBackoff READ initialBackoff WRITE setInitialBackoff)
+    Q_PROPERTY(int maximumBackoff READ maximumBackoff WRITE setMaximumBackoff)
+    Q_PROPERTY(qreal jitter READ jitter WRITE setJitter)
+    Q_PROPERTY(int pendingCount READ pendingCount)
+
+public:
+    /**
+     * Creates a new ConnectionManager object.
+     *
+     * @param parent
+     */
+    explicit ConnectionManager(QObject *parent = nullptr);
+
+    /**
+     * Destroys a ConnectionManager object.
+     *
+     * All unfinished jobs finish with error.
+     */
+    ~ConnectionManager();
+
+    /**
+     * Returns the maximum number of concurrent connection attempts per adapter.
+     *
+     * @return maximum number of attempts
+     */
+    int maxAttemptsPerAdapter() const;
+
+    /**
+     * Sets the maximum number of concurrent connection attempts per adapter.
+     *
+     * Default value is 1, meaning attempts are serialized.
+     *
+     * @param count maximum number of attempts (at least 1)
+     */
+    void setMaxAttemptsPerAdapter(int count);
+
+    /**
+     * Returns the maximum number of retries of failed attempt.
+     *
+     * @return maximum number of retries
+     */
+    int maxRetries() const;
+
+    /**
+     * Sets the maximum number of retries of failed attempt.
+     *
+     * Default value is 3.
+     *
+     * @param count maximum number of retries
+     */
+    void setMaxRetries(int count);
+
+    /**
+     * Returns the delay before first retry.
+     *
+     * @return delay in milliseconds
+     */
+    int initialBackoff() const;
+
+    /**
+     * Sets the delay before first retry.
+     *
+     * The delay is doubled with each following retry.
+     * Default value is 500 milliseconds.
+     *
+     * @param msecs delay in milliseconds
+     */
+    void setInitialBackoff(int msecs);
+
+    /**
+     * Returns the maximum delay between retries.
+     *
+     * @return delay in milliseconds
+     */
+    int maximumBackoff() const;
+
+    /**
+     * Sets the maximum delay between retries.
+     *
+     * Default value is 8000 milliseconds.
+     *
+     * @param msecs delay in milliseconds
+     */
+    void setMaximumBackoff(int msecs);
+
+    /**
+     * Returns the jitter of retry delays.
+     *
+     * @return jitter
+     */
+    qreal jitter() const;
+
+    /**
+     * Sets the jitter of retry delays.
+     *
+     * Each delay is randomly changed by up to this fraction of its value.
+     * Default value is 0.3.
+     *
+     * @param jitter jitter in range 0.0 - 1.0
+     */
+    void setJitter(qreal jitter);
+
+    /**
+     * Returns the adapter selector.
+     *
+     * @return adapter selector
+     */
+    AdapterSelector *adapterSelector() const;
+
+    /**
+     * Sets the adapter selector.
+     *
+     * The selector is used by connectToAddress(). The selector is not owned by the manager.
+     *
+     * @param selector adapter selector
+     */
+    void setAdapterSelector(AdapterSelector *selector);
+
+    /**
+     * Returns the number of devices with unfinished connection requests.
+     *
+     * @return number of pending requests
+     */
+    int pendingCount() const;
+
+    /**
+     * Returns the latency of last finished connection request of the device.
+     *
+     * @param device device
+     * @return latency in milliseconds, -1 if there was no request
+     */
+    int lastLatency(DevicePtr device) const;
+
+    /**
+     * Creates a job that connects all auto-connectable profiles of the device.
+     *
+     * The job needs to be started with Job::start().
+     *
+     * @param device device to connect
+     * @return connect job
+     * @see Device::connectToDevice()
+     */
+    ConnectJob *connectToDevice(DevicePtr device);
+
+    /**
+     * Creates a job that connects the remote device through adapter chosen by adapterSelector().
+     *
+     * The job fails if no adapter selector is set or no powered adapter knows the device.
+     * The device stays pending in the selector until the job finishes, is killed or deleted.
+     * The job needs to be started with Job::start().
+     *
+     * @param address address of remote device
+     * @return connect job
+     * @see AdapterSelector::selectDevice()
+     */
+    ConnectJob *connectToAddress(const QString &address);
+
+    /**
+     * Creates a job that connects the profile of the device.
+     *
+     * The job needs to be started with Job::start().
+     *
+     * @param device device to connect
+     * @param uuid service UUID
+     * @return connect job
+     * @see Device::connectProfile()
+     */
+    ConnectJob *connectProfile(DevicePtr device, const QString &uuid);
+
+Q_SIGNALS:
+    /**
+     * Indicates that a connection request of the device have finished.
+     *
+     * @param device device
+     * @param error PendingCall::Error of last attempt
+     * @param latency time from queuing the request until it finished in milliseconds
+     */
+    void connectFinished(DevicePtr device, int error, int latency);
+
+private:
+    class ConnectionManagerPrivate *const d;
+
+    friend class ConnectionManagerPrivate;
+    friend class ConnectJob;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_CONNECTIONMANAGER_H
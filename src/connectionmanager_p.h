@@ -0,0 +1,83 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_CONNECTIONMANAGER_P_H
+#define BLUEZQT_CONNECTIONMANAGER_P_H
+
+#include <QHash>
+#include <QQueue>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QSharedPointer>
+
+#include "types.h"
+
+namespace BluezQt
+{
+
+class ConnectJob;
+class ConnectionManager;
+class AdapterSelector;
+
+class ConnectionManagerPrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Request
+    {
+        DevicePtr device;
+        QString uuid;
+        QString adapter;
+        QList<QPointer<ConnectJob> > jobs;
+        QElapsedTimer timer;
+        int attempts;
+    };
+    typedef QSharedPointer<Request> RequestPtr;
+
+    explicit ConnectionManagerPrivate(ConnectionManager *q);
+
+    void enqueue(ConnectJob *job);
+    void dispatch(const QString &adapter);
+    void startAttempt(const RequestPtr &request);
+    void attemptFinished(const RequestPtr &request, int error, const QString &errorText);
+    void finishRequest(const RequestPtr &request, int error, const QString &errorText);
+
+    static QString requestKey(const DevicePtr &device, const QString &uuid);
+    static bool hasJobs(const RequestPtr &request);
+
+    ConnectionManager *q;
+    QHash<QString, RequestPtr> m_requests;
+    QHash<QString, QQueue<RequestPtr> > m_queues;
+    QHash<QString, int> m_inFlight;
+    QHash<QString, int> m_latencies;
+    QPointer<AdapterSelector> m_selector;
+    int m_maxAttempts;
+    int m_maxRetries;
+    int m_initialBackoff;
+    int m_maximumBackoff;
+    qreal m_jitter;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_CONNECTIONMANAGER_P_H
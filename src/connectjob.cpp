@@ -0,0 +1,113 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "connectjob.h"
+#include "connectjob_p.h"
+#include "connectionmanager.h"
+#include "connectionmanager_p.h"
+#include "adapterselector.h"
+#include "pendingcall.h"
+#include "debug.h"
+
+namespace BluezQt
+{
+
+ConnectJobPrivate::ConnectJobPrivate(const DevicePtr &device, const QString &uuid, ConnectionManager *manager)
+    : m_device(device)
+    , m_uuid(uuid)
+    , m_manager(manager)
+    , m_attempts(0)
+    , m_latency(0)
+    , m_callError(PendingCall::NoError)
+{
+}
+
+ConnectJob::ConnectJob(const DevicePtr &device, const QString &uuid, ConnectionManager *manager)
+    : Job(manager)
+    , d(new ConnectJobPrivate(device, uuid, manager))
+{
+}
+
+ConnectJob::~ConnectJob()
+{
+    if (isRunning()) {
+        qCWarning(BLUEZQT) << "ConnectJob Error: Job was deleted before finished!";
+
+        d->m_callError = PendingCall::InternalError;
+        setError(UserDefinedError);
+        setErrorText(QStringLiteral("Job was deleted before finished."));
+        emitResult();
+    }
+
+    // Device selected by connectToAddress() was never handed over to the manager
+    if (d->m_selector) {
+        d->m_selector->release(d->m_device);
+    }
+    delete d;
+}
+
+DevicePtr ConnectJob::device() const
+{
+    return d->m_device;
+}
+
+QString ConnectJob::uuid() const
+{
+    return d->m_uuid;
+}
+
+int ConnectJob::attempts() const
+{
+    return d->m_attempts;
+}
+
+int ConnectJob::latency() const
+{
+    return d->m_latency;
+}
+
+int ConnectJob::callError() const
+{
+    return d->m_callError;
+}
+
+void ConnectJob::doStart()
+{
+    if (!d->m_manager || !d->m_device) {
+        d->m_callError = PendingCall::InternalError;
+        setError(UserDefinedError);
+        setErrorText(QStringLiteral("Invalid device"));
+        emitResult();
+        return;
+    }
+
+    // The manager releases the selected device when the request finishes
+    d->m_selector.clear();
+    d->m_manager->d->enqueue(this);
+}
+
+void ConnectJob::doEmitResult()
+{
+    Q_EMIT result(this);
+}
+
+} // namespace BluezQt
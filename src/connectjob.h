@@ -0,0 +1,118 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_CONNECTJOB_H
+#define BLUEZQT_CONNECTJOB_H
+
+#include <QObject>
+
+#include "job.h"
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class ConnectionManager;
+
+/**
+ * @class BluezQt::ConnectJob connectjob.h <BluezQt/ConnectJob>
+ *
+ * Connect job.
+ *
+ * This class represents a connection request queued in ConnectionManager.
+ *
+ * If the connection could not be established, error() is UserDefinedError
+ * and callError() returns the error of the last connection attempt.
+ */
+class BLUEZQT_EXPORT ConnectJob : public Job
+{
+    Q_OBJECT
+    Q_PROPERTY(DevicePtr device READ device)
+    Q_PROPERTY(QString uuid READ uuid)
+    Q_PROPERTY(int attempts READ attempts)
+    Q_PROPERTY(int latency READ latency)
+    Q_PROPERTY(int callError READ callError)
+
+public:
+    /**
+     * Destroys a ConnectJob object.
+     */
+    ~ConnectJob() override;
+
+    /**
+     * Returns a device that is being connected.
+     *
+     * @return device
+     */
+    DevicePtr device() const;
+
+    /**
+     * Returns UUID of profile that is being connected.
+     *
+     * @return profile UUID, empty when connecting all profiles
+     */
+    QString uuid() const;
+
+    /**
+     * Returns the number of connection attempts.
+     *
+     * @return number of attempts
+     */
+    int attempts() const;
+
+    /**
+     * Returns the time from queuing the request until it finished.
+     *
+     * @return latency in milliseconds
+     */
+    int latency() const;
+
+    /**
+     * Returns an error of the last connection attempt.
+     *
+     * @return PendingCall::Error of last attempt
+     */
+    int callError() const;
+
+Q_SIGNALS:
+    /**
+     * Indicates that the job have finished.
+     */
+    void result(ConnectJob *job);
+
+private:
+    explicit ConnectJob(const DevicePtr &device, const QString &uuid, ConnectionManager *manager);
+
+    void doStart() override;
+    void doEmitResult() override;
+
+    class ConnectJobPrivate *const d;
+
+    friend class ConnectJobPrivate;
+    friend class ConnectionManager;
+    friend class ConnectionManagerPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_CONNECTJOB_H
@@ -0,0 +1,449 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_COROUTINES_H
+#define BLUEZQT_COROUTINES_H
+
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "BluezQt/Coroutines requires a C++20 compiler with coroutine support"
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <QObject>
+
+#include "pendingcall.h"
+#include "pendingreply.h"
+#include "initmanagerjob.h"
+#include "initobexmanagerjob.h"
+#include "batchjob.h"
+
+/**
+ * @file coroutines.h <BluezQt/Coroutines>
+ *
+ * C++20 coroutine support.
+ *
+ * This header provides Task, a coroutine return type. Inside a Task coroutine,
+ * PendingCall, PendingReply, InitManagerJob, InitObexManagerJob and BatchJob pointers can be
+ * awaited with co_await. Jobs that were not started yet are started automatically.
+ *
+ * Awaiting never starts a nested event loop. The coroutine is suspended and resumed
+ * directly from the finished() (or result()) signal, that is from the event loop of the
+ * thread the awaited object lives in.
+ *
+ * Example use:
+ * @code
+ * BluezQt::Task<bool> Connector::connectHeadset(BluezQt::DevicePtr device)
+ * {
+ *     BluezQt::PendingCall *call = co_await device->connectToDevice();
+ *     if (!call || call->error()) {
+ *         co_return false;
+ *     }
+ *     call = co_await device->connectProfile(headsetUuid);
+ *     co_return call && !call->error();
+ * }
+ * @endcode
+ *
+ * The awaited object is returned from co_await. It stays valid until control
+ * returns to the event loop, after that it is deleted as usual.
+ * If the awaited object is destroyed before it finishes (eg. when its parent is deleted
+ * or the job is killed), co_await returns nullptr.
+ *
+ * @note This header requires C++20 and is not used by the library itself.
+ */
+
+namespace BluezQt
+{
+
+template<typename T = void>
+class Task;
+
+namespace Detail
+{
+
+inline QMetaObject::Connection connectFinished(PendingCall *call, const std::function<void()> &slot)
+{
+    return QObject::connect(call, &PendingCall::finished, slot);
+}
+
+inline QMetaObject::Connection connectFinished(InitManagerJob *job, const std::function<void()> &slot)
+{
+    return QObject::connect(job, &InitManagerJob::result, slot);
+}
+
+inline QMetaObject::Connection connectFinished(InitObexManagerJob *job, const std::function<void()> &slot)
+{
+    return QObject::connect(job, &InitObexManagerJob::result, slot);
+}
+
+inline QMetaObject::Connection connectFinished(BatchJob *job, const std::function<void()> &slot)
+{
+    return QObject::connect(job, &BatchJob::result, slot);
+}
+
+inline void startIfNeeded(PendingCall *call)
+{
+    Q_UNUSED(call)
+}
+
+inline void startIfNeeded(Job *job)
+{
+    if (!job->isRunning() && !job->isFinished()) {
+        job->start();
+    }
+}
+
+/**
+ * Awaiter for objects that finish by emitting a signal.
+ *
+ * The connections are removed when the awaiter is destroyed, so destroying
+ * a suspended coroutine never resumes it.
+ */
+template<typename T>
+class ObjectAwaiter
+{
+public:
+    explicit ObjectAwaiter(T *object)
+        : m_object(object)
+    {
+    }
+
+    ObjectAwaiter(const ObjectAwaiter &) = delete;
+    ObjectAwaiter &operator=(const ObjectAwaiter &) = delete;
+
+    ~ObjectAwaiter()
+    {
+        disconnect();
+    }
+
+    bool await_ready() const noexcept
+    {
+        return !m_object;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_finished = connectFinished(m_object, [this, handle]() {
+            disconnect();
+            handle.resume();
+        });
+        m_destroyed = QObject::connect(m_object, &QObject::destroyed, [this, handle]() {
+            m_object = nullptr;
+            disconnect();
+            handle.resume();
+        });
+        startIfNeeded(m_object);
+    }
+
+    T *await_resume() const noexcept
+    {
+        return m_object;
+    }
+
+private:
+    void disconnect()
+    {
+        QObject::disconnect(m_finished);
+        QObject::disconnect(m_destroyed);
+    }
+
+    T *m_object;
+    QMetaObject::Connection m_finished;
+    QMetaObject::Connection m_destroyed;
+};
+
+class TaskFinalAwaiter
+{
+public:
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template<typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+    {
+        if (handle.promise().m_continuation) {
+            return handle.promise().m_continuation;
+        }
+        return std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+};
+
+class TaskPromiseBase
+{
+public:
+    std::suspend_never initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    TaskFinalAwaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception()
+    {
+        std::terminate();
+    }
+
+    ObjectAwaiter<PendingCall> await_transform(PendingCall *call)
+    {
+        return ObjectAwaiter<PendingCall>(call);
+    }
+
+    template<typename T>
+    auto await_transform(PendingReply<T> *reply)
+    {
+        class ReplyAwaiter : public ObjectAwaiter<PendingCall>
+        {
+        public:
+            using ObjectAwaiter<PendingCall>::ObjectAwaiter;
+
+            PendingReply<T> *await_resume() const noexcept
+            {
+                return static_cast<PendingReply<T>*>(ObjectAwaiter<PendingCall>::await_resume());
+            }
+        };
+
+        return ReplyAwaiter(reply);
+    }
+
+    ObjectAwaiter<InitManagerJob> await_transform(InitManagerJob *job)
+    {
+        return ObjectAwaiter<InitManagerJob>(job);
+    }
+
+    ObjectAwaiter<InitObexManagerJob> await_transform(InitObexManagerJob *job)
+    {
+        return ObjectAwaiter<InitObexManagerJob>(job);
+    }
+
+    ObjectAwaiter<BatchJob> await_transform(BatchJob *job)
+    {
+        return ObjectAwaiter<BatchJob>(job);
+    }
+
+    // Other awaitables (eg. Task) are awaited unchanged
+    template<typename Awaitable, typename = std::enable_if_t<!std::is_pointer_v<std::remove_reference_t<Awaitable> > > >
+    Awaitable &&await_transform(Awaitable &&awaitable) noexcept
+    {
+        return std::forward<Awaitable>(awaitable);
+    }
+
+    std::coroutine_handle<> m_continuation;
+};
+
+template<typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+    Task<T> get_return_object();
+
+    void return_value(T value)
+    {
+        m_value = std::move(value);
+    }
+
+    T takeValue()
+    {
+        Q_ASSERT(m_value);
+        return std::move(*m_value);
+    }
+
+private:
+    std::optional<T> m_value;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    Task<void> get_return_object();
+
+    void return_void()
+    {
+    }
+
+    void takeValue()
+    {
+    }
+};
+
+} // namespace Detail
+
+/**
+ * @class BluezQt::Task coroutines.h <BluezQt/Coroutines>
+ *
+ * Coroutine task.
+ *
+ * Return type for coroutines awaiting BluezQt calls and jobs.
+ * Only coroutines returning Task can co_await PendingCall and job pointers.
+ *
+ * The coroutine starts executing immediately when called and runs until
+ * the first co_await that needs to wait. A Task can itself be awaited from
+ * another coroutine to get its result.
+ *
+ * Destroying a Task that has not finished yet cancels the coroutine: it is never
+ * resumed again and all its local variables (including awaited Tasks) are destroyed.
+ * Pending calls that are already running are not aborted, their results are just ignored.
+ *
+ * Awaiting a Task that was moved from or cancelled returns a default constructed value.
+ */
+template<typename T>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = Detail::TaskPromise<T>;
+
+    /**
+     * Creates a new Task object by moving other task.
+     */
+    Task(Task &&other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    Task &operator=(Task &&other) noexcept
+    {
+        if (this != &other) {
+            cancel();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    /**
+     * Destroys a Task object.
+     *
+     * Unfinished coroutine is cancelled.
+     */
+    ~Task()
+    {
+        cancel();
+    }
+
+    /**
+     * Returns whether the coroutine have finished.
+     *
+     * @return true if coroutine finished or was cancelled
+     */
+    bool isFinished() const
+    {
+        return !m_handle || m_handle.done();
+    }
+
+    /**
+     * Cancels the coroutine.
+     *
+     * It must not be called from inside the coroutine itself.
+     */
+    void cancel()
+    {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+    auto operator co_await() const noexcept
+    {
+        class Awaiter
+        {
+        public:
+            explicit Awaiter(std::coroutine_handle<promise_type> handle)
+                : m_handle(handle)
+            {
+            }
+
+            bool await_ready() const noexcept
+            {
+                return !m_handle || m_handle.done();
+            }
+
+            void await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                m_handle.promise().m_continuation = continuation;
+            }
+
+            T await_resume()
+            {
+                // Moved-from or cancelled task has no promise to take the value from
+                if constexpr (std::is_void_v<T> || std::is_default_constructible_v<T>) {
+                    if (!m_handle) {
+                        return T();
+                    }
+                }
+                Q_ASSERT(m_handle);
+                return m_handle.promise().takeValue();
+            }
+
+        private:
+            std::coroutine_handle<promise_type> m_handle;
+        };
+
+        return Awaiter(m_handle);
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+
+    friend promise_type;
+};
+
+namespace Detail
+{
+
+template<typename T>
+inline Task<T> TaskPromise<T>::get_return_object()
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T> >::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object()
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void> >::from_promise(*this));
+}
+
+} // namespace Detail
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_COROUTINES_H
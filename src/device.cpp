@@ -23,6 +23,8 @@
 #include "device.h"
 #include "device_p.h"
 #include "pendingcall.h"
+#include "callscheduler_p.h"
+#include "gattservice.h"
 #include "utils.h"
 
 namespace BluezQt
@@ -61,19 +63,14 @@ QString Device::name() const
 
 PendingCall *Device::setName(const QString &name)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Alias"), name),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Background, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Alias"), name));
+    }, this);
 }
 
 QString Device::friendlyName() const
 {
-    if (name().isEmpty() || name() == remoteName()) {
-        return name();
-    }
-    if (remoteName().isEmpty()) {
-        return name();
-    }
-    return QStringLiteral("%1 (%2)").arg(name(), remoteName());
+    return d->m_friendlyName;
 }
 
 QString Device::remoteName() const
@@ -88,11 +85,7 @@ quint32 Device::deviceClass() const
 
 Device::Type Device::type() const
 {
-    if (deviceClass() == 0) {
-        return appearanceToType(appearance());
-    }
-
-    return classToType(d->m_deviceClass);
+    return d->m_type;
 }
 
 quint16 Device::appearance() const
@@ -124,8 +117,9 @@ bool Device::isTrusted() const
 
 PendingCall *Device::setTrusted(bool trusted)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Trusted"), trusted),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Background, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Trusted"), trusted));
+    }, this);
 }
 
 bool Device::isBlocked() const
@@ -135,8 +129,9 @@ bool Device::isBlocked() const
 
 PendingCall *Device::setBlocked(bool blocked)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Blocked"), blocked),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Background, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Blocked"), blocked));
+    }, this);
 }
 
 bool Device::hasLegacyPairing() const
@@ -174,11 +169,39 @@ MediaPlayerPtr Device::mediaPlayer() const
     return d->m_mediaPlayer;
 }
 
+QList<GattServicePtr> Device::gattServices() const
+{
+    return d->m_gattServices;
+}
+
+GattServicePtr Device::gattServiceForUuid(const QString &uuid) const
+{
+    const QString &upperUuid = uuid.toUpper();
+
+    Q_FOREACH (GattServicePtr service, d->m_gattServices) {
+        if (service->uuid() == upperUuid) {
+            return service;
+        }
+    }
+    return GattServicePtr();
+}
+
 AdapterPtr Device::adapter() const
 {
     return d->m_adapter;
 }
 
+int Device::callTimeout() const
+{
+    return d->m_bluezDevice->timeout();
+}
+
+void Device::setCallTimeout(int msecs)
+{
+    d->m_bluezDevice->setTimeout(msecs);
+    d->m_dbusProperties->setTimeout(msecs);
+}
+
 QString Device::typeToString(Device::Type type)
 {
     switch (type) {
@@ -267,32 +290,44 @@ Device::Type Device::stringToType(const QString &typeString)
 
 PendingCall *Device::connectToDevice()
 {
-    return new PendingCall(d->m_bluezDevice->Connect(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezDevice->Connect());
+    }, this);
 }
 
 PendingCall *Device::disconnectFromDevice()
 {
-    return new PendingCall(d->m_bluezDevice->Disconnect(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezDevice->Disconnect());
+    }, this);
 }
 
 PendingCall *Device::connectProfile(const QString &uuid)
 {
-    return new PendingCall(d->m_bluezDevice->ConnectProfile(uuid), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezDevice->ConnectProfile(uuid));
+    }, this);
 }
 
 PendingCall *Device::disconnectProfile(const QString &uuid)
 {
-    return new PendingCall(d->m_bluezDevice->DisconnectProfile(uuid), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezDevice->DisconnectProfile(uuid));
+    }, this);
 }
 
 PendingCall *Device::pair()
 {
-    return new PendingCall(d->m_bluezDevice->Pair(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezDevice->Pair());
+    }, this);
 }
 
 PendingCall *Device::cancelPairing()
 {
-    return new PendingCall(d->m_bluezDevice->CancelPairing(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezDevice->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezDevice->CancelPairing());
+    }, this);
 }
 
 } // namespace BluezQt
@@ -64,6 +64,7 @@ class BLUEZQT_EXPORT Device : public QObject
     Q_PROPERTY(QString modalias READ modalias NOTIFY modaliasChanged)
     Q_PROPERTY(InputPtr input READ input NOTIFY inputChanged)
     Q_PROPERTY(MediaPlayerPtr mediaPlayer READ mediaPlayer NOTIFY mediaPlayerChanged)
+    Q_PROPERTY(QList<GattServicePtr> gattServices READ gattServices)
     Q_PROPERTY(AdapterPtr adapter READ adapter)
 
 public:
@@ -315,6 +316,23 @@ public:
      */
     MediaPlayerPtr mediaPlayer() const;
 
+    /**
+     * Returns a list of GATT services of the device.
+     *
+     * Services are only available for connected LE devices after BlueZ resolves them.
+     *
+     * @return list of GATT services
+     */
+    QList<GattServicePtr> gattServices() const;
+
+    /**
+     * Returns a GATT service for specified UUID.
+     *
+     * @param uuid UUID of service
+     * @return null if there is no service with specified UUID
+     */
+    GattServicePtr gattServiceForUuid(const QString &uuid) const;
+
     /**
      * Returns an adapter that discovered this device.
      *
@@ -322,6 +340,23 @@ public:
      */
     AdapterPtr adapter() const;
 
+    /**
+     * Returns the D-Bus timeout of method calls.
+     *
+     * @return timeout in milliseconds, -1 means the default D-Bus timeout
+     */
+    int callTimeout() const;
+
+    /**
+     * Sets the D-Bus timeout of method calls.
+     *
+     * All following calls on this device that do not get a reply within
+     * the timeout finish with PendingCall::TimedOut error.
+     *
+     * @param msecs timeout in milliseconds, -1 to use the default D-Bus timeout
+     */
+    void setCallTimeout(int msecs);
+
     /**
      * Returns a string for device type.
      *
@@ -508,6 +543,16 @@ Q_SIGNALS:
      */
     void mediaPlayerChanged(MediaPlayerPtr mediaPlayer);
 
+    /**
+     * Indicates that a GATT service was added.
+     */
+    void gattServiceAdded(GattServicePtr service);
+
+    /**
+     * Indicates that a GATT service was removed.
+     */
+    void gattServiceRemoved(GattServicePtr service);
+
 private:
     explicit Device(const QString &path, const QVariantMap &properties, AdapterPtr adapter);
 
@@ -27,6 +27,12 @@
 #include "input_p.h"
 #include "mediaplayer.h"
 #include "mediaplayer_p.h"
+#include "gattservice.h"
+#include "gattservice_p.h"
+#include "gattcharacteristic.h"
+#include "gattcharacteristic_p.h"
+#include "gattdescriptor.h"
+#include "gattdescriptor_p.h"
 #include "utils.h"
 #include "macros.h"
 
@@ -47,6 +53,7 @@ DevicePrivate::DevicePrivate(const QString &path, const QVariantMap &properties,
     , m_rssi(INVALID_RSSI)
     , m_connected(false)
     , m_adapter(adapter)
+    , m_type(Device::Uncategorized)
 {
     m_bluezDevice = new BluezDevice(Strings::orgBluez(), path, DBusConnection::orgBluez(), this);
 
@@ -77,6 +84,9 @@ void DevicePrivate::init(const QVariantMap &properties)
     if (!m_rssi) {
         m_rssi = INVALID_RSSI;
     }
+
+    updateType();
+    updateFriendlyName();
 }
 
 void DevicePrivate::interfacesAdded(const QString &path, const QVariantMapMap &interfaces)
@@ -95,6 +105,12 @@ void DevicePrivate::interfacesAdded(const QString &path, const QVariantMapMap &i
             m_mediaPlayer->d->q = m_mediaPlayer.toWeakRef();
             Q_EMIT q.data()->mediaPlayerChanged(m_mediaPlayer);
             changed = true;
+        } else if (it.key() == Strings::orgBluezGattService1()) {
+            addGattService(path, it.value());
+        } else if (it.key() == Strings::orgBluezGattCharacteristic1()) {
+            addGattCharacteristic(path, it.value());
+        } else if (it.key() == Strings::orgBluezGattDescriptor1()) {
+            addGattDescriptor(path, it.value());
         }
     }
 
@@ -105,7 +121,6 @@ void DevicePrivate::interfacesAdded(const QString &path, const QVariantMapMap &i
 
 void DevicePrivate::interfacesRemoved(const QString &path, const QStringList &interfaces)
 {
-    Q_UNUSED(path)
     bool changed = false;
 
     Q_FOREACH (const QString &interface, interfaces) {
@@ -117,6 +132,10 @@ void DevicePrivate::interfacesRemoved(const QString &path, const QStringList &in
             m_mediaPlayer.clear();
             Q_EMIT q.data()->mediaPlayerChanged(m_mediaPlayer);
             changed = true;
+        } else if (interface == Strings::orgBluezGattService1()
+                   || interface == Strings::orgBluezGattCharacteristic1()
+                   || interface == Strings::orgBluezGattDescriptor1()) {
+            removeGattObject(path, interface);
         }
     }
 
@@ -125,6 +144,132 @@ void DevicePrivate::interfacesRemoved(const QString &path, const QStringList &in
     }
 }
 
+void DevicePrivate::addGattService(const QString &path, const QVariantMap &properties)
+{
+    GattServicePtr service = GattServicePtr(new GattService(path, properties));
+    service->d->q = service.toWeakRef();
+    m_gattServices.append(service);
+
+    Q_EMIT q.data()->gattServiceAdded(service);
+}
+
+void DevicePrivate::addGattCharacteristic(const QString &path, const QVariantMap &properties)
+{
+    // BlueZ announces services before their characteristics
+    GattServicePtr service = gattServiceForPath(path);
+    if (!service) {
+        return;
+    }
+
+    GattCharacteristicPtr characteristic = GattCharacteristicPtr(new GattCharacteristic(path, properties, service));
+    characteristic->d->q = characteristic.toWeakRef();
+    service->d->m_characteristics.append(characteristic);
+
+    Q_EMIT service->characteristicAdded(characteristic);
+}
+
+void DevicePrivate::addGattDescriptor(const QString &path, const QVariantMap &properties)
+{
+    GattCharacteristicPtr characteristic = gattCharacteristicForPath(path);
+    if (!characteristic) {
+        return;
+    }
+
+    GattDescriptorPtr descriptor = GattDescriptorPtr(new GattDescriptor(path, properties, characteristic));
+    descriptor->d->q = descriptor.toWeakRef();
+    characteristic->d->m_descriptors.append(descriptor);
+}
+
+void DevicePrivate::removeGattObject(const QString &path, const QString &interface)
+{
+    if (interface == Strings::orgBluezGattService1()) {
+        for (int i = 0; i < m_gattServices.count(); ++i) {
+            if (m_gattServices.at(i)->ubi() == path) {
+                GattServicePtr service = m_gattServices.takeAt(i);
+                Q_EMIT q.data()->gattServiceRemoved(service);
+                return;
+            }
+        }
+    } else if (interface == Strings::orgBluezGattCharacteristic1()) {
+        GattServicePtr service = gattServiceForPath(path);
+        if (!service) {
+            return;
+        }
+        QList<GattCharacteristicPtr> &characteristics = service->d->m_characteristics;
+        for (int i = 0; i < characteristics.count(); ++i) {
+            if (characteristics.at(i)->ubi() == path) {
+                GattCharacteristicPtr characteristic = characteristics.takeAt(i);
+                Q_EMIT service->characteristicRemoved(characteristic);
+                return;
+            }
+        }
+    } else if (interface == Strings::orgBluezGattDescriptor1()) {
+        GattCharacteristicPtr characteristic = gattCharacteristicForPath(path);
+        if (!characteristic) {
+            return;
+        }
+        QList<GattDescriptorPtr> &descriptors = characteristic->d->m_descriptors;
+        for (int i = 0; i < descriptors.count(); ++i) {
+            if (descriptors.at(i)->ubi() == path) {
+                descriptors.removeAt(i);
+                return;
+            }
+        }
+    }
+}
+
+GattServicePtr DevicePrivate::gattServiceForPath(const QString &path) const
+{
+    Q_FOREACH (GattServicePtr service, m_gattServices) {
+        if (path.startsWith(service->ubi() + QLatin1Char('/'))) {
+            return service;
+        }
+    }
+    return GattServicePtr();
+}
+
+GattCharacteristicPtr DevicePrivate::gattCharacteristicForPath(const QString &path) const
+{
+    GattServicePtr service = gattServiceForPath(path);
+    if (!service) {
+        return GattCharacteristicPtr();
+    }
+
+    Q_FOREACH (GattCharacteristicPtr characteristic, service->characteristics()) {
+        if (path.startsWith(characteristic->ubi() + QLatin1Char('/'))) {
+            return characteristic;
+        }
+    }
+    return GattCharacteristicPtr();
+}
+
+void DevicePrivate::gattPropertiesChanged(const QString &path, const QString &interface, const QVariantMap &changed, const QStringList &invalidated)
+{
+    if (interface == Strings::orgBluezGattCharacteristic1()) {
+        GattServicePtr service = gattServiceForPath(path);
+        if (!service) {
+            return;
+        }
+        Q_FOREACH (GattCharacteristicPtr characteristic, service->characteristics()) {
+            if (characteristic->ubi() == path) {
+                characteristic->d->propertiesChanged(interface, changed, invalidated);
+                return;
+            }
+        }
+    } else if (interface == Strings::orgBluezGattDescriptor1()) {
+        GattCharacteristicPtr characteristic = gattCharacteristicForPath(path);
+        if (!characteristic) {
+            return;
+        }
+        Q_FOREACH (GattDescriptorPtr descriptor, characteristic->descriptors()) {
+            if (descriptor->ubi() == path) {
+                descriptor->d->propertiesChanged(interface, changed, invalidated);
+                return;
+            }
+        }
+    }
+}
+
 QDBusPendingReply<> DevicePrivate::setDBusProperty(const QString &name, const QVariant &value)
 {
     return m_dbusProperties->Set(Strings::orgBluezDevice1(), name, QDBusVariant(value));
@@ -154,7 +299,7 @@ void DevicePrivate::propertiesChanged(const QString &interface, const QVariantMa
         } else if (property == QLatin1String("Class")) {
             classPropertyChanged(value.toUInt());
         } else if (property == QLatin1String("Appearance")) {
-            PROPERTY_CHANGED(m_appearance, toUInt, appearanceChanged);
+            appearancePropertyChanged(value.toUInt());
         } else if (property == QLatin1String("Icon")) {
             PROPERTY_CHANGED(m_icon, toString, iconChanged);
         } else if (property == QLatin1String("Paired")) {
@@ -182,7 +327,7 @@ void DevicePrivate::propertiesChanged(const QString &interface, const QVariantMa
         } else if (property == QLatin1String("Class")) {
             classPropertyChanged(0);
         } else if (property == QLatin1String("Appearance")) {
-            PROPERTY_INVALIDATED(m_appearance, 0, appearanceChanged);
+            appearancePropertyChanged(0);
         } else if (property == QLatin1String("Icon")) {
             PROPERTY_INVALIDATED(m_icon, QString(), iconChanged);
         } else if (property == QLatin1String("RSSI")) {
@@ -202,7 +347,10 @@ void DevicePrivate::namePropertyChanged(const QString &value)
     if (m_name != value) {
         m_name = value;
         Q_EMIT q.data()->remoteNameChanged(m_name);
-        Q_EMIT q.data()->friendlyNameChanged(q.data()->friendlyName());
+
+        if (updateFriendlyName()) {
+            Q_EMIT q.data()->friendlyNameChanged(m_friendlyName);
+        }
     }
 }
 
@@ -219,7 +367,10 @@ void DevicePrivate::aliasPropertyChanged(const QString &value)
     if (m_alias != value) {
         m_alias = value;
         Q_EMIT q.data()->nameChanged(m_alias);
-        Q_EMIT q.data()->friendlyNameChanged(q.data()->friendlyName());
+
+        if (updateFriendlyName()) {
+            Q_EMIT q.data()->friendlyNameChanged(m_friendlyName);
+        }
     }
 }
 
@@ -228,8 +379,51 @@ void DevicePrivate::classPropertyChanged(quint32 value)
     if (m_deviceClass != value) {
         m_deviceClass = value;
         Q_EMIT q.data()->deviceClassChanged(m_deviceClass);
-        Q_EMIT q.data()->typeChanged(q.data()->type());
+
+        if (updateType()) {
+            Q_EMIT q.data()->typeChanged(m_type);
+        }
     }
 }
 
+void DevicePrivate::appearancePropertyChanged(quint16 value)
+{
+    if (m_appearance != value) {
+        m_appearance = value;
+        Q_EMIT q.data()->appearanceChanged(m_appearance);
+
+        if (updateType()) {
+            Q_EMIT q.data()->typeChanged(m_type);
+        }
+    }
+}
+
+bool DevicePrivate::updateType()
+{
+    const Device::Type type = m_deviceClass ? classToType(m_deviceClass) : appearanceToType(m_appearance);
+    if (m_type == type) {
+        return false;
+    }
+
+    m_type = type;
+    return true;
+}
+
+bool DevicePrivate::updateFriendlyName()
+{
+    QString friendlyName;
+    if (m_alias.isEmpty() || m_alias == m_name || m_name.isEmpty()) {
+        friendlyName = m_alias;
+    } else {
+        friendlyName = QStringLiteral("%1 (%2)").arg(m_alias, m_name);
+    }
+
+    if (m_friendlyName == friendlyName) {
+        return false;
+    }
+
+    m_friendlyName = friendlyName;
+    return true;
+}
+
 } // namespace BluezQt
@@ -27,6 +27,7 @@
 #include <QStringList>
 
 #include "types.h"
+#include "device.h"
 #include "bluezdevice1.h"
 #include "dbusproperties.h"
 #include "bluezqt_dbustypes.h"
@@ -49,12 +50,23 @@ public:
     void interfacesAdded(const QString &path, const QVariantMapMap &interfaces);
     void interfacesRemoved(const QString &path, const QStringList &interfaces);
 
+    void addGattService(const QString &path, const QVariantMap &properties);
+    void addGattCharacteristic(const QString &path, const QVariantMap &properties);
+    void addGattDescriptor(const QString &path, const QVariantMap &properties);
+    void removeGattObject(const QString &path, const QString &interface);
+    GattServicePtr gattServiceForPath(const QString &path) const;
+    GattCharacteristicPtr gattCharacteristicForPath(const QString &path) const;
+    void gattPropertiesChanged(const QString &path, const QString &interface, const QVariantMap &changed, const QStringList &invalidated);
+
     QDBusPendingReply<> setDBusProperty(const QString &name, const QVariant &value);
     void propertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated);
     void namePropertyChanged(const QString &value);
     void aliasPropertyChanged(const QString &value);
     void addressPropertyChanged(const QString &value);
     void classPropertyChanged(quint32 value);
+    void appearancePropertyChanged(quint16 value);
+    bool updateType();
+    bool updateFriendlyName();
 
     QWeakPointer<Device> q;
     BluezDevice *m_bluezDevice;
@@ -76,7 +88,12 @@ public:
     QString m_modalias;
     InputPtr m_input;
     MediaPlayerPtr m_mediaPlayer;
+    QList<GattServicePtr> m_gattServices;
     AdapterPtr m_adapter;
+
+    // Derived from properties above, updated when they change
+    Device::Type m_type;
+    QString m_friendlyName;
 };
 
 } // namespace BluezQt
@@ -21,6 +21,7 @@
  */
 
 #include "devicesmodel.h"
+#include "devicesmodel_p.h"
 #include "manager.h"
 #include "adapter.h"
 #include "device.h"
@@ -28,6 +29,118 @@
 namespace BluezQt
 {
 
+QHash<int, QByteArray> devicesModelRoleNames()
+{
+    QHash<int, QByteArray> roles;
+
+    roles[DevicesModel::UbiRole] = QByteArrayLiteral("Ubi");
+    roles[DevicesModel::AddressRole] = QByteArrayLiteral("Address");
+    roles[DevicesModel::NameRole] = QByteArrayLiteral("Name");
+    roles[DevicesModel::FriendlyNameRole] = QByteArrayLiteral("FriendlyName");
+    roles[DevicesModel::RemoteNameRole] = QByteArrayLiteral("RemoteName");
+    roles[DevicesModel::ClassRole] = QByteArrayLiteral("Class");
+    roles[DevicesModel::TypeRole] = QByteArrayLiteral("Type");
+    roles[DevicesModel::AppearanceRole] = QByteArrayLiteral("Appearance");
+    roles[DevicesModel::IconRole] = QByteArrayLiteral("Icon");
+    roles[DevicesModel::PairedRole] = QByteArrayLiteral("Paired");
+    roles[DevicesModel::TrustedRole] = QByteArrayLiteral("Trusted");
+    roles[DevicesModel::BlockedRole] = QByteArrayLiteral("Blocked");
+    roles[DevicesModel::LegacyPairingRole] = QByteArrayLiteral("LegacyPairing");
+    roles[DevicesModel::RssiRole] = QByteArrayLiteral("Rssi");
+    roles[DevicesModel::ConnectedRole] = QByteArrayLiteral("Connected");
+    roles[DevicesModel::UuidsRole] = QByteArrayLiteral("Uuids");
+    roles[DevicesModel::ModaliasRole] = QByteArrayLiteral("Modalias");
+    roles[DevicesModel::AdapterNameRole] = QByteArrayLiteral("AdapterName");
+    roles[DevicesModel::AdapterAddressRole] = QByteArrayLiteral("AdapterAddress");
+    roles[DevicesModel::AdapterPoweredRole] = QByteArrayLiteral("AdapterPowered");
+    roles[DevicesModel::AdapterDiscoverableRole] = QByteArrayLiteral("AdapterDiscoverable");
+    roles[DevicesModel::AdapterPairableRole] = QByteArrayLiteral("AdapterPairable");
+    roles[DevicesModel::AdapterDiscoveringRole] = QByteArrayLiteral("AdapterDiscovering");
+    roles[DevicesModel::AdapterUuidsRole] = QByteArrayLiteral("AdapterUuids");
+
+    return roles;
+}
+
+QVariant deviceRoleData(const DevicePtr &device, int role)
+{
+    switch (role) {
+    case Qt::DisplayRole:
+        return device->name();
+    case DevicesModel::UbiRole:
+        return device->ubi();
+    case DevicesModel::AddressRole:
+        return device->address();
+    case DevicesModel::NameRole:
+        return device->name();
+    case DevicesModel::FriendlyNameRole:
+        return device->friendlyName();
+    case DevicesModel::RemoteNameRole:
+        return device->remoteName();
+    case DevicesModel::ClassRole:
+        return device->deviceClass();
+    case DevicesModel::TypeRole:
+        return device->type();
+    case DevicesModel::AppearanceRole:
+        return device->appearance();
+    case DevicesModel::IconRole:
+        return device->icon();
+    case DevicesModel::PairedRole:
+        return device->isPaired();
+    case DevicesModel::TrustedRole:
+        return device->isTrusted();
+    case DevicesModel::BlockedRole:
+        return device->isBlocked();
+    case DevicesModel::LegacyPairingRole:
+        return device->hasLegacyPairing();
+    case DevicesModel::RssiRole:
+        return device->rssi();
+    case DevicesModel::ConnectedRole:
+        return device->isConnected();
+    case DevicesModel::UuidsRole:
+        return device->uuids();
+    case DevicesModel::ModaliasRole:
+        return device->modalias();
+    default:
+        return QVariant();
+    }
+}
+
+QVariant adapterRoleData(const AdapterPtr &adapter, int role)
+{
+    switch (role) {
+    case DevicesModel::AdapterNameRole:
+        return adapter->name();
+    case DevicesModel::AdapterAddressRole:
+        return adapter->address();
+    case DevicesModel::AdapterPoweredRole:
+        return adapter->isPowered();
+    case DevicesModel::AdapterDiscoverableRole:
+        return adapter->isDiscoverable();
+    case DevicesModel::AdapterPairableRole:
+        return adapter->isPairable();
+    case DevicesModel::AdapterDiscoveringRole:
+        return adapter->isDiscovering();
+    case DevicesModel::AdapterUuidsRole:
+        return adapter->uuids();
+    default:
+        return QVariant();
+    }
+}
+
+// Display role and all roles from UbiRole to AdapterUuidsRole
+static const int s_recordSize = DevicesModel::AdapterUuidsRole - DevicesModel::UbiRole + 2;
+
+static int recordSlot(int role)
+{
+    if (role == Qt::DisplayRole) {
+        return 0;
+    }
+    if (role >= DevicesModel::UbiRole && role <= DevicesModel::AdapterUuidsRole) {
+        return role - DevicesModel::UbiRole + 1;
+    }
+    return -1;
+}
+
 class DevicesModelPrivate : public QObject
 {
 public:
@@ -35,6 +148,8 @@ public:
 
     void init();
 
+    const QVector<QVariant> &record(int row) const;
+
     void deviceAdded(DevicePtr device);
     void deviceRemoved(DevicePtr device);
     void deviceChanged(DevicePtr device);
@@ -43,6 +158,9 @@ public:
     DevicesModel *q;
     Manager *m_manager;
     QList<DevicePtr> m_devices;
+
+    // Values of all roles per row, filled on first access and cleared when device changes
+    mutable QVector<QVector<QVariant> > m_records;
 };
 
 DevicesModelPrivate::DevicesModelPrivate(DevicesModel *q)
@@ -55,6 +173,7 @@ DevicesModelPrivate::DevicesModelPrivate(DevicesModel *q)
 void DevicesModelPrivate::init()
 {
     m_devices = m_manager->devices();
+    m_records.resize(m_devices.size());
 
     connect(m_manager, &Manager::deviceAdded, this, &DevicesModelPrivate::deviceAdded);
     connect(m_manager, &Manager::deviceRemoved, this, &DevicesModelPrivate::deviceRemoved);
@@ -62,10 +181,32 @@ void DevicesModelPrivate::init()
     connect(m_manager, &Manager::adapterChanged, this, &DevicesModelPrivate::adapterChanged);
 }
 
+const QVector<QVariant> &DevicesModelPrivate::record(int row) const
+{
+    QVector<QVariant> &values = m_records[row];
+
+    if (values.isEmpty()) {
+        const DevicePtr &device = m_devices.at(row);
+        const AdapterPtr &adapter = device->adapter();
+
+        values.reserve(s_recordSize);
+        values.append(deviceRoleData(device, Qt::DisplayRole));
+        for (int role = DevicesModel::UbiRole; role < DevicesModel::AdapterNameRole; ++role) {
+            values.append(deviceRoleData(device, role));
+        }
+        for (int role = DevicesModel::AdapterNameRole; role <= DevicesModel::AdapterUuidsRole; ++role) {
+            values.append(adapterRoleData(adapter, role));
+        }
+    }
+
+    return values;
+}
+
 void DevicesModelPrivate::deviceAdded(DevicePtr device)
 {
     q->beginInsertRows(QModelIndex(), m_devices.size(), m_devices.size());
     m_devices.append(device);
+    m_records.append(QVector<QVariant>());
     q->endInsertRows();
 }
 
@@ -76,6 +217,7 @@ void DevicesModelPrivate::deviceRemoved(DevicePtr device)
 
     q->beginRemoveRows(QModelIndex(), offset, offset);
     m_devices.removeAt(offset);
+    m_records.remove(offset);
     q->endRemoveRows();
 }
 
@@ -84,6 +226,8 @@ void DevicesModelPrivate::deviceChanged(DevicePtr device)
     int offset = m_devices.indexOf(device);
     Q_ASSERT(offset >= 0);
 
+    m_records[offset].clear();
+
     QModelIndex idx = q->createIndex(offset, 0);
     Q_EMIT q->dataChanged(idx, idx);
 }
@@ -111,32 +255,7 @@ DevicesModel::~DevicesModel()
 QHash<int, QByteArray> DevicesModel::roleNames() const
 {
     QHash<int, QByteArray> roles = QAbstractListModel::roleNames();
-
-    roles[UbiRole] = QByteArrayLiteral("Ubi");
-    roles[AddressRole] = QByteArrayLiteral("Address");
-    roles[NameRole] = QByteArrayLiteral("Name");
-    roles[FriendlyNameRole] = QByteArrayLiteral("FriendlyName");
-    roles[RemoteNameRole] = QByteArrayLiteral("RemoteName");
-    roles[ClassRole] = QByteArrayLiteral("Class");
-    roles[TypeRole] = QByteArrayLiteral("Type");
-    roles[AppearanceRole] = QByteArrayLiteral("Appearance");
-    roles[IconRole] = QByteArrayLiteral("Icon");
-    roles[PairedRole] = QByteArrayLiteral("Paired");
-    roles[TrustedRole] = QByteArrayLiteral("Trusted");
-    roles[BlockedRole] = QByteArrayLiteral("Blocked");
-    roles[LegacyPairingRole] = QByteArrayLiteral("LegacyPairing");
-    roles[RssiRole] = QByteArrayLiteral("Rssi");
-    roles[ConnectedRole] = QByteArrayLiteral("Connected");
-    roles[UuidsRole] = QByteArrayLiteral("Uuids");
-    roles[ModaliasRole] = QByteArrayLiteral("Modalias");
-    roles[AdapterNameRole] = QByteArrayLiteral("AdapterName");
-    roles[AdapterAddressRole] = QByteArrayLiteral("AdapterAddress");
-    roles[AdapterPoweredRole] = QByteArrayLiteral("AdapterPowered");
-    roles[AdapterDiscoverableRole] = QByteArrayLiteral("AdapterDiscoverable");
-    roles[AdapterPairableRole] = QByteArrayLiteral("AdapterPairable");
-    roles[AdapterDiscoveringRole] = QByteArrayLiteral("AdapterDiscovering");
-    roles[AdapterUuidsRole] = QByteArrayLiteral("AdapterUuids");
-
+    roles.unite(devicesModelRoleNames());
     return roles;
 }
 
@@ -150,65 +269,45 @@ int DevicesModel::rowCount(const QModelIndex &parent) const
 
 QVariant DevicesModel::data(const QModelIndex &index, int role) const
 {
-    DevicePtr dev = device(index);
-    if (!dev) {
+    const int slot = recordSlot(role);
+    if (!index.isValid() || slot < 0) {
         return QVariant();
     }
+    return d->record(index.row()).at(slot);
+}
 
-    switch (role) {
-    case Qt::DisplayRole:
-        return dev->name();
-    case UbiRole:
-        return dev->ubi();
-    case AddressRole:
-        return dev->address();
-    case NameRole:
-        return dev->name();
-    case FriendlyNameRole:
-        return dev->friendlyName();
-    case RemoteNameRole:
-        return dev->remoteName();
-    case ClassRole:
-        return dev->deviceClass();
-    case TypeRole:
-        return dev->type();
-    case AppearanceRole:
-        return dev->appearance();
-    case IconRole:
-        return dev->icon();
-    case PairedRole:
-        return dev->isPaired();
-    case TrustedRole:
-        return dev->isTrusted();
-    case BlockedRole:
-        return dev->isBlocked();
-    case LegacyPairingRole:
-        return dev->hasLegacyPairing();
-    case RssiRole:
-        return dev->rssi();
-    case ConnectedRole:
-        return dev->isConnected();
-    case UuidsRole:
-        return dev->uuids();
-    case ModaliasRole:
-        return dev->modalias();
-    case AdapterNameRole:
-        return dev->adapter()->name();
-    case AdapterAddressRole:
-        return dev->adapter()->address();
-    case AdapterPoweredRole:
-        return dev->adapter()->isPowered();
-    case AdapterDiscoverableRole:
-        return dev->adapter()->isDiscoverable();
-    case AdapterPairableRole:
-        return dev->adapter()->isPairable();
-    case AdapterDiscoveringRole:
-        return dev->adapter()->isDiscovering();
-    case AdapterUuidsRole:
-        return dev->adapter()->uuids();
-    default:
-        return QVariant();
+QMap<int, QVariant> DevicesModel::itemData(const QModelIndex &index) const
+{
+    QMap<int, QVariant> roles;
+    if (!index.isValid()) {
+        return roles;
+    }
+
+    const QVector<QVariant> &values = d->record(index.row());
+
+    roles.insert(Qt::DisplayRole, values.at(0));
+    for (int role = UbiRole; role <= AdapterUuidsRole; ++role) {
+        roles.insert(role, values.at(recordSlot(role)));
+    }
+    return roles;
+}
+
+QVector<QVariant> DevicesModel::multiData(const QModelIndex &index, const QVector<int> &roles) const
+{
+    QVector<QVariant> values(roles.size());
+    if (!index.isValid()) {
+        return values;
+    }
+
+    const QVector<QVariant> &record = d->record(index.row());
+
+    for (int i = 0; i < roles.size(); ++i) {
+        const int slot = recordSlot(roles.at(i));
+        if (slot >= 0) {
+            values[i] = record.at(slot);
+        }
     }
+    return values;
 }
 
 QModelIndex DevicesModel::index(int row, int column, const QModelIndex &parent) const
@@ -142,6 +142,23 @@ public:
       */
     QVariant data(const QModelIndex &index, int role) const override;
 
+    /**
+      * Reimplemented from QAbstractListModel::itemData()
+      */
+    QMap<int, QVariant> itemData(const QModelIndex &index) const override;
+
+    /**
+     * Returns data of multiple roles for specified index.
+     *
+     * All roles are resolved in one call, which is faster than calling
+     * data() for each role when a view needs many roles of a row.
+     *
+     * @param index index in model
+     * @param roles requested roles
+     * @return values in the same order as roles, null for unknown roles
+     */
+    QVector<QVariant> multiData(const QModelIndex &index, const QVector<int> &roles) const;
+
     /**
       * Reimplemented from QAbstractListModel::index()
       */
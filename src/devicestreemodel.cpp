@@ -0,0 +1,307 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "devicestreemodel.h"
+#include "devicesmodel_p.h"
+#include "manager.h"
+#include "adapter.h"
+#include "device.h"
+
+namespace BluezQt
+{
+
+struct AdapterNode
+{
+    AdapterPtr adapter;
+    QList<DevicePtr> devices;
+};
+
+class DevicesTreeModelPrivate : public QObject
+{
+public:
+    explicit DevicesTreeModelPrivate(DevicesTreeModel *q);
+    ~DevicesTreeModelPrivate();
+
+    void init();
+
+    AdapterNode *createNode(AdapterPtr adapter);
+    int nodeRow(AdapterNode *node) const;
+    AdapterNode *nodeForAdapter(AdapterPtr adapter) const;
+
+    void adapterAdded(AdapterPtr adapter);
+    void adapterRemoved(AdapterPtr adapter);
+    void adapterChanged(AdapterPtr adapter);
+    void deviceAdded(AdapterNode *node, DevicePtr device);
+    void deviceRemoved(AdapterNode *node, DevicePtr device);
+    void deviceChanged(AdapterNode *node, DevicePtr device);
+
+    DevicesTreeModel *q;
+    Manager *m_manager;
+    QList<AdapterNode*> m_nodes;
+};
+
+DevicesTreeModelPrivate::DevicesTreeModelPrivate(DevicesTreeModel *q)
+    : QObject(q)
+    , q(q)
+    , m_manager(nullptr)
+{
+}
+
+DevicesTreeModelPrivate::~DevicesTreeModelPrivate()
+{
+    qDeleteAll(m_nodes);
+}
+
+void DevicesTreeModelPrivate::init()
+{
+    Q_FOREACH (const AdapterPtr &adapter, m_manager->adapters()) {
+        m_nodes.append(createNode(adapter));
+    }
+
+    connect(m_manager, &Manager::adapterAdded, this, &DevicesTreeModelPrivate::adapterAdded);
+    connect(m_manager, &Manager::adapterRemoved, this, &DevicesTreeModelPrivate::adapterRemoved);
+}
+
+AdapterNode *DevicesTreeModelPrivate::createNode(AdapterPtr adapter)
+{
+    AdapterNode *node = new AdapterNode;
+    node->adapter = adapter;
+    node->devices = adapter->devices();
+
+    connect(adapter.data(), &Adapter::adapterChanged, this, &DevicesTreeModelPrivate::adapterChanged);
+
+    connect(adapter.data(), &Adapter::deviceAdded, this, [this, node](DevicePtr device) {
+        deviceAdded(node, device);
+    });
+
+    connect(adapter.data(), &Adapter::deviceRemoved, this, [this, node](DevicePtr device) {
+        deviceRemoved(node, device);
+    });
+
+    connect(adapter.data(), &Adapter::deviceChanged, this, [this, node](DevicePtr device) {
+        deviceChanged(node, device);
+    });
+
+    return node;
+}
+
+int DevicesTreeModelPrivate::nodeRow(AdapterNode *node) const
+{
+    return m_nodes.indexOf(node);
+}
+
+AdapterNode *DevicesTreeModelPrivate::nodeForAdapter(AdapterPtr adapter) const
+{
+    Q_FOREACH (AdapterNode *node, m_nodes) {
+        if (node->adapter == adapter) {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+void DevicesTreeModelPrivate::adapterAdded(AdapterPtr adapter)
+{
+    q->beginInsertRows(QModelIndex(), m_nodes.size(), m_nodes.size());
+    m_nodes.append(createNode(adapter));
+    q->endInsertRows();
+}
+
+void DevicesTreeModelPrivate::adapterRemoved(AdapterPtr adapter)
+{
+    AdapterNode *node = nodeForAdapter(adapter);
+    Q_ASSERT(node);
+
+    // Manager removes all devices before the adapter, children should be already gone
+    int row = nodeRow(node);
+    q->beginRemoveRows(QModelIndex(), row, row);
+    m_nodes.removeAt(row);
+    q->endRemoveRows();
+
+    disconnect(adapter.data(), nullptr, this, nullptr);
+    delete node;
+}
+
+void DevicesTreeModelPrivate::adapterChanged(AdapterPtr adapter)
+{
+    AdapterNode *node = nodeForAdapter(adapter);
+    Q_ASSERT(node);
+
+    QModelIndex idx = q->createIndex(nodeRow(node), 0);
+    Q_EMIT q->dataChanged(idx, idx);
+}
+
+void DevicesTreeModelPrivate::deviceAdded(AdapterNode *node, DevicePtr device)
+{
+    const QModelIndex parent = q->createIndex(nodeRow(node), 0);
+
+    q->beginInsertRows(parent, node->devices.size(), node->devices.size());
+    node->devices.append(device);
+    q->endInsertRows();
+}
+
+void DevicesTreeModelPrivate::deviceRemoved(AdapterNode *node, DevicePtr device)
+{
+    int offset = node->devices.indexOf(device);
+    Q_ASSERT(offset >= 0);
+
+    const QModelIndex parent = q->createIndex(nodeRow(node), 0);
+
+    q->beginRemoveRows(parent, offset, offset);
+    node->devices.removeAt(offset);
+    q->endRemoveRows();
+}
+
+void DevicesTreeModelPrivate::deviceChanged(AdapterNode *node, DevicePtr device)
+{
+    int offset = node->devices.indexOf(device);
+    Q_ASSERT(offset >= 0);
+
+    QModelIndex idx = q->createIndex(offset, 0, node);
+    Q_EMIT q->dataChanged(idx, idx);
+}
+
+DevicesTreeModel::DevicesTreeModel(Manager *manager, QObject *parent)
+    : QAbstractItemModel(parent)
+    , d(new DevicesTreeModelPrivate(this))
+{
+    d->m_manager = manager;
+    d->init();
+}
+
+DevicesTreeModel::~DevicesTreeModel()
+{
+    delete d;
+}
+
+QHash<int, QByteArray> DevicesTreeModel::roleNames() const
+{
+    QHash<int, QByteArray> roles = QAbstractItemModel::roleNames();
+    roles.unite(devicesModelRoleNames());
+
+    roles[IsAdapterRole] = QByteArrayLiteral("IsAdapter");
+
+    return roles;
+}
+
+int DevicesTreeModel::rowCount(const QModelIndex &parent) const
+{
+    if (!parent.isValid()) {
+        return d->m_nodes.size();
+    }
+
+    // Devices have no children
+    if (parent.internalPointer()) {
+        return 0;
+    }
+    return d->m_nodes.at(parent.row())->devices.size();
+}
+
+int DevicesTreeModel::columnCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent)
+
+    return 1;
+}
+
+QVariant DevicesTreeModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid()) {
+        return QVariant();
+    }
+
+    if (role == IsAdapterRole) {
+        return !index.internalPointer();
+    }
+
+    if (DevicePtr dev = device(index)) {
+        return deviceRoleData(dev, role);
+    }
+
+    AdapterPtr adapter = d->m_nodes.at(index.row())->adapter;
+
+    switch (role) {
+    case Qt::DisplayRole:
+    case DevicesModel::NameRole:
+        return adapter->name();
+    case DevicesModel::UbiRole:
+        return adapter->ubi();
+    case DevicesModel::AddressRole:
+        return adapter->address();
+    default:
+        return adapterRoleData(adapter, role);
+    }
+}
+
+QModelIndex DevicesTreeModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (!hasIndex(row, column, parent)) {
+        return QModelIndex();
+    }
+
+    // Device indexes store their adapter node as internal pointer
+    if (parent.isValid()) {
+        return createIndex(row, 0, d->m_nodes.at(parent.row()));
+    }
+    return createIndex(row, 0);
+}
+
+QModelIndex DevicesTreeModel::parent(const QModelIndex &index) const
+{
+    if (!index.isValid() || !index.internalPointer()) {
+        return QModelIndex();
+    }
+
+    AdapterNode *node = static_cast<AdapterNode*>(index.internalPointer());
+    return createIndex(d->nodeRow(node), 0);
+}
+
+AdapterPtr DevicesTreeModel::adapter(const QModelIndex &index) const
+{
+    if (!index.isValid()) {
+        return AdapterPtr();
+    }
+
+    if (index.internalPointer()) {
+        return static_cast<AdapterNode*>(index.internalPointer())->adapter;
+    }
+    return d->m_nodes.at(index.row())->adapter;
+}
+
+DevicePtr DevicesTreeModel::device(const QModelIndex &index) const
+{
+    if (!index.isValid() || !index.internalPointer()) {
+        return DevicePtr();
+    }
+    return static_cast<AdapterNode*>(index.internalPointer())->devices.at(index.row());
+}
+
+QModelIndex DevicesTreeModel::adapterIndex(AdapterPtr adapter) const
+{
+    AdapterNode *node = d->nodeForAdapter(adapter);
+    if (!node) {
+        return QModelIndex();
+    }
+    return createIndex(d->nodeRow(node), 0);
+}
+
+} // namespace BluezQt
@@ -0,0 +1,145 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_DEVICESTREEMODEL_H
+#define BLUEZQT_DEVICESTREEMODEL_H
+
+#include <QAbstractItemModel>
+
+#include "devicesmodel.h"
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class Manager;
+
+/**
+ * @class BluezQt::DevicesTreeModel devicestreemodel.h <BluezQt/DevicesTreeModel>
+ *
+ * Model of all devices grouped by adapters.
+ *
+ * This class represents a two level tree model. Top level rows are adapters
+ * and their children are devices of the adapter.
+ *
+ * Adapter rows provide UbiRole, AddressRole, NameRole and all
+ * DevicesModel::Adapter*Role roles. Device rows provide all device roles
+ * of DevicesModel, adapter roles of device rows are available from the
+ * parent adapter row.
+ *
+ * Changes of an adapter only update its own row and changes of a device
+ * only update its row under the adapter.
+ */
+class BLUEZQT_EXPORT DevicesTreeModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    /**
+     * Tree data roles.
+     */
+    enum TreeRoles {
+        /** Indicates whether the row is an adapter row (bool) */
+        IsAdapterRole = DevicesModel::LastRole + 1,
+        /** Last role used by DevicesTreeModel */
+        LastRole = DevicesModel::LastRole + 2
+    };
+
+    /**
+     * Creates a new DevicesTreeModel object.
+     *
+     * @param manager manager to be used
+     * @param parent
+     */
+    explicit DevicesTreeModel(Manager *manager, QObject *parent = nullptr);
+
+    /**
+      * Destroys a DevicesTreeModel object.
+      */
+    ~DevicesTreeModel() override;
+
+    /**
+      * Reimplemented from QAbstractItemModel::roleNames()
+      */
+    QHash<int, QByteArray> roleNames() const override;
+
+    /**
+      * Reimplemented from QAbstractItemModel::rowCount()
+      */
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+      * Reimplemented from QAbstractItemModel::columnCount()
+      */
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+      * Reimplemented from QAbstractItemModel::data()
+      */
+    QVariant data(const QModelIndex &index, int role) const override;
+
+    /**
+      * Reimplemented from QAbstractItemModel::index()
+      */
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+
+    /**
+      * Reimplemented from QAbstractItemModel::parent()
+      */
+    QModelIndex parent(const QModelIndex &index) const override;
+
+    /**
+     * Returns an adapter for specified index.
+     *
+     * For device rows, the adapter of the device is returned.
+     *
+     * @param index index in model
+     * @return adapter object
+     */
+    AdapterPtr adapter(const QModelIndex &index) const;
+
+    /**
+     * Returns a device for specified index.
+     *
+     * @param index index in model
+     * @return device object or null for adapter rows
+     */
+    DevicePtr device(const QModelIndex &index) const;
+
+    /**
+     * Returns an index of the adapter row.
+     *
+     * @param adapter adapter
+     * @return index in model
+     */
+    QModelIndex adapterIndex(AdapterPtr adapter) const;
+
+private:
+    class DevicesTreeModelPrivate *const d;
+
+    friend class DevicesTreeModelPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_DEVICESTREEMODEL_H
@@ -0,0 +1,386 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "discoveryscheduler.h"
+#include "discoveryscheduler_p.h"
+#include "adapter.h"
+#include "adapterselector.h"
+#include "pendingcall.h"
+#include "debug.h"
+
+namespace BluezQt
+{
+
+DiscoverySchedulerPrivate::DiscoverySchedulerPrivate(DiscoveryScheduler *q)
+    : QObject()
+    , q(q)
+    , m_timer(new QTimer(this))
+    , m_current(nullptr)
+    , m_stopCall(nullptr)
+    , m_index(0)
+    , m_interval(10000)
+    , m_running(false)
+{
+    m_timer->setSingleShot(true);
+    connect(m_timer, &QTimer::timeout, this, &DiscoverySchedulerPrivate::timeout);
+}
+
+int DiscoverySchedulerPrivate::indexOf(const AdapterPtr &adapter) const
+{
+    for (int i = 0; i < m_entries.count(); ++i) {
+        if (m_entries.at(i)->adapter == adapter) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void DiscoverySchedulerPrivate::startWindow()
+{
+    while (m_index < m_entries.count()) {
+        Entry *entry = m_entries.at(m_index);
+        if (!entry->adapter->isPowered() || entry->dutyCycle <= 0) {
+            m_index++;
+            continue;
+        }
+
+        // Scanning slows down connection attempts on the same controller
+        if (m_selector && m_selector->pendingCount(entry->adapter) > 0) {
+            m_index++;
+            continue;
+        }
+
+        m_current = entry;
+
+        // Discovery is started only with the filter in place
+        const AdapterPtr adapter = entry->adapter;
+        PendingCall *filterCall = adapter->setDiscoveryFilter(entry->filter);
+        connect(filterCall, &PendingCall::finished, this, [this, adapter](PendingCall *call) {
+            if (!isCurrent(adapter)) {
+                return;
+            }
+            if (call->error()) {
+                windowFailed(call);
+                return;
+            }
+
+            PendingCall *startCall = adapter->startDiscovery();
+            connect(startCall, &PendingCall::finished, this, [this, adapter](PendingCall *call) {
+                if (isCurrent(adapter) && call->error() && call->error() != PendingCall::InProgress) {
+                    windowFailed(call);
+                }
+            });
+        });
+
+        // Adapter may be already discovering for another client
+        if (entry->adapter->isDiscovering()) {
+            discoveringChanged(entry, true);
+        }
+
+        m_timer->start(qMax(1, qRound(m_interval * entry->dutyCycle)));
+        Q_EMIT q->windowStarted(entry->adapter);
+        return;
+    }
+
+    // All adapters had their window in this cycle, wait for the rest of the interval
+    m_index = 0;
+    m_timer->start(qMax<qint64>(0, m_interval - m_cycleClock.elapsed()));
+}
+
+bool DiscoverySchedulerPrivate::isCurrent(const AdapterPtr &adapter) const
+{
+    return m_current && m_current->adapter == adapter;
+}
+
+void DiscoverySchedulerPrivate::windowFailed(PendingCall *call)
+{
+    qCWarning(BLUEZQT) << "DiscoveryScheduler: Skipping window of" << m_current->adapter->ubi() << "-" << call->errorText();
+
+    m_timer->stop();
+    finishWindow();
+    m_index++;
+}
+
+void DiscoverySchedulerPrivate::finishWindow()
+{
+    Entry *entry = m_current;
+    m_current = nullptr;
+
+    if (entry->scanning) {
+        entry->scanTime += entry->scanClock.elapsed();
+        entry->scanning = false;
+    }
+
+    // Next window is started only after this adapter stopped discovering
+    PendingCall *call = entry->adapter->stopDiscovery();
+    connect(call, &PendingCall::finished, this, &DiscoverySchedulerPrivate::stopFinished);
+    connect(call, &QObject::destroyed, this, [this, call]() {
+        // Call deleted with its adapter without finishing
+        stopFinished(call);
+    });
+    m_stopCall = call;
+
+    Q_EMIT q->windowFinished(entry->adapter);
+}
+
+void DiscoverySchedulerPrivate::timeout()
+{
+    if (m_current) {
+        finishWindow();
+        m_index++;
+        return;
+    }
+
+    m_cycleClock.start();
+    startWindow();
+}
+
+void DiscoverySchedulerPrivate::stopFinished(PendingCall *call)
+{
+    call->disconnect(this);
+
+    if (call != m_stopCall) {
+        return;
+    }
+
+    m_stopCall = nullptr;
+
+    if (m_running && !m_current) {
+        startWindow();
+    }
+}
+
+void DiscoverySchedulerPrivate::discoveringChanged(Entry *entry, bool discovering)
+{
+    if (discovering && entry == m_current && !entry->scanning) {
+        entry->scanning = true;
+        entry->scanClock.start();
+    } else if (!discovering && entry->scanning) {
+        entry->scanTime += entry->scanClock.elapsed();
+        entry->scanning = false;
+    }
+}
+
+DiscoveryScheduler::DiscoveryScheduler(QObject *parent)
+    : QObject(parent)
+    , d(new DiscoverySchedulerPrivate(this))
+{
+}
+
+DiscoveryScheduler::~DiscoveryScheduler()
+{
+    stop();
+    qDeleteAll(d->m_entries);
+    delete d;
+}
+
+QList<AdapterPtr> DiscoveryScheduler::adapters() const
+{
+    QList<AdapterPtr> list;
+    list.reserve(d->m_entries.count());
+
+    Q_FOREACH (DiscoverySchedulerPrivate::Entry *entry, d->m_entries) {
+        list.append(entry->adapter);
+    }
+    return list;
+}
+
+void DiscoveryScheduler::addAdapter(AdapterPtr adapter, qreal dutyCycle)
+{
+    if (!adapter || d->indexOf(adapter) != -1) {
+        return;
+    }
+
+    DiscoverySchedulerPrivate::Entry *entry = new DiscoverySchedulerPrivate::Entry;
+    entry->adapter = adapter;
+    entry->dutyCycle = qBound<qreal>(0.0, dutyCycle, 1.0);
+    entry->devicesFound = 0;
+    entry->scanTime = 0;
+    entry->scanning = false;
+    d->m_entries.append(entry);
+
+    connect(adapter.data(), &Adapter::discoveringChanged, d, [this, entry](bool discovering) {
+        d->discoveringChanged(entry, discovering);
+    });
+    connect(adapter.data(), &Adapter::deviceAdded, d, [entry]() {
+        if (entry->scanning) {
+            entry->devicesFound++;
+        }
+    });
+    connect(adapter.data(), &Adapter::adapterRemoved, d, [this](AdapterPtr removedAdapter) {
+        removeAdapter(removedAdapter);
+    });
+}
+
+void DiscoveryScheduler::removeAdapter(AdapterPtr adapter)
+{
+    const int index = d->indexOf(adapter);
+    if (index == -1) {
+        return;
+    }
+
+    DiscoverySchedulerPrivate::Entry *entry = d->m_entries.at(index);
+    const bool wasCurrent = entry == d->m_current;
+
+    if (wasCurrent) {
+        d->m_timer->stop();
+        d->finishWindow();
+    }
+
+    adapter->disconnect(d);
+    d->m_entries.removeAt(index);
+    delete entry;
+
+    if (index < d->m_index) {
+        d->m_index--;
+    }
+
+    // Next adapter is now at the same index, its window is started
+    // once the removed adapter stopped discovering
+}
+
+qreal DiscoveryScheduler::dutyCycle(AdapterPtr adapter) const
+{
+    const int index = d->indexOf(adapter);
+    return index != -1 ? d->m_entries.at(index)->dutyCycle : 0;
+}
+
+void DiscoveryScheduler::setDutyCycle(AdapterPtr adapter, qreal dutyCycle)
+{
+    const int index = d->indexOf(adapter);
+    if (index != -1) {
+        d->m_entries.at(index)->dutyCycle = qBound<qreal>(0.0, dutyCycle, 1.0);
+    }
+}
+
+QVariantMap DiscoveryScheduler::filter(AdapterPtr adapter) const
+{
+    const int index = d->indexOf(adapter);
+    return index != -1 ? d->m_entries.at(index)->filter : QVariantMap();
+}
+
+void DiscoveryScheduler::setFilter(AdapterPtr adapter, const QVariantMap &filter)
+{
+    const int index = d->indexOf(adapter);
+    if (index != -1) {
+        d->m_entries.at(index)->filter = filter;
+    }
+}
+
+int DiscoveryScheduler::interval() const
+{
+    return d->m_interval;
+}
+
+void DiscoveryScheduler::setInterval(int msecs)
+{
+    d->m_interval = qMax(1, msecs);
+}
+
+AdapterSelector *DiscoveryScheduler::adapterSelector() const
+{
+    return d->m_selector;
+}
+
+void DiscoveryScheduler::setAdapterSelector(AdapterSelector *selector)
+{
+    d->m_selector = selector;
+}
+
+bool DiscoveryScheduler::isRunning() const
+{
+    return d->m_running;
+}
+
+AdapterPtr DiscoveryScheduler::currentAdapter() const
+{
+    return d->m_current ? d->m_current->adapter : AdapterPtr();
+}
+
+int DiscoveryScheduler::devicesFound(AdapterPtr adapter) const
+{
+    const int index = d->indexOf(adapter);
+    return index != -1 ? d->m_entries.at(index)->devicesFound : 0;
+}
+
+qint64 DiscoveryScheduler::scanTime(AdapterPtr adapter) const
+{
+    const int index = d->indexOf(adapter);
+    if (index == -1) {
+        return 0;
+    }
+
+    const DiscoverySchedulerPrivate::Entry *entry = d->m_entries.at(index);
+    return entry->scanTime + (entry->scanning ? entry->scanClock.elapsed() : 0);
+}
+
+qreal DiscoveryScheduler::devicesPerSecond(AdapterPtr adapter) const
+{
+    const qint64 time = scanTime(adapter);
+    if (time <= 0) {
+        return 0;
+    }
+    return devicesFound(adapter) * 1000.0 / time;
+}
+
+void DiscoveryScheduler::resetStatistics()
+{
+    Q_FOREACH (DiscoverySchedulerPrivate::Entry *entry, d->m_entries) {
+        entry->devicesFound = 0;
+        entry->scanTime = 0;
+        if (entry->scanning) {
+            entry->scanClock.start();
+        }
+    }
+}
+
+void DiscoveryScheduler::start()
+{
+    if (d->m_running) {
+        return;
+    }
+
+    d->m_running = true;
+    d->m_index = 0;
+    d->m_cycleClock.start();
+
+    // Otherwise started when the previous window is stopped
+    if (!d->m_stopCall) {
+        d->startWindow();
+    }
+}
+
+void DiscoveryScheduler::stop()
+{
+    if (!d->m_running) {
+        return;
+    }
+
+    d->m_running = false;
+    d->m_timer->stop();
+
+    if (d->m_current) {
+        d->finishWindow();
+    }
+}
+
+} // namespace BluezQt
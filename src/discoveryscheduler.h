@@ -0,0 +1,257 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_DISCOVERYSCHEDULER_H
+#define BLUEZQT_DISCOVERYSCHEDULER_H
+
+#include <QObject>
+
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class AdapterSelector;
+
+/**
+ * @class BluezQt::DiscoveryScheduler discoveryscheduler.h <BluezQt/DiscoveryScheduler>
+ *
+ * Discovery scheduler.
+ *
+ * Running discovery on all adapters at the same time causes them to interfere
+ * with each other, running it on only one adapter leaves the others unused.
+ *
+ * DiscoveryScheduler runs discovery on its adapters in turns. In each cycle of interval()
+ * milliseconds, every adapter scans for its duty cycle share of the interval, one after another.
+ * Before each scan window, the discovery filter of the adapter is set.
+ * If setting the filter or starting the discovery fails, the window is skipped.
+ * A scan window starts only after the adapter of the previous window stopped discovering.
+ *
+ * When an AdapterSelector is set, adapters with devices pending connection skip their
+ * scan windows, so that discovery does not slow down the connection attempts.
+ *
+ * The scheduler also measures the number of devices found per second of scanning for each adapter.
+ *
+ * Example use:
+ * @code
+ * BluezQt::DiscoveryScheduler *scheduler = new BluezQt::DiscoveryScheduler(this);
+ * scheduler->addAdapter(adapter1, 0.3);
+ * scheduler->addAdapter(adapter2, 0.3);
+ * scheduler->setFilter(adapter2, {{QStringLiteral("Transport"), QStringLiteral("le")}});
+ * scheduler->start();
+ * @endcode
+ */
+class BLUEZQT_EXPORT DiscoveryScheduler : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int interval READ interval WRITE setInterval)
+    Q_PROPERTY(bool running READ isRunning)
+    Q_PROPERTY(AdapterPtr currentAdapter READ currentAdapter)
+
+public:
+    /**
+     * Creates a new DiscoveryScheduler object.
+     *
+     * @param parent
+     */
+    explicit DiscoveryScheduler(QObject *parent = nullptr);
+
+    /**
+     * Destroys a DiscoveryScheduler object.
+     *
+     * Running discovery is stopped.
+     */
+    ~DiscoveryScheduler();
+
+    /**
+     * Returns list of scheduled adapters.
+     *
+     * @return list of adapters
+     */
+    QList<AdapterPtr> adapters() const;
+
+    /**
+     * Adds the adapter to the scheduler.
+     *
+     * Adapters scan in the order they were added.
+     *
+     * @param adapter adapter
+     * @param dutyCycle share of the interval when the adapter scans (0.0 - 1.0)
+     */
+    void addAdapter(AdapterPtr adapter, qreal dutyCycle = 0.25);
+
+    /**
+     * Removes the adapter from the scheduler.
+     *
+     * Adapter is also removed automatically when it is removed from the system.
+     *
+     * @param adapter adapter
+     */
+    void removeAdapter(AdapterPtr adapter);
+
+    /**
+     * Returns the duty cycle of the adapter.
+     *
+     * @param adapter adapter
+     * @return duty cycle
+     */
+    qreal dutyCycle(AdapterPtr adapter) const;
+
+    /**
+     * Sets the duty cycle of the adapter.
+     *
+     * @param adapter adapter
+     * @param dutyCycle share of the interval when the adapter scans (0.0 - 1.0)
+     */
+    void setDutyCycle(AdapterPtr adapter, qreal dutyCycle);
+
+    /**
+     * Returns the discovery filter of the adapter.
+     *
+     * @param adapter adapter
+     * @return discovery filter
+     */
+    QVariantMap filter(AdapterPtr adapter) const;
+
+    /**
+     * Sets the discovery filter of the adapter.
+     *
+     * @param adapter adapter
+     * @param filter discovery filter
+     * @see Adapter::setDiscoveryFilter()
+     */
+    void setFilter(AdapterPtr adapter, const QVariantMap &filter);
+
+    /**
+     * Returns the length of one cycle.
+     *
+     * @return interval in milliseconds
+     */
+    int interval() const;
+
+    /**
+     * Sets the length of one cycle.
+     *
+     * If the scan windows of all adapters are longer than the interval,
+     * the cycle is extended to fit all windows.
+     * Default value is 10000 milliseconds.
+     *
+     * @param msecs interval in milliseconds
+     */
+    void setInterval(int msecs);
+
+    /**
+     * Returns the adapter selector.
+     *
+     * @return adapter selector
+     */
+    AdapterSelector *adapterSelector() const;
+
+    /**
+     * Sets the adapter selector.
+     *
+     * Scan window of an adapter is skipped while the selector has devices
+     * pending connection on it (see AdapterSelector::pendingCount()).
+     * The selector is not owned by the scheduler.
+     *
+     * @param selector adapter selector
+     */
+    void setAdapterSelector(AdapterSelector *selector);
+
+    /**
+     * Returns whether the scheduler is running.
+     *
+     * @return true if running
+     */
+    bool isRunning() const;
+
+    /**
+     * Returns the adapter that is currently scanning.
+     *
+     * @return null if no adapter is scanning
+     */
+    AdapterPtr currentAdapter() const;
+
+    /**
+     * Returns the number of devices found by the adapter while scanning.
+     *
+     * @param adapter adapter
+     * @return number of found devices
+     */
+    int devicesFound(AdapterPtr adapter) const;
+
+    /**
+     * Returns the total time the adapter was discovering in its scan windows.
+     *
+     * The time is measured with Adapter::discoveringChanged().
+     *
+     * @param adapter adapter
+     * @return time in milliseconds
+     */
+    qint64 scanTime(AdapterPtr adapter) const;
+
+    /**
+     * Returns the number of devices found by the adapter per second of scanning.
+     *
+     * @param adapter adapter
+     * @return found devices per second
+     */
+    qreal devicesPerSecond(AdapterPtr adapter) const;
+
+    /**
+     * Resets the collected statistics.
+     */
+    void resetStatistics();
+
+public Q_SLOTS:
+    /**
+     * Starts the scheduler.
+     */
+    void start();
+
+    /**
+     * Stops the scheduler.
+     */
+    void stop();
+
+Q_SIGNALS:
+    /**
+     * Indicates that a scan window of the adapter have started.
+     */
+    void windowStarted(AdapterPtr adapter);
+
+    /**
+     * Indicates that a scan window of the adapter have finished.
+     */
+    void windowFinished(AdapterPtr adapter);
+
+private:
+    class DiscoverySchedulerPrivate *const d;
+
+    friend class DiscoverySchedulerPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_DISCOVERYSCHEDULER_H
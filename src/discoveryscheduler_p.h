@@ -0,0 +1,81 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_DISCOVERYSCHEDULER_P_H
+#define BLUEZQT_DISCOVERYSCHEDULER_P_H
+
+#include <QTimer>
+#include <QPointer>
+#include <QVariantMap>
+#include <QElapsedTimer>
+
+#include "types.h"
+
+namespace BluezQt
+{
+
+class DiscoveryScheduler;
+class PendingCall;
+class AdapterSelector;
+
+class DiscoverySchedulerPrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Entry
+    {
+        AdapterPtr adapter;
+        qreal dutyCycle;
+        QVariantMap filter;
+        int devicesFound;
+        qint64 scanTime;
+        QElapsedTimer scanClock;
+        bool scanning;
+    };
+
+    explicit DiscoverySchedulerPrivate(DiscoveryScheduler *q);
+
+    int indexOf(const AdapterPtr &adapter) const;
+    void startWindow();
+    bool isCurrent(const AdapterPtr &adapter) const;
+    void windowFailed(PendingCall *call);
+    void finishWindow();
+    void timeout();
+    void stopFinished(PendingCall *call);
+    void discoveringChanged(Entry *entry, bool discovering);
+
+    DiscoveryScheduler *q;
+    QList<Entry*> m_entries;
+    QTimer *m_timer;
+    QElapsedTimer m_cycleClock;
+    Entry *m_current;
+    PendingCall *m_stopCall;
+    QPointer<AdapterSelector> m_selector;
+    int m_index;
+    int m_interval;
+    bool m_running;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_DISCOVERYSCHEDULER_P_H
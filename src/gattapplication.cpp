@@ -0,0 +1,97 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattapplication.h"
+#include "gattapplication_p.h"
+#include "gattapplicationadaptor.h"
+#include "gattserverservice.h"
+#include "gattservercharacteristic.h"
+#include "utils.h"
+#include "debug.h"
+
+#include <QDBusConnection>
+#include <QDBusObjectPath>
+
+namespace BluezQt
+{
+
+GattApplicationPrivate::GattApplicationPrivate(GattApplication *q, const QString &objectPathPrefix)
+    : q(q)
+    , m_serviceNumber(0)
+{
+    static int appNumber = 0;
+    m_objectPath = objectPathPrefix + QStringLiteral("/app") + QString::number(appNumber++);
+}
+
+static void registerObject(const QDBusObjectPath &path, QObject *object)
+{
+    if (!DBusConnection::orgBluez().registerObject(path.path(), object)) {
+        qCDebug(BLUEZQT) << "Cannot register object" << path.path();
+    }
+}
+
+void GattApplicationPrivate::registerObjects()
+{
+    // BlueZ reads the whole tree with GetManagedObjects when the application is registered
+    registerObject(q->objectPath(), q);
+
+    Q_FOREACH (GattServerService *service, q->services()) {
+        registerObject(service->objectPath(), service);
+        Q_FOREACH (GattServerCharacteristic *characteristic, service->characteristics()) {
+            registerObject(characteristic->objectPath(), characteristic);
+        }
+    }
+}
+
+void GattApplicationPrivate::unregisterObjects()
+{
+    DBusConnection::orgBluez().unregisterObject(m_objectPath, QDBusConnection::UnregisterTree);
+}
+
+GattApplication::GattApplication(QObject *parent)
+    : GattApplication(QStringLiteral("/org/kde/bluezqt"), parent)
+{
+}
+
+GattApplication::GattApplication(const QString &objectPathPrefix, QObject *parent)
+    : QObject(parent)
+    , d(new GattApplicationPrivate(this, objectPathPrefix))
+{
+    new GattApplicationAdaptor(this);
+}
+
+GattApplication::~GattApplication()
+{
+    delete d;
+}
+
+QDBusObjectPath GattApplication::objectPath() const
+{
+    return QDBusObjectPath(d->m_objectPath);
+}
+
+QList<GattServerService *> GattApplication::services() const
+{
+    return findChildren<GattServerService*>(QString(), Qt::FindDirectChildrenOnly);
+}
+
+} // namespace BluezQt
@@ -0,0 +1,110 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTAPPLICATION_H
+#define BLUEZQT_GATTAPPLICATION_H
+
+#include <QObject>
+
+#include "bluezqt_export.h"
+
+class QDBusObjectPath;
+
+namespace BluezQt
+{
+
+class GattServerService;
+
+/**
+ * @class BluezQt::GattApplication gattapplication.h <BluezQt/GattApplication>
+ *
+ * GATT application.
+ *
+ * This class represents a local GATT application, a tree of GATT services
+ * and characteristics exported on D-Bus.
+ *
+ * Services are created as GattServerService objects with the application as parent,
+ * characteristics as GattServerCharacteristic objects with the service as parent.
+ * The application is then registered with Adapter::registerGattApplication().
+ *
+ * Example use:
+ * @code
+ * BluezQt::GattApplication *app = new BluezQt::GattApplication(this);
+ * BluezQt::GattServerService *service = new BluezQt::GattServerService(QStringLiteral("180d"), true, app);
+ * BluezQt::GattServerCharacteristic *measurement = new BluezQt::GattServerCharacteristic(QStringLiteral("2a37"), {QStringLiteral("notify")}, service);
+ * adapter->registerGattApplication(app);
+ * ...
+ * measurement->setValue(sample);
+ * @endcode
+ */
+class BLUEZQT_EXPORT GattApplication : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * Creates a new GattApplication object.
+     *
+     * The application is exported under /org/kde/bluezqt object path.
+     *
+     * @param parent
+     */
+    explicit GattApplication(QObject *parent = nullptr);
+
+    /**
+     * Creates a new GattApplication object.
+     *
+     * @param objectPathPrefix object path prefix of the application
+     * @param parent
+     */
+    explicit GattApplication(const QString &objectPathPrefix, QObject *parent = nullptr);
+
+    /**
+     * Destroys a GattApplication object.
+     */
+    ~GattApplication();
+
+    /**
+     * D-Bus object path of the application.
+     *
+     * @return object path of application
+     */
+    QDBusObjectPath objectPath() const;
+
+    /**
+     * Returns the services of the application.
+     *
+     * @return list of services
+     */
+    QList<GattServerService *> services() const;
+
+private:
+    class GattApplicationPrivate *const d;
+
+    friend class Adapter;
+    friend class GattApplicationPrivate;
+    friend class GattServerService;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTAPPLICATION_H
@@ -0,0 +1,73 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattapplicationadaptor.h"
+#include "gattapplication.h"
+#include "gattserverservice.h"
+#include "gattservercharacteristic.h"
+#include "utils.h"
+
+#include <QDBusMetaType>
+
+namespace BluezQt
+{
+
+GattApplicationAdaptor::GattApplicationAdaptor(GattApplication *parent)
+    : QDBusAbstractAdaptor(parent)
+    , m_application(parent)
+{
+    qDBusRegisterMetaType<DBusManagerStruct>();
+    qDBusRegisterMetaType<QVariantMapMap>();
+}
+
+DBusManagerStruct GattApplicationAdaptor::GetManagedObjects()
+{
+    DBusManagerStruct objects;
+
+    Q_FOREACH (GattServerService *service, m_application->services()) {
+        QVariantMap serviceProperties;
+        serviceProperties[QStringLiteral("UUID")] = service->uuid();
+        serviceProperties[QStringLiteral("Primary")] = service->isPrimary();
+
+        QVariantMapMap serviceInterfaces;
+        serviceInterfaces[Strings::orgBluezGattService1()] = serviceProperties;
+        objects[service->objectPath()] = serviceInterfaces;
+
+        Q_FOREACH (GattServerCharacteristic *characteristic, service->characteristics()) {
+            QVariantMap characteristicProperties;
+            characteristicProperties[QStringLiteral("UUID")] = characteristic->uuid();
+            characteristicProperties[QStringLiteral("Service")] = QVariant::fromValue(service->objectPath());
+            characteristicProperties[QStringLiteral("Flags")] = characteristic->flags();
+            characteristicProperties[QStringLiteral("Value")] = characteristic->value();
+            characteristicProperties[QStringLiteral("Notifying")] = characteristic->isNotifying();
+            characteristicProperties[QStringLiteral("NotifyAcquired")] = characteristic->isNotifyAcquired();
+
+            QVariantMapMap characteristicInterfaces;
+            characteristicInterfaces[Strings::orgBluezGattCharacteristic1()] = characteristicProperties;
+            objects[characteristic->objectPath()] = characteristicInterfaces;
+        }
+    }
+
+    return objects;
+}
+
+} // namespace BluezQt
@@ -0,0 +1,272 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattcharacteristic.h"
+#include "gattcharacteristic_p.h"
+#include "gattservice.h"
+#include "pendingcall.h"
+#include "pendingcall_p.h"
+#include "pendingreply.h"
+#include "callscheduler_p.h"
+#include "utils.h"
+#include "macros.h"
+#include "debug.h"
+
+#include <QSocketNotifier>
+#include <QDBusPendingReply>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace BluezQt
+{
+
+// Limits the time spent in one wakeup, the notifier fires again for remaining data
+static const int MaxNotificationsPerWakeup = 64;
+
+// Maximum length of attribute value
+static const int MaxValueLength = 512;
+
+GattCharacteristicPrivate::GattCharacteristicPrivate(const QString &path, const QVariantMap &properties, GattServicePtr service)
+    : QObject()
+    , m_service(service)
+    , m_notifyNotifier(nullptr)
+    , m_notifyMtu(0)
+{
+    m_bluezCharacteristic = new BluezGattCharacteristic(Strings::orgBluez(), path, DBusConnection::orgBluez(), this);
+
+    // Init properties
+    m_uuid = properties.value(QStringLiteral("UUID")).toString().toUpper();
+    m_flags = properties.value(QStringLiteral("Flags")).toStringList();
+    m_value = properties.value(QStringLiteral("Value")).toByteArray();
+    m_notifying = properties.value(QStringLiteral("Notifying")).toBool();
+}
+
+void GattCharacteristicPrivate::propertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated)
+{
+    if (interface != Strings::orgBluezGattCharacteristic1()) {
+        return;
+    }
+
+    QVariantMap::const_iterator i;
+    for (i = changed.constBegin(); i != changed.constEnd(); ++i) {
+        const QVariant &value = i.value();
+        const QString &property = i.key();
+
+        if (property == QLatin1String("Value")) {
+            PROPERTY_CHANGED(m_value, toByteArray, valueChanged);
+        } else if (property == QLatin1String("Notifying")) {
+            PROPERTY_CHANGED(m_notifying, toBool, notifyingChanged);
+        }
+    }
+
+    Q_FOREACH (const QString &property, invalidated) {
+        if (property == QLatin1String("Value")) {
+            PROPERTY_INVALIDATED(m_value, QByteArray(), valueChanged);
+        }
+    }
+}
+
+QString GattCharacteristicPrivate::acquireNotifyFinished(const QDBusUnixFileDescriptor &notifyFd, quint16 mtu)
+{
+    closeNotify();
+
+    m_notifyFd = notifyFd;
+    m_notifyMtu = mtu;
+
+    const int fd = m_notifyFd.fileDescriptor();
+    if (fd < 0 || ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK) < 0) {
+        qCWarning(BLUEZQT) << "GattCharacteristic: Invalid notification socket";
+        m_notifyFd = QDBusUnixFileDescriptor();
+        m_notifyMtu = 0;
+        return QStringLiteral("Invalid notification socket");
+    }
+
+    m_notifyBuffer.resize(qMax<int>(m_notifyMtu, MaxValueLength));
+
+    m_notifyNotifier = new QSocketNotifier(fd, QSocketNotifier::Read, this);
+    connect(m_notifyNotifier, &QSocketNotifier::activated, this, &GattCharacteristicPrivate::readNotifications);
+
+    Q_EMIT q.data()->notifyAcquiredChanged(true);
+    return QString();
+}
+
+void GattCharacteristicPrivate::readNotifications()
+{
+    const int fd = m_notifyFd.fileDescriptor();
+
+    for (int i = 0; i < MaxNotificationsPerWakeup; ++i) {
+        // Socket is SOCK_SEQPACKET, one read returns one notification
+        const ssize_t size = ::read(fd, m_notifyBuffer.data(), m_notifyBuffer.size());
+
+        if (size > 0) {
+            // Copied, so the value stays valid in queued connections
+            Q_EMIT q.data()->valueNotified(QByteArray(m_notifyBuffer.constData(), int(size)));
+
+            // Notifications were released in slot
+            if (!m_notifyNotifier) {
+                return;
+            }
+            continue;
+        }
+
+        if (size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        }
+
+        // Socket was closed by BlueZ, eg. when device disconnected
+        closeNotify();
+        return;
+    }
+}
+
+void GattCharacteristicPrivate::closeNotify()
+{
+    if (!m_notifyNotifier) {
+        return;
+    }
+
+    m_notifyNotifier->setEnabled(false);
+    m_notifyNotifier->deleteLater();
+    m_notifyNotifier = nullptr;
+
+    // Closes the socket
+    m_notifyFd = QDBusUnixFileDescriptor();
+    m_notifyMtu = 0;
+
+    Q_EMIT q.data()->notifyAcquiredChanged(false);
+}
+
+GattCharacteristic::GattCharacteristic(const QString &path, const QVariantMap &properties, GattServicePtr service)
+    : d(new GattCharacteristicPrivate(path, properties, service))
+{
+}
+
+GattCharacteristic::~GattCharacteristic()
+{
+    delete d;
+}
+
+GattCharacteristicPtr GattCharacteristic::toSharedPtr() const
+{
+    return d->q.toStrongRef();
+}
+
+QString GattCharacteristic::ubi() const
+{
+    return d->m_bluezCharacteristic->path();
+}
+
+QString GattCharacteristic::uuid() const
+{
+    return d->m_uuid;
+}
+
+QStringList GattCharacteristic::flags() const
+{
+    return d->m_flags;
+}
+
+QByteArray GattCharacteristic::value() const
+{
+    return d->m_value;
+}
+
+bool GattCharacteristic::isNotifying() const
+{
+    return d->m_notifying;
+}
+
+bool GattCharacteristic::isNotifyAcquired() const
+{
+    return d->m_notifyNotifier;
+}
+
+quint16 GattCharacteristic::notifyMtu() const
+{
+    return d->m_notifyMtu;
+}
+
+GattServicePtr GattCharacteristic::service() const
+{
+    return d->m_service.toStrongRef();
+}
+
+QList<GattDescriptorPtr> GattCharacteristic::descriptors() const
+{
+    return d->m_descriptors;
+}
+
+PendingReply<QByteArray> *GattCharacteristic::readValue()
+{
+    PendingReply<QByteArray> *reply = new PendingReply<QByteArray>(this);
+    CallSchedulerPrivate::scheduleCall(reply, ubi(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezCharacteristic->ReadValue(QVariantMap()));
+    });
+    return reply;
+}
+
+PendingCall *GattCharacteristic::writeValue(const QByteArray &value)
+{
+    return CallSchedulerPrivate::createCall(ubi(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezCharacteristic->WriteValue(value, QVariantMap()));
+    }, this);
+}
+
+PendingCall *GattCharacteristic::startNotify()
+{
+    return CallSchedulerPrivate::createCall(ubi(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezCharacteristic->StartNotify());
+    }, this);
+}
+
+PendingCall *GattCharacteristic::stopNotify()
+{
+    return CallSchedulerPrivate::createCall(ubi(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezCharacteristic->StopNotify());
+    }, this);
+}
+
+PendingCall *GattCharacteristic::acquireNotify()
+{
+    // Socket is set up before finished() is emitted, the call fails if it cannot be used
+    AcquireCallPrivate *dd = new AcquireCallPrivate(d, [this](const QDBusUnixFileDescriptor &fd, quint16 mtu) {
+        return d->acquireNotifyFinished(fd, mtu);
+    });
+
+    PendingCall *call = new PendingCall(dd, this);
+    CallSchedulerPrivate::scheduleCall(call, ubi(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezCharacteristic->AcquireNotify(QVariantMap()));
+    });
+    return call;
+}
+
+void GattCharacteristic::releaseNotify()
+{
+    d->closeNotify();
+}
+
+} // namespace BluezQt
@@ -0,0 +1,237 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTCHARACTERISTIC_H
+#define BLUEZQT_GATTCHARACTERISTIC_H
+
+#include <QObject>
+#include <QStringList>
+
+#include "types.h"
+#include "pendingreply.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::GattCharacteristic gattcharacteristic.h <BluezQt/GattCharacteristic>
+ *
+ * GATT characteristic.
+ *
+ * This class represents a characteristic of a GATT service.
+ *
+ * Notifications can be received in two ways. With startNotify(), each notification
+ * updates the value() property through a D-Bus PropertiesChanged signal.
+ *
+ * With acquireNotify(), BlueZ passes notifications through a socket instead,
+ * without any D-Bus traffic. Each notification is emitted as valueNotified() signal
+ * and value() is not updated. This is the preferred way for high rate notifications.
+ */
+class BLUEZQT_EXPORT GattCharacteristic : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString ubi READ ubi)
+    Q_PROPERTY(QString uuid READ uuid)
+    Q_PROPERTY(QStringList flags READ flags)
+    Q_PROPERTY(QByteArray value READ value NOTIFY valueChanged)
+    Q_PROPERTY(bool notifying READ isNotifying NOTIFY notifyingChanged)
+    Q_PROPERTY(bool notifyAcquired READ isNotifyAcquired NOTIFY notifyAcquiredChanged)
+    Q_PROPERTY(GattServicePtr service READ service)
+    Q_PROPERTY(QList<GattDescriptorPtr> descriptors READ descriptors)
+
+public:
+    /**
+     * Destroys a GattCharacteristic object.
+     */
+    ~GattCharacteristic();
+
+    /**
+     * Returns a shared pointer from this.
+     *
+     * @return GattCharacteristicPtr
+     */
+    GattCharacteristicPtr toSharedPtr() const;
+
+    /**
+     * Returns an UBI of the characteristic.
+     *
+     * Example UBI: "/org/bluez/hci0/dev_40_79_6A_0C_39_75/service000a/char000b"
+     *
+     * @return UBI of characteristic
+     */
+    QString ubi() const;
+
+    /**
+     * Returns the UUID of the characteristic.
+     *
+     * @return UUID of characteristic
+     */
+    QString uuid() const;
+
+    /**
+     * Returns the flags of the characteristic.
+     *
+     * Example flags: "read", "write", "write-without-response", "notify", "indicate"
+     *
+     * @return flags of characteristic
+     */
+    QStringList flags() const;
+
+    /**
+     * Returns the cached value of the characteristic.
+     *
+     * @return value of characteristic
+     */
+    QByteArray value() const;
+
+    /**
+     * Returns whether notifications are enabled with startNotify().
+     *
+     * @return true if notifying
+     */
+    bool isNotifying() const;
+
+    /**
+     * Returns whether notifications are acquired with acquireNotify().
+     *
+     * @return true if notifications are acquired
+     */
+    bool isNotifyAcquired() const;
+
+    /**
+     * Returns the MTU of acquired notifications.
+     *
+     * @return MTU, 0 if notifications are not acquired
+     */
+    quint16 notifyMtu() const;
+
+    /**
+     * Returns the service of the characteristic.
+     *
+     * @return service
+     */
+    GattServicePtr service() const;
+
+    /**
+     * Returns a list of descriptors of the characteristic.
+     *
+     * @return list of descriptors
+     */
+    QList<GattDescriptorPtr> descriptors() const;
+
+    /**
+     * Reads the value of the characteristic.
+     *
+     * Possible errors: PendingCall::Failed, PendingCall::InProgress,
+     *                  PendingCall::NotAuthorized, PendingCall::NotSupported
+     *
+     * @return QByteArray pending reply
+     */
+    PendingReply<QByteArray> *readValue();
+
+    /**
+     * Writes the value of the characteristic.
+     *
+     * Possible errors: PendingCall::Failed, PendingCall::InProgress,
+     *                  PendingCall::NotAuthorized, PendingCall::NotSupported
+     *
+     * @param value value
+     * @return void pending call
+     */
+    PendingCall *writeValue(const QByteArray &value);
+
+    /**
+     * Starts notifications of value changes.
+     *
+     * Possible errors: PendingCall::Failed, PendingCall::InProgress,
+     *                  PendingCall::NotSupported
+     *
+     * @return void pending call
+     */
+    PendingCall *startNotify();
+
+    /**
+     * Stops notifications of value changes.
+     *
+     * Possible errors: PendingCall::Failed
+     *
+     * @return void pending call
+     */
+    PendingCall *stopNotify();
+
+    /**
+     * Acquires notifications through a socket.
+     *
+     * When the call finishes successfully, notifications are emitted
+     * as valueNotified() signals. The call fails with PendingCall::Failed
+     * also when the acquired socket cannot be used.
+     *
+     * Possible errors: PendingCall::Failed, PendingCall::NotSupported
+     *
+     * @return void pending call
+     */
+    PendingCall *acquireNotify();
+
+    /**
+     * Releases notifications acquired with acquireNotify().
+     *
+     * BlueZ stops the notifications when the socket is closed.
+     */
+    void releaseNotify();
+
+Q_SIGNALS:
+    /**
+     * Indicates that the value of the characteristic have changed.
+     */
+    void valueChanged(const QByteArray &value);
+
+    /**
+     * Indicates that the notifying state have changed.
+     */
+    void notifyingChanged(bool notifying);
+
+    /**
+     * Indicates that the notifications were acquired or released.
+     */
+    void notifyAcquiredChanged(bool acquired);
+
+    /**
+     * Indicates that a notification was received through acquired socket.
+     *
+     * @param value notified value
+     */
+    void valueNotified(const QByteArray &value);
+
+private:
+    explicit GattCharacteristic(const QString &path, const QVariantMap &properties, GattServicePtr service);
+
+    class GattCharacteristicPrivate *const d;
+
+    friend class GattCharacteristicPrivate;
+    friend class DevicePrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTCHARACTERISTIC_H
@@ -0,0 +1,72 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTCHARACTERISTIC_P_H
+#define BLUEZQT_GATTCHARACTERISTIC_P_H
+
+#include <QObject>
+#include <QStringList>
+#include <QDBusUnixFileDescriptor>
+
+#include "gattcharacteristic.h"
+#include "bluezgattcharacteristic1.h"
+
+class QSocketNotifier;
+
+namespace BluezQt
+{
+
+typedef org::bluez::GattCharacteristic1 BluezGattCharacteristic;
+
+class GattCharacteristicPrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit GattCharacteristicPrivate(const QString &path, const QVariantMap &properties, GattServicePtr service);
+
+    void propertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated);
+
+    QString acquireNotifyFinished(const QDBusUnixFileDescriptor &notifyFd, quint16 mtu);
+    void readNotifications();
+    void closeNotify();
+
+    QWeakPointer<GattCharacteristic> q;
+    BluezGattCharacteristic *m_bluezCharacteristic;
+
+    QString m_uuid;
+    QStringList m_flags;
+    QByteArray m_value;
+    bool m_notifying;
+    QWeakPointer<GattService> m_service;
+    QList<GattDescriptorPtr> m_descriptors;
+
+    // Acquired notifications
+    QDBusUnixFileDescriptor m_notifyFd;
+    QSocketNotifier *m_notifyNotifier;
+    QByteArray m_notifyBuffer;
+    quint16 m_notifyMtu;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTCHARACTERISTIC_P_H
@@ -0,0 +1,129 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattcharacteristicadaptor.h"
+#include "gattservercharacteristic.h"
+#include "gattservercharacteristic_p.h"
+#include "gattserverservice.h"
+#include "utils.h"
+
+#include <QDBusMessage>
+#include <QDBusConnection>
+
+namespace BluezQt
+{
+
+// Default ATT MTU, used when BlueZ does not pass the negotiated one
+static const quint16 DefaultMtu = 23;
+
+static void sendInvalidOffset(const QDBusMessage &msg)
+{
+    msg.setDelayedReply(true);
+    DBusConnection::orgBluez().send(msg.createErrorReply(QStringLiteral("org.bluez.Error.InvalidOffset"),
+                                                         QStringLiteral("Invalid offset")));
+}
+
+GattCharacteristicAdaptor::GattCharacteristicAdaptor(GattServerCharacteristic *parent)
+    : QDBusAbstractAdaptor(parent)
+    , m_characteristic(parent)
+{
+}
+
+QString GattCharacteristicAdaptor::uuid() const
+{
+    return m_characteristic->uuid();
+}
+
+QDBusObjectPath GattCharacteristicAdaptor::service() const
+{
+    return m_characteristic->service()->objectPath();
+}
+
+QStringList GattCharacteristicAdaptor::flags() const
+{
+    return m_characteristic->flags();
+}
+
+QByteArray GattCharacteristicAdaptor::value() const
+{
+    return m_characteristic->value();
+}
+
+bool GattCharacteristicAdaptor::notifying() const
+{
+    return m_characteristic->isNotifying();
+}
+
+bool GattCharacteristicAdaptor::notifyAcquired() const
+{
+    return m_characteristic->isNotifyAcquired();
+}
+
+QByteArray GattCharacteristicAdaptor::ReadValue(const QVariantMap &options, const QDBusMessage &msg)
+{
+    // Long reads (Read Blob) continue at offset
+    const QByteArray &value = m_characteristic->value();
+    const int offset = options.value(QStringLiteral("offset")).toInt();
+
+    if (offset < 0 || offset > value.size()) {
+        sendInvalidOffset(msg);
+        return QByteArray();
+    }
+
+    return value.mid(offset);
+}
+
+void GattCharacteristicAdaptor::WriteValue(const QByteArray &value, const QVariantMap &options, const QDBusMessage &msg)
+{
+    // Long writes send the value in parts, each part replaces the value from its offset
+    const int offset = options.value(QStringLiteral("offset")).toInt();
+
+    if (offset < 0 || offset > m_characteristic->value().size()) {
+        sendInvalidOffset(msg);
+        return;
+    }
+
+    if (offset == 0) {
+        m_characteristic->d->writeValue(value);
+        return;
+    }
+
+    m_characteristic->d->writeValue(m_characteristic->value().left(offset) + value);
+}
+
+void GattCharacteristicAdaptor::StartNotify()
+{
+    m_characteristic->d->startNotify();
+}
+
+void GattCharacteristicAdaptor::StopNotify()
+{
+    m_characteristic->d->stopNotify();
+}
+
+QDBusUnixFileDescriptor GattCharacteristicAdaptor::AcquireNotify(const QVariantMap &options, quint16 &mtu)
+{
+    mtu = options.value(QStringLiteral("mtu"), DefaultMtu).value<quint16>();
+    return m_characteristic->d->acquireNotify(options);
+}
+
+} // namespace BluezQt
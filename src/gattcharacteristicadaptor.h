@@ -0,0 +1,72 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTCHARACTERISTICADAPTOR_H
+#define BLUEZQT_GATTCHARACTERISTICADAPTOR_H
+
+#include <QStringList>
+#include <QDBusObjectPath>
+#include <QDBusAbstractAdaptor>
+#include <QDBusUnixFileDescriptor>
+
+class QDBusMessage;
+
+namespace BluezQt
+{
+
+class GattServerCharacteristic;
+
+class GattCharacteristicAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.bluez.GattCharacteristic1")
+    Q_PROPERTY(QString UUID READ uuid)
+    Q_PROPERTY(QDBusObjectPath Service READ service)
+    Q_PROPERTY(QStringList Flags READ flags)
+    Q_PROPERTY(QByteArray Value READ value)
+    Q_PROPERTY(bool Notifying READ notifying)
+    Q_PROPERTY(bool NotifyAcquired READ notifyAcquired)
+
+public:
+    explicit GattCharacteristicAdaptor(GattServerCharacteristic *parent);
+
+    QString uuid() const;
+    QDBusObjectPath service() const;
+    QStringList flags() const;
+    QByteArray value() const;
+    bool notifying() const;
+    bool notifyAcquired() const;
+
+public Q_SLOTS:
+    QByteArray ReadValue(const QVariantMap &options, const QDBusMessage &msg);
+    void WriteValue(const QByteArray &value, const QVariantMap &options, const QDBusMessage &msg);
+    void StartNotify();
+    void StopNotify();
+    QDBusUnixFileDescriptor AcquireNotify(const QVariantMap &options, quint16 &mtu);
+
+private:
+    GattServerCharacteristic *m_characteristic;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTCHARACTERISTICADAPTOR_H
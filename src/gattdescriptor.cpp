@@ -0,0 +1,120 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattdescriptor.h"
+#include "gattdescriptor_p.h"
+#include "gattcharacteristic.h"
+#include "pendingcall.h"
+#include "pendingreply.h"
+#include "callscheduler_p.h"
+#include "utils.h"
+#include "macros.h"
+
+namespace BluezQt
+{
+
+GattDescriptorPrivate::GattDescriptorPrivate(const QString &path, const QVariantMap &properties, GattCharacteristicPtr characteristic)
+    : QObject()
+    , m_characteristic(characteristic)
+{
+    m_bluezDescriptor = new BluezGattDescriptor(Strings::orgBluez(), path, DBusConnection::orgBluez(), this);
+
+    // Init properties
+    m_uuid = properties.value(QStringLiteral("UUID")).toString().toUpper();
+    m_value = properties.value(QStringLiteral("Value")).toByteArray();
+}
+
+void GattDescriptorPrivate::propertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated)
+{
+    if (interface != Strings::orgBluezGattDescriptor1()) {
+        return;
+    }
+
+    QVariantMap::const_iterator i;
+    for (i = changed.constBegin(); i != changed.constEnd(); ++i) {
+        const QVariant &value = i.value();
+        const QString &property = i.key();
+
+        if (property == QLatin1String("Value")) {
+            PROPERTY_CHANGED(m_value, toByteArray, valueChanged);
+        }
+    }
+
+    Q_FOREACH (const QString &property, invalidated) {
+        if (property == QLatin1String("Value")) {
+            PROPERTY_INVALIDATED(m_value, QByteArray(), valueChanged);
+        }
+    }
+}
+
+GattDescriptor::GattDescriptor(const QString &path, const QVariantMap &properties, GattCharacteristicPtr characteristic)
+    : d(new GattDescriptorPrivate(path, properties, characteristic))
+{
+}
+
+GattDescriptor::~GattDescriptor()
+{
+    delete d;
+}
+
+GattDescriptorPtr GattDescriptor::toSharedPtr() const
+{
+    return d->q.toStrongRef();
+}
+
+QString GattDescriptor::ubi() const
+{
+    return d->m_bluezDescriptor->path();
+}
+
+QString GattDescriptor::uuid() const
+{
+    return d->m_uuid;
+}
+
+QByteArray GattDescriptor::value() const
+{
+    return d->m_value;
+}
+
+GattCharacteristicPtr GattDescriptor::characteristic() const
+{
+    return d->m_characteristic.toStrongRef();
+}
+
+PendingReply<QByteArray> *GattDescriptor::readValue()
+{
+    PendingReply<QByteArray> *reply = new PendingReply<QByteArray>(this);
+    CallSchedulerPrivate::scheduleCall(reply, ubi(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezDescriptor->ReadValue(QVariantMap()));
+    });
+    return reply;
+}
+
+PendingCall *GattDescriptor::writeValue(const QByteArray &value)
+{
+    return CallSchedulerPrivate::createCall(ubi(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezDescriptor->WriteValue(value, QVariantMap()));
+    }, this);
+}
+
+} // namespace BluezQt
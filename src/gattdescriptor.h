@@ -0,0 +1,130 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTDESCRIPTOR_H
+#define BLUEZQT_GATTDESCRIPTOR_H
+
+#include <QObject>
+
+#include "types.h"
+#include "pendingreply.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::GattDescriptor gattdescriptor.h <BluezQt/GattDescriptor>
+ *
+ * GATT descriptor.
+ *
+ * This class represents a descriptor of a GATT characteristic.
+ */
+class BLUEZQT_EXPORT GattDescriptor : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString ubi READ ubi)
+    Q_PROPERTY(QString uuid READ uuid)
+    Q_PROPERTY(QByteArray value READ value NOTIFY valueChanged)
+    Q_PROPERTY(GattCharacteristicPtr characteristic READ characteristic)
+
+public:
+    /**
+     * Destroys a GattDescriptor object.
+     */
+    ~GattDescriptor();
+
+    /**
+     * Returns a shared pointer from this.
+     *
+     * @return GattDescriptorPtr
+     */
+    GattDescriptorPtr toSharedPtr() const;
+
+    /**
+     * Returns an UBI of the descriptor.
+     *
+     * @return UBI of descriptor
+     */
+    QString ubi() const;
+
+    /**
+     * Returns the UUID of the descriptor.
+     *
+     * @return UUID of descriptor
+     */
+    QString uuid() const;
+
+    /**
+     * Returns the cached value of the descriptor.
+     *
+     * @return value of descriptor
+     */
+    QByteArray value() const;
+
+    /**
+     * Returns the characteristic of the descriptor.
+     *
+     * @return characteristic
+     */
+    GattCharacteristicPtr characteristic() const;
+
+    /**
+     * Reads the value of the descriptor.
+     *
+     * Possible errors: PendingCall::Failed, PendingCall::InProgress,
+     *                  PendingCall::NotAuthorized, PendingCall::NotSupported
+     *
+     * @return QByteArray pending reply
+     */
+    PendingReply<QByteArray> *readValue();
+
+    /**
+     * Writes the value of the descriptor.
+     *
+     * Possible errors: PendingCall::Failed, PendingCall::InProgress,
+     *                  PendingCall::NotAuthorized, PendingCall::NotSupported
+     *
+     * @param value value
+     * @return void pending call
+     */
+    PendingCall *writeValue(const QByteArray &value);
+
+Q_SIGNALS:
+    /**
+     * Indicates that the value of the descriptor have changed.
+     */
+    void valueChanged(const QByteArray &value);
+
+private:
+    explicit GattDescriptor(const QString &path, const QVariantMap &properties, GattCharacteristicPtr characteristic);
+
+    class GattDescriptorPrivate *const d;
+
+    friend class GattDescriptorPrivate;
+    friend class DevicePrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTDESCRIPTOR_H
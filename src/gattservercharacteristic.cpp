@@ -0,0 +1,276 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattservercharacteristic.h"
+#include "gattservercharacteristic_p.h"
+#include "gattcharacteristicadaptor.h"
+#include "gattserverservice.h"
+#include "gattserverservice_p.h"
+#include "utils.h"
+#include "debug.h"
+
+#include <QTimer>
+#include <QSocketNotifier>
+#include <QDBusMessage>
+#include <QDBusConnection>
+#include <QDBusObjectPath>
+#include <QDBusUnixFileDescriptor>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace BluezQt
+{
+
+static const int DefaultNotificationInterval = 30;
+
+GattServerCharacteristicPrivate::GattServerCharacteristicPrivate(GattServerCharacteristic *q)
+    : QObject()
+    , q(q)
+    , m_service(nullptr)
+    , m_notifying(false)
+    , m_notifyPending(false)
+    , m_notifyFd(-1)
+    , m_notifyNotifier(nullptr)
+{
+    m_notifyTimer = new QTimer(this);
+    m_notifyTimer->setSingleShot(true);
+    m_notifyTimer->setInterval(DefaultNotificationInterval);
+    connect(m_notifyTimer, &QTimer::timeout, this, &GattServerCharacteristicPrivate::notificationTimeout);
+}
+
+GattServerCharacteristicPrivate::~GattServerCharacteristicPrivate()
+{
+    if (m_notifyFd != -1) {
+        ::close(m_notifyFd);
+    }
+}
+
+void GattServerCharacteristicPrivate::writeValue(const QByteArray &value)
+{
+    m_value = value;
+    Q_EMIT q->valueWritten(value);
+}
+
+void GattServerCharacteristicPrivate::startNotify()
+{
+    if (m_notifying) {
+        return;
+    }
+
+    m_notifying = true;
+    emitPropertiesChanged({{QStringLiteral("Notifying"), true}});
+    Q_EMIT q->notifyingChanged(true);
+}
+
+void GattServerCharacteristicPrivate::stopNotify()
+{
+    if (!m_notifying) {
+        return;
+    }
+
+    m_notifying = false;
+    emitPropertiesChanged({{QStringLiteral("Notifying"), false}});
+    Q_EMIT q->notifyingChanged(false);
+}
+
+QDBusUnixFileDescriptor GattServerCharacteristicPrivate::acquireNotify(const QVariantMap &options)
+{
+    Q_UNUSED(options)
+
+    closeNotifySocket();
+
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) < 0) {
+        qCWarning(BLUEZQT) << "GattServerCharacteristic: Cannot create notification socket";
+        return QDBusUnixFileDescriptor();
+    }
+
+    ::fcntl(fds[0], F_SETFL, ::fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    m_notifyFd = fds[0];
+
+    // BlueZ closes its end when the remote device unsubscribes
+    m_notifyNotifier = new QSocketNotifier(m_notifyFd, QSocketNotifier::Read, this);
+    connect(m_notifyNotifier, &QSocketNotifier::activated, this, [this]() {
+        char c;
+        const ssize_t ret = ::recv(m_notifyFd, &c, sizeof(c), 0);
+        if (ret == 0 || (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            closeNotifySocket();
+        }
+    });
+
+    // QDBusUnixFileDescriptor keeps its own duplicate
+    const QDBusUnixFileDescriptor fd(fds[1]);
+    ::close(fds[1]);
+
+    emitPropertiesChanged({{QStringLiteral("NotifyAcquired"), true}});
+    Q_EMIT q->notifyAcquiredChanged(true);
+
+    return fd;
+}
+
+void GattServerCharacteristicPrivate::scheduleNotification()
+{
+    if (!m_notifying && m_notifyFd == -1) {
+        return;
+    }
+
+    // First update is sent right away, updates during the interval only keep the latest value
+    if (m_notifyTimer->isActive()) {
+        m_notifyPending = true;
+        return;
+    }
+
+    sendNotification();
+    m_notifyTimer->start();
+}
+
+void GattServerCharacteristicPrivate::notificationTimeout()
+{
+    if (!m_notifyPending) {
+        return;
+    }
+
+    m_notifyPending = false;
+    sendNotification();
+    m_notifyTimer->start();
+}
+
+void GattServerCharacteristicPrivate::sendNotification()
+{
+    if (m_notifyFd != -1) {
+        // Socket is SOCK_SEQPACKET, one send is one notification
+        const ssize_t ret = ::send(m_notifyFd, m_value.constData(), m_value.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            m_notifyPending = true;
+        } else if (ret < 0) {
+            closeNotifySocket();
+        }
+        return;
+    }
+
+    if (m_notifying) {
+        emitPropertiesChanged({{QStringLiteral("Value"), m_value}});
+    }
+}
+
+void GattServerCharacteristicPrivate::emitPropertiesChanged(const QVariantMap &changed)
+{
+    QDBusMessage signal = QDBusMessage::createSignal(m_objectPath,
+                                                     Strings::orgFreedesktopDBusProperties(),
+                                                     QStringLiteral("PropertiesChanged"));
+    signal << Strings::orgBluezGattCharacteristic1();
+    signal << changed;
+    signal << QStringList();
+    DBusConnection::orgBluez().send(signal);
+}
+
+void GattServerCharacteristicPrivate::closeNotifySocket()
+{
+    if (m_notifyFd == -1) {
+        return;
+    }
+
+    m_notifyNotifier->setEnabled(false);
+    m_notifyNotifier->deleteLater();
+    m_notifyNotifier = nullptr;
+
+    ::close(m_notifyFd);
+    m_notifyFd = -1;
+
+    emitPropertiesChanged({{QStringLiteral("NotifyAcquired"), false}});
+    Q_EMIT q->notifyAcquiredChanged(false);
+}
+
+GattServerCharacteristic::GattServerCharacteristic(const QString &uuid, const QStringList &flags, GattServerService *service)
+    : QObject(service)
+    , d(new GattServerCharacteristicPrivate(this))
+{
+    Q_ASSERT(service);
+
+    d->m_service = service;
+    d->m_objectPath = service->objectPath().path() + QStringLiteral("/char") + QString::number(service->d->m_characteristicNumber++);
+    d->m_uuid = uuid;
+    d->m_flags = flags;
+
+    new GattCharacteristicAdaptor(this);
+}
+
+GattServerCharacteristic::~GattServerCharacteristic()
+{
+    delete d;
+}
+
+QDBusObjectPath GattServerCharacteristic::objectPath() const
+{
+    return QDBusObjectPath(d->m_objectPath);
+}
+
+QString GattServerCharacteristic::uuid() const
+{
+    return d->m_uuid;
+}
+
+QStringList GattServerCharacteristic::flags() const
+{
+    return d->m_flags;
+}
+
+GattServerService *GattServerCharacteristic::service() const
+{
+    return d->m_service;
+}
+
+QByteArray GattServerCharacteristic::value() const
+{
+    return d->m_value;
+}
+
+void GattServerCharacteristic::setValue(const QByteArray &value)
+{
+    d->m_value = value;
+    d->scheduleNotification();
+}
+
+bool GattServerCharacteristic::isNotifying() const
+{
+    return d->m_notifying;
+}
+
+bool GattServerCharacteristic::isNotifyAcquired() const
+{
+    return d->m_notifyFd != -1;
+}
+
+int GattServerCharacteristic::notificationInterval() const
+{
+    return d->m_notifyTimer->interval();
+}
+
+void GattServerCharacteristic::setNotificationInterval(int msecs)
+{
+    d->m_notifyTimer->setInterval(qMax(0, msecs));
+}
+
+} // namespace BluezQt
@@ -0,0 +1,183 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTSERVERCHARACTERISTIC_H
+#define BLUEZQT_GATTSERVERCHARACTERISTIC_H
+
+#include <QObject>
+#include <QStringList>
+
+#include "bluezqt_export.h"
+
+class QDBusObjectPath;
+
+namespace BluezQt
+{
+
+class GattServerService;
+
+/**
+ * @class BluezQt::GattServerCharacteristic gattservercharacteristic.h <BluezQt/GattServerCharacteristic>
+ *
+ * Local GATT characteristic.
+ *
+ * This class represents a characteristic of GattServerService.
+ *
+ * Remote devices read the current value() and writes are reported with valueWritten().
+ *
+ * When a remote device subscribes to notifications, setValue() sends the new value
+ * as notification. Notifications are coalesced: at most one notification is sent per
+ * notificationInterval(), always with the latest value, so a sensor can update
+ * the value at any rate without flooding the link.
+ *
+ * BlueZ subscribes either with StartNotify, in which case notifications are sent
+ * as D-Bus PropertiesChanged signals, or with AcquireNotify, in which case they are
+ * written to a socket without any D-Bus traffic.
+ *
+ * @see GattApplication
+ */
+class BLUEZQT_EXPORT GattServerCharacteristic : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString uuid READ uuid)
+    Q_PROPERTY(QStringList flags READ flags)
+    Q_PROPERTY(QByteArray value READ value WRITE setValue)
+    Q_PROPERTY(bool notifying READ isNotifying NOTIFY notifyingChanged)
+    Q_PROPERTY(bool notifyAcquired READ isNotifyAcquired NOTIFY notifyAcquiredChanged)
+    Q_PROPERTY(int notificationInterval READ notificationInterval WRITE setNotificationInterval)
+
+public:
+    /**
+     * Creates a new GattServerCharacteristic object.
+     *
+     * @param uuid UUID of the characteristic
+     * @param flags flags of the characteristic, eg. "read", "write", "notify"
+     * @param service service of the characteristic
+     */
+    explicit GattServerCharacteristic(const QString &uuid, const QStringList &flags, GattServerService *service);
+
+    /**
+     * Destroys a GattServerCharacteristic object.
+     */
+    ~GattServerCharacteristic();
+
+    /**
+     * D-Bus object path of the characteristic.
+     *
+     * @return object path of characteristic
+     */
+    QDBusObjectPath objectPath() const;
+
+    /**
+     * Returns the UUID of the characteristic.
+     *
+     * @return UUID of characteristic
+     */
+    QString uuid() const;
+
+    /**
+     * Returns the flags of the characteristic.
+     *
+     * @return flags of characteristic
+     */
+    QStringList flags() const;
+
+    /**
+     * Returns the service of the characteristic.
+     *
+     * @return service
+     */
+    GattServerService *service() const;
+
+    /**
+     * Returns the value of the characteristic.
+     *
+     * @return value of characteristic
+     */
+    QByteArray value() const;
+
+    /**
+     * Sets the value of the characteristic.
+     *
+     * If notifications are enabled, the value is sent as notification.
+     *
+     * @param value value of characteristic
+     */
+    void setValue(const QByteArray &value);
+
+    /**
+     * Returns whether notifications are enabled with StartNotify.
+     *
+     * @return true if notifying
+     */
+    bool isNotifying() const;
+
+    /**
+     * Returns whether notifications are acquired with AcquireNotify.
+     *
+     * @return true if notifications are acquired
+     */
+    bool isNotifyAcquired() const;
+
+    /**
+     * Returns the minimum interval between notifications.
+     *
+     * Default is 30 milliseconds, a common BLE connection interval.
+     *
+     * @return interval in milliseconds
+     */
+    int notificationInterval() const;
+
+    /**
+     * Sets the minimum interval between notifications.
+     *
+     * @param msecs interval in milliseconds, 0 sends the latest value
+     *              once per event loop iteration
+     */
+    void setNotificationInterval(int msecs);
+
+Q_SIGNALS:
+    /**
+     * Indicates that a remote device wrote the value.
+     */
+    void valueWritten(const QByteArray &value);
+
+    /**
+     * Indicates that notifications were enabled or disabled with StartNotify/StopNotify.
+     */
+    void notifyingChanged(bool notifying);
+
+    /**
+     * Indicates that notifications were acquired or released.
+     */
+    void notifyAcquiredChanged(bool notifyAcquired);
+
+private:
+    class GattServerCharacteristicPrivate *const d;
+
+    friend class GattCharacteristicAdaptor;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTSERVERCHARACTERISTIC_H
@@ -0,0 +1,78 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTSERVERCHARACTERISTIC_P_H
+#define BLUEZQT_GATTSERVERCHARACTERISTIC_P_H
+
+#include <QObject>
+#include <QStringList>
+#include <QVariantMap>
+
+class QTimer;
+class QSocketNotifier;
+class QDBusUnixFileDescriptor;
+
+namespace BluezQt
+{
+
+class GattServerService;
+class GattServerCharacteristic;
+
+class GattServerCharacteristicPrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit GattServerCharacteristicPrivate(GattServerCharacteristic *q);
+    ~GattServerCharacteristicPrivate();
+
+    void writeValue(const QByteArray &value);
+    void startNotify();
+    void stopNotify();
+    QDBusUnixFileDescriptor acquireNotify(const QVariantMap &options);
+
+    void scheduleNotification();
+    void notificationTimeout();
+    void sendNotification();
+    void emitPropertiesChanged(const QVariantMap &changed);
+    void closeNotifySocket();
+
+    GattServerCharacteristic *q;
+    GattServerService *m_service;
+    QString m_objectPath;
+    QString m_uuid;
+    QStringList m_flags;
+    QByteArray m_value;
+    bool m_notifying;
+
+    // Coalescing of notifications
+    QTimer *m_notifyTimer;
+    bool m_notifyPending;
+
+    // Acquired notifications
+    int m_notifyFd;
+    QSocketNotifier *m_notifyNotifier;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTSERVERCHARACTERISTIC_P_H
@@ -0,0 +1,80 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattserverservice.h"
+#include "gattserverservice_p.h"
+#include "gattserviceadaptor.h"
+#include "gattapplication.h"
+#include "gattapplication_p.h"
+#include "gattservercharacteristic.h"
+
+#include <QDBusObjectPath>
+
+namespace BluezQt
+{
+
+GattServerService::GattServerService(const QString &uuid, bool isPrimary, GattApplication *parent)
+    : QObject(parent)
+    , d(new GattServerServicePrivate)
+{
+    Q_ASSERT(parent);
+
+    d->m_application = parent;
+    d->m_objectPath = parent->objectPath().path() + QStringLiteral("/service") + QString::number(parent->d->m_serviceNumber++);
+    d->m_uuid = uuid;
+    d->m_primary = isPrimary;
+    d->m_characteristicNumber = 0;
+
+    new GattServiceAdaptor(this);
+}
+
+GattServerService::~GattServerService()
+{
+    delete d;
+}
+
+QDBusObjectPath GattServerService::objectPath() const
+{
+    return QDBusObjectPath(d->m_objectPath);
+}
+
+QString GattServerService::uuid() const
+{
+    return d->m_uuid;
+}
+
+bool GattServerService::isPrimary() const
+{
+    return d->m_primary;
+}
+
+GattApplication *GattServerService::application() const
+{
+    return d->m_application;
+}
+
+QList<GattServerCharacteristic *> GattServerService::characteristics() const
+{
+    return findChildren<GattServerCharacteristic*>(QString(), Qt::FindDirectChildrenOnly);
+}
+
+} // namespace BluezQt
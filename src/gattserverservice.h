@@ -0,0 +1,112 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTSERVERSERVICE_H
+#define BLUEZQT_GATTSERVERSERVICE_H
+
+#include <QObject>
+
+#include "bluezqt_export.h"
+
+class QDBusObjectPath;
+
+namespace BluezQt
+{
+
+class GattApplication;
+class GattServerCharacteristic;
+
+/**
+ * @class BluezQt::GattServerService gattserverservice.h <BluezQt/GattServerService>
+ *
+ * Local GATT service.
+ *
+ * This class represents a service of GattApplication.
+ *
+ * @see GattApplication
+ */
+class BLUEZQT_EXPORT GattServerService : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString uuid READ uuid)
+    Q_PROPERTY(bool primary READ isPrimary)
+
+public:
+    /**
+     * Creates a new GattServerService object.
+     *
+     * @param uuid UUID of the service
+     * @param isPrimary whether the service is primary
+     * @param parent application of the service
+     */
+    explicit GattServerService(const QString &uuid, bool isPrimary, GattApplication *parent);
+
+    /**
+     * Destroys a GattServerService object.
+     */
+    ~GattServerService();
+
+    /**
+     * D-Bus object path of the service.
+     *
+     * @return object path of service
+     */
+    QDBusObjectPath objectPath() const;
+
+    /**
+     * Returns the UUID of the service.
+     *
+     * @return UUID of service
+     */
+    QString uuid() const;
+
+    /**
+     * Returns whether the service is primary.
+     *
+     * @return true if service is primary
+     */
+    bool isPrimary() const;
+
+    /**
+     * Returns the application of the service.
+     *
+     * @return application
+     */
+    GattApplication *application() const;
+
+    /**
+     * Returns the characteristics of the service.
+     *
+     * @return list of characteristics
+     */
+    QList<GattServerCharacteristic *> characteristics() const;
+
+private:
+    class GattServerServicePrivate *const d;
+
+    friend class GattServerCharacteristic;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTSERVERSERVICE_H
@@ -0,0 +1,89 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattservice.h"
+#include "gattservice_p.h"
+#include "gattcharacteristic.h"
+#include "utils.h"
+
+#include <QVariantMap>
+
+namespace BluezQt
+{
+
+GattServicePrivate::GattServicePrivate(const QString &path, const QVariantMap &properties)
+    : QObject()
+    , m_path(path)
+{
+    // Init properties
+    m_uuid = properties.value(QStringLiteral("UUID")).toString().toUpper();
+    m_primary = properties.value(QStringLiteral("Primary")).toBool();
+}
+
+GattService::GattService(const QString &path, const QVariantMap &properties)
+    : d(new GattServicePrivate(path, properties))
+{
+}
+
+GattService::~GattService()
+{
+    delete d;
+}
+
+GattServicePtr GattService::toSharedPtr() const
+{
+    return d->q.toStrongRef();
+}
+
+QString GattService::ubi() const
+{
+    return d->m_path;
+}
+
+QString GattService::uuid() const
+{
+    return d->m_uuid;
+}
+
+bool GattService::isPrimary() const
+{
+    return d->m_primary;
+}
+
+QList<GattCharacteristicPtr> GattService::characteristics() const
+{
+    return d->m_characteristics;
+}
+
+GattCharacteristicPtr GattService::characteristicForUuid(const QString &uuid) const
+{
+    const QString &upperUuid = uuid.toUpper();
+
+    Q_FOREACH (GattCharacteristicPtr characteristic, d->m_characteristics) {
+        if (characteristic->uuid() == upperUuid) {
+            return characteristic;
+        }
+    }
+    return GattCharacteristicPtr();
+}
+
+} // namespace BluezQt
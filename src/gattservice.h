@@ -0,0 +1,127 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTSERVICE_H
+#define BLUEZQT_GATTSERVICE_H
+
+#include <QObject>
+
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::GattService gattservice.h <BluezQt/GattService>
+ *
+ * GATT service.
+ *
+ * This class represents a GATT service of a remote device.
+ *
+ * Services are resolved by BlueZ after the device is connected.
+ *
+ * @see Device::gattServices()
+ */
+class BLUEZQT_EXPORT GattService : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString ubi READ ubi)
+    Q_PROPERTY(QString uuid READ uuid)
+    Q_PROPERTY(bool primary READ isPrimary)
+    Q_PROPERTY(QList<GattCharacteristicPtr> characteristics READ characteristics)
+
+public:
+    /**
+     * Destroys a GattService object.
+     */
+    ~GattService();
+
+    /**
+     * Returns a shared pointer from this.
+     *
+     * @return GattServicePtr
+     */
+    GattServicePtr toSharedPtr() const;
+
+    /**
+     * Returns an UBI of the service.
+     *
+     * Example UBI: "/org/bluez/hci0/dev_40_79_6A_0C_39_75/service000a"
+     *
+     * @return UBI of service
+     */
+    QString ubi() const;
+
+    /**
+     * Returns the UUID of the service.
+     *
+     * @return UUID of service
+     */
+    QString uuid() const;
+
+    /**
+     * Returns whether the service is primary.
+     *
+     * @return true if service is primary
+     */
+    bool isPrimary() const;
+
+    /**
+     * Returns a list of characteristics of the service.
+     *
+     * @return list of characteristics
+     */
+    QList<GattCharacteristicPtr> characteristics() const;
+
+    /**
+     * Returns a characteristic for specified UUID.
+     *
+     * @param uuid UUID of characteristic
+     * @return null if there is no characteristic with specified UUID
+     */
+    GattCharacteristicPtr characteristicForUuid(const QString &uuid) const;
+
+Q_SIGNALS:
+    /**
+     * Indicates that a characteristic was added.
+     */
+    void characteristicAdded(GattCharacteristicPtr characteristic);
+
+    /**
+     * Indicates that a characteristic was removed.
+     */
+    void characteristicRemoved(GattCharacteristicPtr characteristic);
+
+private:
+    explicit GattService(const QString &path, const QVariantMap &properties);
+
+    class GattServicePrivate *const d;
+
+    friend class GattServicePrivate;
+    friend class DevicePrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTSERVICE_H
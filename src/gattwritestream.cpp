@@ -0,0 +1,346 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gattwritestream.h"
+#include "gattwritestream_p.h"
+#include "gattcharacteristic.h"
+#include "pendingcall.h"
+#include "pendingcall_p.h"
+#include "callscheduler_p.h"
+#include "utils.h"
+#include "debug.h"
+
+#include <QTimer>
+#include <QSocketNotifier>
+#include <QDBusPendingReply>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+
+namespace BluezQt
+{
+
+// Opcode and handle of ATT Write Command
+static const int AttHeaderSize = 3;
+
+static const int DefaultMaxBufferSize = 64 * 1024;
+
+GattWriteStreamPrivate::GattWriteStreamPrivate(GattWriteStream *q, GattCharacteristicPtr characteristic)
+    : QObject()
+    , q(q)
+    , m_characteristic(characteristic)
+    , m_bluezCharacteristic(nullptr)
+    , m_notifier(nullptr)
+    , m_mtu(0)
+    , m_flushScheduled(false)
+    , m_offset(0)
+    , m_maxBufferSize(DefaultMaxBufferSize)
+    , m_enqueued(0)
+    , m_written(0)
+    , m_totalBytes(0)
+    , m_totalPackets(0)
+    , m_firstWrite(-1)
+    , m_lastWrite(-1)
+    , m_latencySum(0)
+    , m_latencyCount(0)
+    , m_latencyMax(0)
+{
+    if (characteristic) {
+        m_bluezCharacteristic = new BluezGattCharacteristic(Strings::orgBluez(), characteristic->ubi(), DBusConnection::orgBluez(), this);
+    }
+
+    m_clock.start();
+}
+
+QString GattWriteStreamPrivate::acquireWriteFinished(const QDBusUnixFileDescriptor &writeFd, quint16 mtu)
+{
+    // Opened twice at the same time
+    if (m_notifier) {
+        return QStringLiteral("Stream is already open");
+    }
+
+    m_fd = writeFd;
+    m_mtu = mtu;
+
+    const int fd = m_fd.fileDescriptor();
+    if (fd < 0 || m_mtu <= AttHeaderSize || ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK) < 0) {
+        qCWarning(BLUEZQT) << "GattWriteStream: Invalid write socket";
+        m_fd = QDBusUnixFileDescriptor();
+        m_mtu = 0;
+        return QStringLiteral("Invalid write socket");
+    }
+
+    m_enqueued = 0;
+    m_written = 0;
+
+    // Only enabled while the socket is full
+    m_notifier = new QSocketNotifier(fd, QSocketNotifier::Write, this);
+    m_notifier->setEnabled(false);
+    connect(m_notifier, &QSocketNotifier::activated, this, &GattWriteStreamPrivate::flush);
+
+    Q_EMIT q->openChanged(true);
+    return QString();
+}
+
+void GattWriteStreamPrivate::scheduleFlush()
+{
+    // Writes done in one event loop iteration are flushed together
+    if (m_flushScheduled || m_notifier->isEnabled()) {
+        return;
+    }
+
+    m_flushScheduled = true;
+    QTimer::singleShot(0, this, &GattWriteStreamPrivate::flush);
+}
+
+void GattWriteStreamPrivate::flush()
+{
+    m_flushScheduled = false;
+
+    if (!m_notifier) {
+        return;
+    }
+
+    const int fd = m_fd.fileDescriptor();
+    const int chunkSize = m_mtu - AttHeaderSize;
+    qint64 flushed = 0;
+    bool full = false;
+
+    while (m_offset < m_buffer.size()) {
+        const int size = qMin(chunkSize, m_buffer.size() - m_offset);
+
+        // Socket is SOCK_SEQPACKET, one send is one packet
+        const ssize_t ret = ::send(fd, m_buffer.constData() + m_offset, size, MSG_NOSIGNAL);
+
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            full = true;
+            break;
+        }
+        if (ret < 0) {
+            // Socket was closed by BlueZ, eg. when device disconnected
+            qCWarning(BLUEZQT) << "GattWriteStream: Write failed:" << strerror(errno);
+            closeSocket();
+            return;
+        }
+
+        m_offset += size;
+        m_written += size;
+        flushed += size;
+        m_totalPackets++;
+    }
+
+    m_notifier->setEnabled(full);
+
+    if (m_offset == m_buffer.size()) {
+        m_buffer.clear();
+        m_offset = 0;
+    } else if (m_offset > m_buffer.size() / 2) {
+        m_buffer.remove(0, m_offset);
+        m_offset = 0;
+    }
+
+    if (flushed) {
+        m_totalBytes += flushed;
+        m_lastWrite = m_clock.nsecsElapsed();
+        completeMarks();
+        Q_EMIT q->bytesWritten(flushed);
+    }
+}
+
+void GattWriteStreamPrivate::completeMarks()
+{
+    while (!m_marks.isEmpty() && m_marks.head().end <= m_written) {
+        const qint64 latency = (m_lastWrite - m_marks.dequeue().time) / 1000;
+        m_latencySum += latency;
+        m_latencyCount++;
+        m_latencyMax = qMax(m_latencyMax, latency);
+    }
+}
+
+void GattWriteStreamPrivate::closeSocket()
+{
+    if (!m_notifier) {
+        return;
+    }
+
+    m_notifier->setEnabled(false);
+    m_notifier->deleteLater();
+    m_notifier = nullptr;
+
+    m_buffer.clear();
+    m_offset = 0;
+    m_marks.clear();
+
+    // Closes the socket
+    m_fd = QDBusUnixFileDescriptor();
+    m_mtu = 0;
+
+    Q_EMIT q->openChanged(false);
+}
+
+GattWriteStream::GattWriteStream(GattCharacteristicPtr characteristic, QObject *parent)
+    : QObject(parent)
+    , d(new GattWriteStreamPrivate(this, characteristic))
+{
+}
+
+GattWriteStream::~GattWriteStream()
+{
+    // Closes the socket
+    delete d;
+}
+
+GattCharacteristicPtr GattWriteStream::characteristic() const
+{
+    return d->m_characteristic.toStrongRef();
+}
+
+bool GattWriteStream::isOpen() const
+{
+    return d->m_notifier;
+}
+
+quint16 GattWriteStream::mtu() const
+{
+    return d->m_mtu;
+}
+
+int GattWriteStream::chunkSize() const
+{
+    return d->m_mtu ? d->m_mtu - AttHeaderSize : 0;
+}
+
+int GattWriteStream::maximumBufferSize() const
+{
+    return d->m_maxBufferSize;
+}
+
+void GattWriteStream::setMaximumBufferSize(int size)
+{
+    d->m_maxBufferSize = qMax(0, size);
+}
+
+qint64 GattWriteStream::bytesToWrite() const
+{
+    return d->m_buffer.size() - d->m_offset;
+}
+
+PendingCall *GattWriteStream::open()
+{
+    if (!d->m_bluezCharacteristic || !d->m_characteristic) {
+        return new PendingCall(PendingCall::InternalError, QStringLiteral("Characteristic was removed"), this);
+    }
+
+    if (isOpen()) {
+        return new PendingCall(PendingCall::AlreadyExists, QStringLiteral("Stream is already open"), this);
+    }
+
+    // Stream is open before finished() is emitted, the call fails if the socket cannot be used
+    AcquireCallPrivate *dd = new AcquireCallPrivate(d, [this](const QDBusUnixFileDescriptor &fd, quint16 mtu) {
+        return d->acquireWriteFinished(fd, mtu);
+    });
+
+    PendingCall *call = new PendingCall(dd, this);
+    CallSchedulerPrivate::scheduleCall(call, d->m_bluezCharacteristic->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezCharacteristic->AcquireWrite(QVariantMap()));
+    });
+    return call;
+}
+
+void GattWriteStream::close()
+{
+    d->closeSocket();
+}
+
+qint64 GattWriteStream::write(const QByteArray &data)
+{
+    if (!isOpen()) {
+        return -1;
+    }
+
+    int size = data.size();
+    if (d->m_maxBufferSize > 0) {
+        size = qMin<qint64>(size, qMax<qint64>(0, d->m_maxBufferSize - bytesToWrite()));
+    }
+
+    if (size == 0) {
+        return 0;
+    }
+
+    const qint64 now = d->m_clock.nsecsElapsed();
+    if (d->m_firstWrite < 0) {
+        d->m_firstWrite = now;
+    }
+
+    d->m_buffer.append(data.constData(), size);
+    d->m_enqueued += size;
+    d->m_marks.enqueue({d->m_enqueued, now});
+    d->scheduleFlush();
+
+    return size;
+}
+
+qint64 GattWriteStream::totalBytesWritten() const
+{
+    return d->m_totalBytes;
+}
+
+qint64 GattWriteStream::packetsWritten() const
+{
+    return d->m_totalPackets;
+}
+
+qreal GattWriteStream::throughput() const
+{
+    if (d->m_firstWrite < 0 || d->m_lastWrite <= d->m_firstWrite) {
+        return 0;
+    }
+    return d->m_totalBytes * qreal(1000000000) / (d->m_lastWrite - d->m_firstWrite);
+}
+
+qint64 GattWriteStream::averageLatency() const
+{
+    return d->m_latencyCount ? d->m_latencySum / d->m_latencyCount : 0;
+}
+
+qint64 GattWriteStream::maximumLatency() const
+{
+    return d->m_latencyMax;
+}
+
+void GattWriteStream::resetStatistics()
+{
+    d->m_totalBytes = 0;
+    d->m_totalPackets = 0;
+    d->m_firstWrite = -1;
+    d->m_lastWrite = -1;
+    d->m_latencySum = 0;
+    d->m_latencyCount = 0;
+    d->m_latencyMax = 0;
+}
+
+} // namespace BluezQt
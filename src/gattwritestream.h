@@ -0,0 +1,245 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTWRITESTREAM_H
+#define BLUEZQT_GATTWRITESTREAM_H
+
+#include <QObject>
+
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class PendingCall;
+
+/**
+ * @class BluezQt::GattWriteStream gattwritestream.h <BluezQt/GattWriteStream>
+ *
+ * Write without response stream to GATT characteristic.
+ *
+ * Writing a characteristic with GattCharacteristic::writeValue() costs one D-Bus
+ * round-trip per write. For bulk transfers, eg. firmware updates, the stream
+ * acquires a socket with BlueZ AcquireWrite method and writes the data
+ * directly to the socket, BlueZ then sends each packet as Write Command.
+ *
+ * Data passed to write() are buffered and flushed from the event loop, so small
+ * writes are batched into packets of chunkSize() bytes. When the socket is full,
+ * flushing continues once it becomes writable again.
+ *
+ * The buffer is limited by maximumBufferSize(), write() only accepts as much data
+ * as fits into the buffer. The bytesWritten() signal is emitted when data was written
+ * to the socket and more data can be written.
+ *
+ * Example use:
+ * @code
+ * BluezQt::GattWriteStream *stream = new BluezQt::GattWriteStream(characteristic, this);
+ * connect(stream, &BluezQt::GattWriteStream::bytesWritten, this, &Updater::writeNextChunk);
+ * stream->open();
+ * @endcode
+ */
+class BLUEZQT_EXPORT GattWriteStream : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(bool open READ isOpen NOTIFY openChanged)
+    Q_PROPERTY(quint16 mtu READ mtu)
+    Q_PROPERTY(int chunkSize READ chunkSize)
+    Q_PROPERTY(int maximumBufferSize READ maximumBufferSize WRITE setMaximumBufferSize)
+    Q_PROPERTY(qint64 bytesToWrite READ bytesToWrite)
+    Q_PROPERTY(qint64 totalBytesWritten READ totalBytesWritten)
+    Q_PROPERTY(qint64 packetsWritten READ packetsWritten)
+    Q_PROPERTY(qreal throughput READ throughput)
+    Q_PROPERTY(qint64 averageLatency READ averageLatency)
+    Q_PROPERTY(qint64 maximumLatency READ maximumLatency)
+
+public:
+    /**
+     * Creates a new GattWriteStream object.
+     *
+     * @param characteristic characteristic to write
+     * @param parent
+     */
+    explicit GattWriteStream(GattCharacteristicPtr characteristic, QObject *parent = nullptr);
+
+    /**
+     * Destroys a GattWriteStream object.
+     *
+     * Data not yet written to the socket are discarded.
+     */
+    ~GattWriteStream();
+
+    /**
+     * Returns the characteristic of the stream.
+     *
+     * @return characteristic
+     */
+    GattCharacteristicPtr characteristic() const;
+
+    /**
+     * Returns whether the stream is open.
+     *
+     * @return true if stream is open
+     */
+    bool isOpen() const;
+
+    /**
+     * Returns the MTU reported by BlueZ.
+     *
+     * @return MTU, 0 if stream is not open
+     */
+    quint16 mtu() const;
+
+    /**
+     * Returns the maximum size of one packet.
+     *
+     * This is the MTU without the ATT header.
+     *
+     * @return packet size, 0 if stream is not open
+     */
+    int chunkSize() const;
+
+    /**
+     * Returns the maximum size of buffered data.
+     *
+     * Default is 64 KiB.
+     *
+     * @return buffer size in bytes, 0 if not limited
+     */
+    int maximumBufferSize() const;
+
+    /**
+     * Sets the maximum size of buffered data.
+     *
+     * @param size buffer size in bytes, 0 to not limit the buffer
+     */
+    void setMaximumBufferSize(int size);
+
+    /**
+     * Returns the number of bytes waiting to be written to the socket.
+     *
+     * @return number of bytes
+     */
+    qint64 bytesToWrite() const;
+
+    /**
+     * Acquires the write socket.
+     *
+     * When the call finishes successfully, the stream is open. The call fails
+     * with PendingCall::Failed also when the acquired socket cannot be used,
+     * eg. when its MTU is too small for any data.
+     *
+     * Possible errors: PendingCall::Failed, PendingCall::NotSupported,
+     *                  PendingCall::AlreadyExists
+     *
+     * @return void pending call
+     */
+    PendingCall *open();
+
+    /**
+     * Closes the stream.
+     *
+     * Data not yet written to the socket are discarded.
+     */
+    void close();
+
+    /**
+     * Writes data to the stream.
+     *
+     * The data are buffered and written to the socket from the event loop.
+     *
+     * @param data data to write
+     * @return number of accepted bytes, -1 if stream is not open
+     */
+    qint64 write(const QByteArray &data);
+
+    /**
+     * Returns the number of bytes written to the socket.
+     *
+     * @return number of bytes
+     */
+    qint64 totalBytesWritten() const;
+
+    /**
+     * Returns the number of packets written to the socket.
+     *
+     * @return number of packets
+     */
+    qint64 packetsWritten() const;
+
+    /**
+     * Returns the throughput of the stream.
+     *
+     * Measured from the first write() to the last packet written to the socket.
+     *
+     * @return bytes per second
+     */
+    qreal throughput() const;
+
+    /**
+     * Returns the average latency of written data.
+     *
+     * The latency is the time between write() and the moment when all its data
+     * were written to the socket.
+     *
+     * @return latency in microseconds
+     */
+    qint64 averageLatency() const;
+
+    /**
+     * Returns the maximum latency of written data.
+     *
+     * @return latency in microseconds
+     * @see averageLatency()
+     */
+    qint64 maximumLatency() const;
+
+    /**
+     * Resets all statistics.
+     */
+    void resetStatistics();
+
+Q_SIGNALS:
+    /**
+     * Indicates that the stream was opened or closed.
+     *
+     * The stream is also closed when BlueZ closes the socket, eg. when device disconnects.
+     */
+    void openChanged(bool open);
+
+    /**
+     * Indicates that data were written to the socket.
+     *
+     * @param bytes number of bytes written
+     */
+    void bytesWritten(qint64 bytes);
+
+private:
+    class GattWriteStreamPrivate *const d;
+
+    friend class GattWriteStreamPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTWRITESTREAM_H
@@ -0,0 +1,94 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_GATTWRITESTREAM_P_H
+#define BLUEZQT_GATTWRITESTREAM_P_H
+
+#include <QQueue>
+#include <QElapsedTimer>
+#include <QDBusUnixFileDescriptor>
+
+#include "types.h"
+#include "bluezgattcharacteristic1.h"
+
+class QSocketNotifier;
+
+namespace BluezQt
+{
+
+class GattWriteStream;
+
+typedef org::bluez::GattCharacteristic1 BluezGattCharacteristic;
+
+class GattWriteStreamPrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Stream position of the end of one write() and the time it was called
+    struct Mark
+    {
+        qint64 end;
+        qint64 time;
+    };
+
+    explicit GattWriteStreamPrivate(GattWriteStream *q, GattCharacteristicPtr characteristic);
+
+    QString acquireWriteFinished(const QDBusUnixFileDescriptor &writeFd, quint16 mtu);
+    void scheduleFlush();
+    void flush();
+    void completeMarks();
+    void closeSocket();
+
+    GattWriteStream *q;
+    QWeakPointer<GattCharacteristic> m_characteristic;
+    BluezGattCharacteristic *m_bluezCharacteristic;
+
+    QDBusUnixFileDescriptor m_fd;
+    QSocketNotifier *m_notifier;
+    quint16 m_mtu;
+    bool m_flushScheduled;
+
+    // Unwritten data start at m_offset
+    QByteArray m_buffer;
+    int m_offset;
+    int m_maxBufferSize;
+
+    // Positions in stream since it was opened
+    qint64 m_enqueued;
+    qint64 m_written;
+    QQueue<Mark> m_marks;
+
+    // Statistics
+    QElapsedTimer m_clock;
+    qint64 m_totalBytes;
+    qint64 m_totalPackets;
+    qint64 m_firstWrite;
+    qint64 m_lastWrite;
+    qint64 m_latencySum;
+    qint64 m_latencyCount;
+    qint64 m_latencyMax;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_GATTWRITESTREAM_P_H
@@ -22,13 +22,16 @@
 
 #include "declarativeadapter.h"
 #include "declarativedevice.h"
+#include "declarativemanager.h"
+
+#include <QMetaMethod>
 
 static int devicesCountFunction(QQmlListProperty<DeclarativeDevice> *property)
 {
     Q_ASSERT(qobject_cast<DeclarativeAdapter*>(property->object));
     DeclarativeAdapter *adapter = static_cast<DeclarativeAdapter*>(property->object);
 
-    return adapter->m_devices.count();
+    return adapter->m_deviceList.count();
 }
 
 static DeclarativeDevice *devicesAtFunction(QQmlListProperty<DeclarativeDevice> *property, int index)
@@ -36,12 +39,14 @@ static DeclarativeDevice *devicesAtFunction(QQmlListProperty<DeclarativeDevice>
     Q_ASSERT(qobject_cast<DeclarativeAdapter*>(property->object));
     DeclarativeAdapter *adapter = static_cast<DeclarativeAdapter*>(property->object);
 
-    return adapter->m_devices.values().at(index);
+    return adapter->m_manager->declarativeDeviceFromPtr(adapter->m_deviceList.at(index));
 }
 
-DeclarativeAdapter::DeclarativeAdapter(BluezQt::AdapterPtr adapter, QObject *parent)
-    : QObject(parent)
+DeclarativeAdapter::DeclarativeAdapter(BluezQt::AdapterPtr adapter, DeclarativeManager *manager)
+    : QObject(manager)
     , m_adapter(adapter)
+    , m_manager(manager)
+    , m_deviceList(adapter->devices().toVector())
 {
     connect(m_adapter.data(), &BluezQt::Adapter::nameChanged, this, &DeclarativeAdapter::nameChanged);
     connect(m_adapter.data(), &BluezQt::Adapter::systemNameChanged, this, &DeclarativeAdapter::systemNameChanged);
@@ -67,7 +72,9 @@ DeclarativeAdapter::DeclarativeAdapter(BluezQt::AdapterPtr adapter, QObject *par
     });
 
     connect(m_adapter.data(), &BluezQt::Adapter::deviceChanged, this, [this](const BluezQt::DevicePtr &device) {
-        Q_EMIT deviceChanged(declarativeDeviceFromPtr(device));
+        if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeAdapter::deviceChanged))) {
+            Q_EMIT deviceChanged(m_manager->declarativeDeviceFromPtr(device));
+        }
     });
 }
 
@@ -173,7 +180,7 @@ QQmlListProperty<DeclarativeDevice> DeclarativeAdapter::devices()
 
 DeclarativeDevice *DeclarativeAdapter::deviceForAddress(const QString &address) const
 {
-    return declarativeDeviceFromPtr(m_adapter->deviceForAddress(address));
+    return m_manager->declarativeDeviceFromPtr(m_adapter->deviceForAddress(address));
 }
 
 BluezQt::PendingCall *DeclarativeAdapter::startDiscovery()
@@ -193,20 +200,20 @@ BluezQt::PendingCall *DeclarativeAdapter::removeDevice(DeclarativeDevice *device
 
 void DeclarativeAdapter::slotDeviceAdded(BluezQt::DevicePtr device)
 {
-    Q_EMIT deviceFound(declarativeDeviceFromPtr(device));
+    m_deviceList.append(device);
+
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeAdapter::deviceFound))) {
+        Q_EMIT deviceFound(m_manager->declarativeDeviceFromPtr(device));
+    }
     Q_EMIT devicesChanged(devices());
 }
 
 void DeclarativeAdapter::slotDeviceRemoved(BluezQt::DevicePtr device)
 {
-    Q_EMIT deviceRemoved(declarativeDeviceFromPtr(device));
-    Q_EMIT devicesChanged(devices());
-}
+    m_deviceList.removeOne(device);
 
-DeclarativeDevice *DeclarativeAdapter::declarativeDeviceFromPtr(BluezQt::DevicePtr ptr) const
-{
-    if (!ptr) {
-        return nullptr;
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeAdapter::deviceRemoved))) {
+        Q_EMIT deviceRemoved(m_manager->declarativeDeviceFromPtr(device));
     }
-    return m_devices.value(ptr->ubi());
+    Q_EMIT devicesChanged(devices());
 }
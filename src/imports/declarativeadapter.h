@@ -23,11 +23,13 @@
 #ifndef DECLARATIVEADAPTER_H
 #define DECLARATIVEADAPTER_H
 
+#include <QVector>
 #include <QQmlListProperty>
 
 #include "adapter.h"
 
 class DeclarativeDevice;
+class DeclarativeManager;
 
 class DeclarativeAdapter : public QObject
 {
@@ -49,7 +51,7 @@ class DeclarativeAdapter : public QObject
     Q_PROPERTY(QQmlListProperty<DeclarativeDevice> devices READ devices NOTIFY devicesChanged)
 
 public:
-    explicit DeclarativeAdapter(BluezQt::AdapterPtr adapter, QObject *parent = nullptr);
+    explicit DeclarativeAdapter(BluezQt::AdapterPtr adapter, DeclarativeManager *manager);
 
     QString ubi() const;
 
@@ -86,7 +88,8 @@ public:
     QQmlListProperty<DeclarativeDevice> devices();
 
     BluezQt::AdapterPtr m_adapter;
-    QHash<QString, DeclarativeDevice*> m_devices;
+    DeclarativeManager *m_manager;
+    QVector<BluezQt::DevicePtr> m_deviceList;
 
 public Q_SLOTS:
     DeclarativeDevice *deviceForAddress(const QString &address) const;
@@ -117,9 +120,6 @@ Q_SIGNALS:
 private Q_SLOTS:
     void slotDeviceAdded(BluezQt::DevicePtr device);
     void slotDeviceRemoved(BluezQt::DevicePtr device);
-
-private:
-    DeclarativeDevice *declarativeDeviceFromPtr(BluezQt::DevicePtr ptr) const;
 };
 
 #endif // DECLARATIVEADAPTER_H
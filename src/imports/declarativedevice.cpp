@@ -22,15 +22,17 @@
 
 #include "declarativedevice.h"
 #include "declarativeadapter.h"
+#include "declarativemanager.h"
 #include "declarativeinput.h"
 #include "declarativemediaplayer.h"
 
 #include <QStringList>
+#include <QMetaMethod>
 
-DeclarativeDevice::DeclarativeDevice(BluezQt::DevicePtr device, DeclarativeAdapter *adapter)
-    : QObject(adapter)
+DeclarativeDevice::DeclarativeDevice(BluezQt::DevicePtr device, DeclarativeManager *manager)
+    : QObject()
     , m_device(device)
-    , m_adapter(adapter)
+    , m_manager(manager)
     , m_input(nullptr)
     , m_mediaPlayer(nullptr)
 {
@@ -59,9 +61,6 @@ DeclarativeDevice::DeclarativeDevice(BluezQt::DevicePtr device, DeclarativeAdapt
     connect(m_device.data(), &BluezQt::Device::deviceChanged, this, [this]() {
         Q_EMIT deviceChanged(this);
     });
-
-    updateInput();
-    updateMediaPlayer();
 }
 
 QString DeclarativeDevice::ubi() const
@@ -166,17 +165,23 @@ QString DeclarativeDevice::modalias() const
 
 DeclarativeInput *DeclarativeDevice::input() const
 {
+    if (!m_input && m_device->input()) {
+        m_input = new DeclarativeInput(m_device->input(), const_cast<DeclarativeDevice*>(this));
+    }
     return m_input;
 }
 
 DeclarativeMediaPlayer *DeclarativeDevice::mediaPlayer() const
 {
+    if (!m_mediaPlayer && m_device->mediaPlayer()) {
+        m_mediaPlayer = new DeclarativeMediaPlayer(m_device->mediaPlayer(), const_cast<DeclarativeDevice*>(this));
+    }
     return m_mediaPlayer;
 }
 
 DeclarativeAdapter *DeclarativeDevice::adapter() const
 {
-    return m_adapter;
+    return m_manager->declarativeAdapterFromPtr(m_device->adapter());
 }
 
 BluezQt::PendingCall *DeclarativeDevice::connectToDevice()
@@ -216,11 +221,9 @@ void DeclarativeDevice::updateInput()
         m_input = nullptr;
     }
 
-    if (m_device->input()) {
-        m_input = new DeclarativeInput(m_device->input(), this);
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeDevice::inputChanged))) {
+        Q_EMIT inputChanged(input());
     }
-
-    Q_EMIT inputChanged(m_input);
 }
 
 void DeclarativeDevice::updateMediaPlayer()
@@ -230,9 +233,7 @@ void DeclarativeDevice::updateMediaPlayer()
         m_mediaPlayer = nullptr;
     }
 
-    if (m_device->mediaPlayer()) {
-        m_mediaPlayer = new DeclarativeMediaPlayer(m_device->mediaPlayer(), this);
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeDevice::mediaPlayerChanged))) {
+        Q_EMIT mediaPlayerChanged(mediaPlayer());
     }
-
-    Q_EMIT mediaPlayerChanged(m_mediaPlayer);
 }
@@ -25,6 +25,7 @@
 
 #include "device.h"
 
+class DeclarativeManager;
 class DeclarativeAdapter;
 class DeclarativeInput;
 class DeclarativeMediaPlayer;
@@ -55,7 +56,7 @@ class DeclarativeDevice : public QObject
     Q_PROPERTY(DeclarativeAdapter* adapter READ adapter CONSTANT)
 
 public:
-    explicit DeclarativeDevice(BluezQt::DevicePtr device, DeclarativeAdapter *adapter);
+    explicit DeclarativeDevice(BluezQt::DevicePtr device, DeclarativeManager *manager);
 
     QString ubi() const;
 
@@ -134,9 +135,9 @@ private:
     void updateMediaPlayer();
 
     BluezQt::DevicePtr m_device;
-    DeclarativeAdapter *m_adapter;
-    DeclarativeInput *m_input;
-    DeclarativeMediaPlayer *m_mediaPlayer;
+    DeclarativeManager *m_manager;
+    mutable DeclarativeInput *m_input;
+    mutable DeclarativeMediaPlayer *m_mediaPlayer;
 };
 
 #endif // DECLARATIVEDEVICE_H
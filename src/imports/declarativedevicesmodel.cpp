@@ -58,7 +58,7 @@ QHash<int, QByteArray> DeclarativeDevicesModel::roleNames() const
 
 QVariant DeclarativeDevicesModel::data(const QModelIndex &index, int role) const
 {
-    if (!m_model) {
+    if (!m_model || role < DeviceRole || role > MediaPlayerRole) {
         return QSortFilterProxyModel::data(index, role);
     }
 
@@ -27,6 +27,7 @@
 #include "adapter.h"
 #include "device.h"
 
+#include <QMetaMethod>
 #include <QQmlEngine>
 
 static int adaptersCountFunction(QQmlListProperty<DeclarativeAdapter> *property)
@@ -34,7 +35,7 @@ static int adaptersCountFunction(QQmlListProperty<DeclarativeAdapter> *property)
     Q_ASSERT(qobject_cast<DeclarativeManager*>(property->object));
     DeclarativeManager *manager = static_cast<DeclarativeManager*>(property->object);
 
-    return manager->m_adapters.count();
+    return manager->m_adapterList.count();
 }
 
 static DeclarativeAdapter *adaptersAtFunction(QQmlListProperty<DeclarativeAdapter> *property, int index)
@@ -42,7 +43,7 @@ static DeclarativeAdapter *adaptersAtFunction(QQmlListProperty<DeclarativeAdapte
     Q_ASSERT(qobject_cast<DeclarativeManager*>(property->object));
     DeclarativeManager *manager = static_cast<DeclarativeManager*>(property->object);
 
-    return manager->m_adapters.values().at(index);
+    return manager->declarativeAdapterFromPtr(manager->m_adapterList.at(index));
 }
 
 static int devicesCountFunction(QQmlListProperty<DeclarativeDevice> *property)
@@ -50,7 +51,7 @@ static int devicesCountFunction(QQmlListProperty<DeclarativeDevice> *property)
     Q_ASSERT(qobject_cast<DeclarativeManager*>(property->object));
     DeclarativeManager *manager = static_cast<DeclarativeManager*>(property->object);
 
-    return manager->m_devices.count();
+    return manager->m_deviceList.count();
 }
 
 static DeclarativeDevice *devicesAtFunction(QQmlListProperty<DeclarativeDevice> *property, int index)
@@ -58,7 +59,7 @@ static DeclarativeDevice *devicesAtFunction(QQmlListProperty<DeclarativeDevice>
     Q_ASSERT(qobject_cast<DeclarativeManager*>(property->object));
     DeclarativeManager *manager = static_cast<DeclarativeManager*>(property->object);
 
-    return manager->m_devices.values().at(index);
+    return manager->declarativeDeviceFromPtr(manager->m_deviceList.at(index));
 }
 
 DeclarativeManager::DeclarativeManager(QObject *parent)
@@ -75,14 +76,26 @@ DeclarativeManager::DeclarativeManager(QObject *parent)
     connect(this, &BluezQt::Manager::deviceRemoved, this, &DeclarativeManager::slotDeviceRemoved);
 
     connect(this, &BluezQt::Manager::adapterChanged, this, [this](const BluezQt::AdapterPtr &adapter) {
-        Q_EMIT adapterChanged(declarativeAdapterFromPtr(adapter));
+        if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeManager::adapterChanged))) {
+            Q_EMIT adapterChanged(declarativeAdapterFromPtr(adapter));
+        }
     });
 
     connect(this, &BluezQt::Manager::deviceChanged, this, [this](const BluezQt::DevicePtr &device) {
-        Q_EMIT deviceChanged(declarativeDeviceFromPtr(device));
+        if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeManager::deviceChanged))) {
+            Q_EMIT deviceChanged(declarativeDeviceFromPtr(device));
+        }
     });
 }
 
+DeclarativeManager::~DeclarativeManager()
+{
+    // Device wrappers have no parent, delete those not yet collected by QML engine
+    Q_FOREACH (const QPointer<DeclarativeDevice> &device, m_devices) {
+        delete device.data();
+    }
+}
+
 DeclarativeAdapter *DeclarativeManager::usableAdapter() const
 {
     return declarativeAdapterFromPtr(BluezQt::Manager::usableAdapter());
@@ -103,7 +116,12 @@ DeclarativeAdapter *DeclarativeManager::declarativeAdapterFromPtr(BluezQt::Adapt
     if (!ptr) {
         return nullptr;
     }
-    return m_adapters.value(ptr->ubi());
+
+    DeclarativeAdapter *&dAdapter = m_adapters[ptr->ubi()];
+    if (!dAdapter) {
+        dAdapter = new DeclarativeAdapter(ptr, const_cast<DeclarativeManager*>(this));
+    }
+    return dAdapter;
 }
 
 DeclarativeDevice *DeclarativeManager::declarativeDeviceFromPtr(BluezQt::DevicePtr ptr) const
@@ -111,7 +129,22 @@ DeclarativeDevice *DeclarativeManager::declarativeDeviceFromPtr(BluezQt::DeviceP
     if (!ptr) {
         return nullptr;
     }
-    return m_devices.value(ptr->ubi());
+
+    DeclarativeDevice *dDevice = m_devices.value(ptr->ubi());
+    if (dDevice) {
+        return dDevice;
+    }
+
+    dDevice = new DeclarativeDevice(ptr, const_cast<DeclarativeManager*>(this));
+    QQmlEngine::setObjectOwnership(dDevice, QQmlEngine::JavaScriptOwnership);
+
+    // Don't cache wrappers for already removed devices (requested from deviceRemoved handlers)
+    if (BluezQt::Manager::deviceForUbi(ptr->ubi()) == ptr) {
+        m_devices.insert(ptr->ubi(), dDevice);
+    } else {
+        dDevice->deleteLater();
+    }
+    return dDevice;
 }
 
 DeclarativeAdapter *DeclarativeManager::adapterForAddress(const QString &address) const
@@ -146,44 +179,55 @@ void DeclarativeManager::initJobResult(BluezQt::InitManagerJob *job)
 
 void DeclarativeManager::slotAdapterAdded(BluezQt::AdapterPtr adapter)
 {
-    DeclarativeAdapter *dAdapter = new DeclarativeAdapter(adapter, this);
-    m_adapters[adapter->ubi()] = dAdapter;
+    m_adapterList.append(adapter);
 
-    Q_EMIT adapterAdded(dAdapter);
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeManager::adapterAdded))) {
+        Q_EMIT adapterAdded(declarativeAdapterFromPtr(adapter));
+    }
     Q_EMIT adaptersChanged(declarativeAdapters());
 }
 
 void DeclarativeManager::slotAdapterRemoved(BluezQt::AdapterPtr adapter)
 {
-    DeclarativeAdapter *dAdapter = m_adapters.take(adapter->ubi());
-    dAdapter->deleteLater();
+    m_adapterList.removeOne(adapter);
 
-    Q_EMIT adapterRemoved(dAdapter);
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeManager::adapterRemoved))) {
+        Q_EMIT adapterRemoved(declarativeAdapterFromPtr(adapter));
+    }
     Q_EMIT adaptersChanged(declarativeAdapters());
+
+    if (DeclarativeAdapter *dAdapter = m_adapters.take(adapter->ubi())) {
+        dAdapter->deleteLater();
+    }
 }
 
 void DeclarativeManager::slotDeviceAdded(BluezQt::DevicePtr device)
 {
-    DeclarativeAdapter *dAdapter = declarativeAdapterFromPtr(device->adapter());
-    DeclarativeDevice *dDevice = new DeclarativeDevice(device, dAdapter);
-    m_devices[device->ubi()] = dDevice;
-    dAdapter->m_devices[device->ubi()] = dDevice;
+    m_deviceList.append(device);
 
-    Q_EMIT deviceAdded(dDevice);
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeManager::deviceAdded))) {
+        Q_EMIT deviceAdded(declarativeDeviceFromPtr(device));
+    }
     Q_EMIT devicesChanged(declarativeDevices());
 }
 
 void DeclarativeManager::slotDeviceRemoved(BluezQt::DevicePtr device)
 {
-    DeclarativeDevice *dDevice = m_devices.take(device->ubi());
-    dDevice->adapter()->m_devices.take(device->ubi());
-    dDevice->deleteLater();
+    m_deviceList.removeOne(device);
 
-    Q_EMIT deviceRemoved(dDevice);
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeManager::deviceRemoved))) {
+        Q_EMIT deviceRemoved(declarativeDeviceFromPtr(device));
+    }
     Q_EMIT devicesChanged(declarativeDevices());
+
+    if (DeclarativeDevice *dDevice = m_devices.take(device->ubi())) {
+        dDevice->deleteLater();
+    }
 }
 
 void DeclarativeManager::slotUsableAdapterChanged(BluezQt::AdapterPtr adapter)
 {
-    Q_EMIT usableAdapterChanged(declarativeAdapterFromPtr(adapter));
+    if (isSignalConnected(QMetaMethod::fromSignal(&DeclarativeManager::usableAdapterChanged))) {
+        Q_EMIT usableAdapterChanged(declarativeAdapterFromPtr(adapter));
+    }
 }
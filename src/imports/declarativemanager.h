@@ -24,6 +24,8 @@
 #define DECLARATIVEMANAGER_H
 
 #include <QHash>
+#include <QVector>
+#include <QPointer>
 #include <QQmlListProperty>
 
 #include "manager.h"
@@ -40,6 +42,7 @@ class DeclarativeManager : public BluezQt::Manager
 
 public:
     explicit DeclarativeManager(QObject *parent = nullptr);
+    ~DeclarativeManager();
 
     DeclarativeAdapter *usableAdapter() const;
     QQmlListProperty<DeclarativeAdapter> declarativeAdapters();
@@ -48,8 +51,14 @@ public:
     DeclarativeAdapter *declarativeAdapterFromPtr(BluezQt::AdapterPtr ptr) const;
     DeclarativeDevice *declarativeDeviceFromPtr(BluezQt::DevicePtr ptr) const;
 
-    QHash<QString, DeclarativeAdapter*> m_adapters;
-    QHash<QString, DeclarativeDevice*> m_devices;
+    // Wrappers are created on first access, device wrappers are owned by QML
+    // engine and may be garbage collected when no longer referenced
+    mutable QHash<QString, DeclarativeAdapter*> m_adapters;
+    mutable QHash<QString, QPointer<DeclarativeDevice> > m_devices;
+
+    // Ordered lists for indexed access in insertion order
+    QVector<BluezQt::AdapterPtr> m_adapterList;
+    QVector<BluezQt::DevicePtr> m_deviceList;
 
 public Q_SLOTS:
     DeclarativeAdapter *adapterForAddress(const QString &address) const;
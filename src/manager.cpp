@@ -23,12 +23,16 @@
 #include "manager.h"
 #include "manager_p.h"
 #include "adapter.h"
+#include "device.h"
 #include "agent.h"
 #include "agentadaptor.h"
 #include "profile.h"
 #include "profile_p.h"
 #include "profileadaptor.h"
 #include "pendingcall.h"
+#include "pendingreply.h"
+#include "callscheduler_p.h"
+#include "batchjob.h"
 #include "initmanagerjob.h"
 #include "utils.h"
 #include "debug.h"
@@ -97,7 +101,7 @@ QList<DevicePtr> Manager::devices() const
     return d->m_devices.values();
 }
 
-PendingCall *Manager::startService()
+PendingReply<quint32> *Manager::startService()
 {
     QDBusMessage msg = QDBusMessage::createMethodCall(Strings::orgFreedesktopDBus(),
                                                       QStringLiteral("/org/freedesktop/DBus"),
@@ -106,7 +110,17 @@ PendingCall *Manager::startService()
     msg << Strings::orgBluez();
     msg << quint32(0);
 
-    return new PendingCall(DBusConnection::orgBluez().asyncCall(msg), PendingCall::ReturnUint32);
+    return new PendingReply<quint32>(DBusConnection::orgBluez().asyncCall(msg));
+}
+
+CallScheduler *Manager::callScheduler()
+{
+    return CallSchedulerPrivate::instance();
+}
+
+void Manager::setCallScheduler(CallScheduler *scheduler)
+{
+    CallSchedulerPrivate::setInstance(scheduler);
 }
 
 AdapterPtr Manager::adapterForAddress(const QString &address) const
@@ -246,4 +260,18 @@ PendingCall *Manager::unregisterProfile(Profile *profile)
                            PendingCall::ReturnVoid, this);
 }
 
+BatchJob *Manager::setTrusted(const QList<DevicePtr> &devices, bool trusted)
+{
+    return new BatchJob(devices, [trusted](const DevicePtr &device) {
+        return device->setTrusted(trusted);
+    }, this);
+}
+
+BatchJob *Manager::setBlocked(const QList<DevicePtr> &devices, bool blocked)
+{
+    return new BatchJob(devices, [blocked](const DevicePtr &device) {
+        return device->setBlocked(blocked);
+    }, this);
+}
+
 } // namespace BluezQt
@@ -26,6 +26,7 @@
 #include <QObject>
 
 #include "types.h"
+#include "pendingreply.h"
 #include "bluezqt_export.h"
 
 namespace BluezQt
@@ -36,6 +37,7 @@ class Adapter;
 class Agent;
 class Profile;
 class PendingCall;
+class CallScheduler;
 class InitManagerJob;
 
 /**
@@ -204,7 +206,28 @@ public:
      *
      * @return quint32 pending call
      */
-    static PendingCall *startService();
+    static PendingReply<quint32> *startService();
+
+    /**
+     * Returns the installed call scheduler.
+     *
+     * @return null if no scheduler is installed
+     */
+    static CallScheduler *callScheduler();
+
+    /**
+     * Installs a call scheduler.
+     *
+     * All following calls of Adapter, Device and MediaPlayer objects are
+     * routed through the scheduler. The scheduler is shared by all Manager
+     * instances and it is not owned by Manager.
+     *
+     * Pass nullptr to send all calls immediately again.
+     *
+     * @param scheduler call scheduler
+     * @see CallScheduler
+     */
+    static void setCallScheduler(CallScheduler *scheduler);
 
     /**
      * Returns an adapter for specified address.
@@ -297,6 +320,30 @@ public:
      */
     PendingCall *unregisterProfile(Profile *profile);
 
+    /**
+     * Sets whether the specified devices are trusted.
+     *
+     * Devices are changed with pipelined Device::setTrusted() calls.
+     * The returned job needs to be started with Job::start().
+     *
+     * @param devices devices to be changed
+     * @param trusted whether devices are trusted
+     * @return batch job
+     */
+    BatchJob *setTrusted(const QList<DevicePtr> &devices, bool trusted);
+
+    /**
+     * Sets whether the specified devices are blocked.
+     *
+     * Devices are changed with pipelined Device::setBlocked() calls.
+     * The returned job needs to be started with Job::start().
+     *
+     * @param devices devices to be changed
+     * @param blocked whether devices are blocked
+     * @return batch job
+     */
+    BatchJob *setBlocked(const QList<DevicePtr> &devices, bool blocked);
+
 Q_SIGNALS:
     /**
      * Indicates that operational state have changed.
@@ -433,7 +433,8 @@ void ManagerPrivate::setUsableAdapter(const AdapterPtr &adapter)
 void ManagerPrivate::propertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated)
 {
     // Cut anything after device path to forward it to Device to handle
-    const QString path = message().path().section(QLatin1Char('/'), 0, 4);
+    const QString objectPath = message().path();
+    const QString path = objectPath.section(QLatin1Char('/'), 0, 4);
 
     QTimer::singleShot(0, this, [=]() {
         AdapterPtr adapter = m_adapters.value(path);
@@ -443,6 +444,11 @@ void ManagerPrivate::propertiesChanged(const QString &interface, const QVariantM
         }
         DevicePtr device = m_devices.value(path);
         if (device) {
+            // There are multiple GATT objects per device, they are found by full path
+            if (interface.startsWith(QLatin1String("org.bluez.Gatt"))) {
+                device->d->gattPropertiesChanged(objectPath, interface, changed, invalidated);
+                return;
+            }
             device->d->propertiesChanged(interface, changed, invalidated);
             return;
         }
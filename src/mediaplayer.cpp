@@ -23,6 +23,7 @@
 #include "mediaplayer.h"
 #include "mediaplayer_p.h"
 #include "pendingcall.h"
+#include "callscheduler_p.h"
 
 namespace BluezQt
 {
@@ -91,8 +92,9 @@ MediaPlayer::Equalizer MediaPlayer::equalizer() const
 
 PendingCall *MediaPlayer::setEqualizer(MediaPlayer::Equalizer equalizer)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Equalizer"), equalizerToString(equalizer)),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Equalizer"), equalizerToString(equalizer)));
+    }, this);
 }
 
 MediaPlayer::Repeat MediaPlayer::repeat() const
@@ -102,8 +104,9 @@ MediaPlayer::Repeat MediaPlayer::repeat() const
 
 PendingCall *MediaPlayer::setRepeat(MediaPlayer::Repeat repeat)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Repeat"), repeatToString(repeat)),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Repeat"), repeatToString(repeat)));
+    }, this);
 }
 
 MediaPlayer::Shuffle MediaPlayer::shuffle() const
@@ -113,8 +116,9 @@ MediaPlayer::Shuffle MediaPlayer::shuffle() const
 
 PendingCall *MediaPlayer::setShuffle(MediaPlayer::Shuffle shuffle)
 {
-    return new PendingCall(d->setDBusProperty(QStringLiteral("Shuffle"), shuffleToString(shuffle)),
-                           PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->setDBusProperty(QStringLiteral("Shuffle"), shuffleToString(shuffle)));
+    }, this);
 }
 
 MediaPlayer::Status MediaPlayer::status() const
@@ -134,37 +138,51 @@ quint32 MediaPlayer::position() const
 
 PendingCall *MediaPlayer::play()
 {
-    return new PendingCall(d->m_bluezMediaPlayer->Play(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezMediaPlayer->Play());
+    }, this);
 }
 
 PendingCall *MediaPlayer::pause()
 {
-    return new PendingCall(d->m_bluezMediaPlayer->Pause(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezMediaPlayer->Pause());
+    }, this);
 }
 
 PendingCall *MediaPlayer::stop()
 {
-    return new PendingCall(d->m_bluezMediaPlayer->Stop(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezMediaPlayer->Stop());
+    }, this);
 }
 
 PendingCall *MediaPlayer::next()
 {
-    return new PendingCall(d->m_bluezMediaPlayer->Next(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezMediaPlayer->Next());
+    }, this);
 }
 
 PendingCall *MediaPlayer::previous()
 {
-    return new PendingCall(d->m_bluezMediaPlayer->Previous(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezMediaPlayer->Previous());
+    }, this);
 }
 
 PendingCall *MediaPlayer::fastForward()
 {
-    return new PendingCall(d->m_bluezMediaPlayer->FastForward(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezMediaPlayer->FastForward());
+    }, this);
 }
 
 PendingCall *MediaPlayer::rewind()
 {
-    return new PendingCall(d->m_bluezMediaPlayer->Rewind(), PendingCall::ReturnVoid, this);
+    return CallSchedulerPrivate::createCall(d->m_bluezMediaPlayer->path(), CallScheduler::Interactive, [=]() {
+        return QDBusPendingCall(d->m_bluezMediaPlayer->Rewind());
+    }, this);
 }
 
 } // namespace BluezQt
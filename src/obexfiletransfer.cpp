@@ -22,6 +22,7 @@
 
 #include "obexfiletransfer.h"
 #include "pendingcall.h"
+#include "pendingreply.h"
 #include "utils.h"
 
 #include "obexfiletransfer1.h"
@@ -68,22 +69,19 @@ PendingCall *ObexFileTransfer::createFolder(const QString &folder)
                            PendingCall::ReturnVoid, this);
 }
 
-PendingCall *ObexFileTransfer::listFolder()
+PendingReply<QList<ObexFileTransferEntry> > *ObexFileTransfer::listFolder()
 {
-    return new PendingCall(d->m_bluezFileTransfer->ListFolder(),
-                           PendingCall::ReturnFileTransferList, this);
+    return new PendingReply<QList<ObexFileTransferEntry> >(d->m_bluezFileTransfer->ListFolder(), this);
 }
 
-PendingCall *ObexFileTransfer::getFile(const QString &targetFileName, const QString &sourceFileName)
+PendingReply<ObexTransferPtr> *ObexFileTransfer::getFile(const QString &targetFileName, const QString &sourceFileName)
 {
-    return new PendingCall(d->m_bluezFileTransfer->GetFile(targetFileName, sourceFileName),
-                           PendingCall::ReturnTransferWithProperties, this);
+    return new PendingReply<ObexTransferPtr>(d->m_bluezFileTransfer->GetFile(targetFileName, sourceFileName), this);
 }
 
-PendingCall *ObexFileTransfer::putFile(const QString &sourceFileName, const QString &targetFileName)
+PendingReply<ObexTransferPtr> *ObexFileTransfer::putFile(const QString &sourceFileName, const QString &targetFileName)
 {
-    return new PendingCall(d->m_bluezFileTransfer->PutFile(sourceFileName, targetFileName),
-                           PendingCall::ReturnTransferWithProperties, this);
+    return new PendingReply<ObexTransferPtr>(d->m_bluezFileTransfer->PutFile(sourceFileName, targetFileName), this);
 }
 
 PendingCall *ObexFileTransfer::copyFile(const QString &sourceFileName, const QString &targetFileName)
@@ -26,6 +26,7 @@
 #include <QObject>
 
 #include "obexfiletransferentry.h"
+#include "pendingreply.h"
 #include "bluezqt_export.h"
 
 class QDBusObjectPath;
@@ -97,7 +98,7 @@ public:
      *
      * @return QList<ObexFileTransferEntry> pending call
      */
-    PendingCall *listFolder();
+    PendingReply<QList<ObexFileTransferEntry> > *listFolder();
 
     /**
      * Gets the file from the remote device.
@@ -111,7 +112,7 @@ public:
      * @param sourceFileName file within the remote device
      * @return ObexTransferPtr pending call
      */
-    PendingCall *getFile(const QString &targetFileName, const QString &sourceFileName);
+    PendingReply<ObexTransferPtr> *getFile(const QString &targetFileName, const QString &sourceFileName);
 
     /**
      * Puts the file to the remote device.
@@ -125,7 +126,7 @@ public:
      * @param targetFileName file to be saved within the remote device
      * @return ObexTransferPtr pending call
      */
-    PendingCall *putFile(const QString &sourceFileName, const QString &targetFileName);
+    PendingReply<ObexTransferPtr> *putFile(const QString &sourceFileName, const QString &targetFileName);
 
     /**
      * Copies a file within the remote device.
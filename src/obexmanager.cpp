@@ -25,6 +25,7 @@
 #include "initobexmanagerjob.h"
 #include "debug.h"
 #include "pendingcall.h"
+#include "pendingreply.h"
 #include "obexagent.h"
 #include "obexagentadaptor.h"
 #include "obexsession.h"
@@ -78,7 +79,7 @@ ObexSessionPtr ObexManager::sessionForPath(const QDBusObjectPath &path) const
     return ObexSessionPtr();
 }
 
-PendingCall *ObexManager::startService()
+PendingReply<quint32> *ObexManager::startService()
 {
     QDBusMessage msg = QDBusMessage::createMethodCall(Strings::orgFreedesktopDBus(),
                                                       QStringLiteral("/org/freedesktop/DBus"),
@@ -87,7 +88,7 @@ PendingCall *ObexManager::startService()
     msg << Strings::orgBluezObex();
     msg << quint32(0);
 
-    return new PendingCall(DBusConnection::orgBluezObex().asyncCall(msg), PendingCall::ReturnUint32);
+    return new PendingReply<quint32>(DBusConnection::orgBluezObex().asyncCall(msg));
 }
 
 PendingCall *ObexManager::registerAgent(ObexAgent *agent)
@@ -122,14 +123,13 @@ PendingCall *ObexManager::unregisterAgent(ObexAgent *agent)
                            PendingCall::ReturnVoid, this);
 }
 
-PendingCall *ObexManager::createSession(const QString &destination, const QVariantMap &args)
+PendingReply<QDBusObjectPath> *ObexManager::createSession(const QString &destination, const QVariantMap &args)
 {
     if (!d->m_obexClient) {
-        return new PendingCall(PendingCall::InternalError, QStringLiteral("ObexManager not operational!"));
+        return new PendingReply<QDBusObjectPath>(PendingCall::InternalError, QStringLiteral("ObexManager not operational!"));
     }
 
-    return new PendingCall(d->m_obexClient->CreateSession(destination, args),
-                           PendingCall::ReturnObjectPath, this);
+    return new PendingReply<QDBusObjectPath>(d->m_obexClient->CreateSession(destination, args), this);
 }
 
 PendingCall *ObexManager::removeSession(const QDBusObjectPath &session)
@@ -26,6 +26,7 @@
 #include <QObject>
 
 #include "types.h"
+#include "pendingreply.h"
 #include "bluezqt_export.h"
 
 class QDBusObjectPath;
@@ -122,7 +123,7 @@ public:
      *
      * @return quint32 pending call
      */
-    static PendingCall *startService();
+    static PendingReply<quint32> *startService();
 
 public Q_SLOTS:
     /**
@@ -174,7 +175,7 @@ public Q_SLOTS:
      * @param args session parameters
      * @return QDBusObjectPath pending call
      */
-    PendingCall *createSession(const QString &destination, const QVariantMap &args);
+    PendingReply<QDBusObjectPath> *createSession(const QString &destination, const QVariantMap &args);
 
     /**
      * Removes an existing OBEX session.
@@ -22,6 +22,7 @@
 
 #include "obexobjectpush.h"
 #include "pendingcall.h"
+#include "pendingreply.h"
 #include "utils.h"
 
 #include "obexobjectpush1.h"
@@ -56,22 +57,19 @@ QDBusObjectPath ObexObjectPush::objectPath() const
     return QDBusObjectPath(d->m_bluezObjectPush->path());
 }
 
-PendingCall *ObexObjectPush::sendFile(const QString &fileName)
+PendingReply<ObexTransferPtr> *ObexObjectPush::sendFile(const QString &fileName)
 {
-    return new PendingCall(d->m_bluezObjectPush->SendFile(fileName),
-                           PendingCall::ReturnTransferWithProperties, this);
+    return new PendingReply<ObexTransferPtr>(d->m_bluezObjectPush->SendFile(fileName), this);
 }
 
-PendingCall *ObexObjectPush::pullBusinessCard(const QString &targetFileName)
+PendingReply<ObexTransferPtr> *ObexObjectPush::pullBusinessCard(const QString &targetFileName)
 {
-    return new PendingCall(d->m_bluezObjectPush->PullBusinessCard(targetFileName),
-                           PendingCall::ReturnTransferWithProperties, this);
+    return new PendingReply<ObexTransferPtr>(d->m_bluezObjectPush->PullBusinessCard(targetFileName), this);
 }
 
-PendingCall *ObexObjectPush::exchangeBusinessCards(const QString &clientFileName, const QString &targetFileName)
+PendingReply<ObexTransferPtr> *ObexObjectPush::exchangeBusinessCards(const QString &clientFileName, const QString &targetFileName)
 {
-    return new PendingCall(d->m_bluezObjectPush->ExchangeBusinessCards(clientFileName, targetFileName),
-                           PendingCall::ReturnTransferWithProperties, this);
+    return new PendingReply<ObexTransferPtr>(d->m_bluezObjectPush->ExchangeBusinessCards(clientFileName, targetFileName), this);
 }
 
 } // namespace BluezQt
@@ -25,6 +25,7 @@
 
 #include <QObject>
 
+#include "pendingreply.h"
 #include "bluezqt_export.h"
 
 class QDBusObjectPath;
@@ -77,9 +78,9 @@ public:
      * Possible errors: PendingCall::InvalidArguments, PendingCall::Failed
      *
      * @param fileName full path of file to send
-     * @return ObexTransfer * pending call
+     * @return ObexTransferPtr pending call
      */
-    PendingCall *sendFile(const QString &fileName);
+    PendingReply<ObexTransferPtr> *sendFile(const QString &fileName);
 
     /**
      * Pulls the business card from a remote device.
@@ -92,9 +93,9 @@ public:
      * Possible errors: PendingCall::InvalidArguments, PendingCall::Failed
      *
      * @param targetFileName full path where the bussiness card will be saved
-     * @return ObexTransfer * pending call
+     * @return ObexTransferPtr pending call
      */
-    PendingCall *pullBusinessCard(const QString &targetFileName);
+    PendingReply<ObexTransferPtr> *pullBusinessCard(const QString &targetFileName);
 
     /**
      * Exchanges the business cards on the remote device.
@@ -112,9 +113,9 @@ public:
      *
      * @param clientFileName full path to local business card
      * @param targetFileName full path where the bussiness card will be saved
-     * @return ObexTransfer * pending call
+     * @return ObexTransferPtr pending call
      */
-    PendingCall *exchangeBusinessCards(const QString &clientFileName, const QString &targetFileName);
+    PendingReply<ObexTransferPtr> *exchangeBusinessCards(const QString &clientFileName, const QString &targetFileName);
 
 private:
     class ObexObjectPushPrivate *const d;
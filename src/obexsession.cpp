@@ -23,6 +23,7 @@
 #include "obexsession.h"
 #include "obexsession_p.h"
 #include "pendingcall.h"
+#include "pendingreply.h"
 #include "utils.h"
 
 namespace BluezQt
@@ -92,9 +93,9 @@ QString ObexSession::root() const
     return d->m_root;
 }
 
-PendingCall *ObexSession::getCapabilities()
+PendingReply<QString> *ObexSession::getCapabilities()
 {
-    return new PendingCall(d->m_bluezSession->GetCapabilities(), PendingCall::ReturnString, this);
+    return new PendingReply<QString>(d->m_bluezSession->GetCapabilities(), this);
 }
 
 } // namespace BluezQt
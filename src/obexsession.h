@@ -26,6 +26,7 @@
 #include <QObject>
 
 #include "types.h"
+#include "pendingreply.h"
 #include "bluezqt_export.h"
 
 class QDBusObjectPath;
@@ -118,7 +119,7 @@ public:
      *
      * @return QString pending call
      */
-    PendingCall *getCapabilities();
+    PendingReply<QString> *getCapabilities();
 
 private:
     explicit ObexSession(const QString &path, const QVariantMap &properties);
@@ -0,0 +1,189 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pairingjob.h"
+#include "pairingjob_p.h"
+#include "pairingqueue.h"
+#include "pairingqueue_p.h"
+#include "pendingcall.h"
+#include "debug.h"
+
+namespace BluezQt
+{
+
+PairingJobPrivate::PairingJobPrivate(PairingJob *q, const QList<DevicePtr> &devices, PairingQueue *queue)
+    : q(q)
+    , m_devices(devices)
+    , m_queue(queue)
+    , m_stages(devices.count(), PairingJob::Queued)
+    , m_errors(devices.count(), PendingCall::NoError)
+    , m_attempts(devices.count(), 0)
+    , m_connect(false)
+    , m_finished(0)
+    , m_failed(0)
+    , m_steps(0)
+{
+}
+
+int PairingJobPrivate::stepCount() const
+{
+    return m_connect ? 3 : 2;
+}
+
+void PairingJobPrivate::stepFinished()
+{
+    m_steps++;
+    Q_EMIT q->progress(q, q->percent());
+}
+
+void PairingJobPrivate::itemFinished(int index, PairingJob::Stage stage, int error, const QString &errorText)
+{
+    if (!q->isRunning()) {
+        return;
+    }
+
+    m_stages[index] = stage;
+    m_errors[index] = error;
+    if (error != PendingCall::NoError) {
+        m_errorTexts.insert(index, errorText);
+        m_failed++;
+
+        // Remaining steps of failed device count as finished
+        m_steps += stepCount() - (stage - PairingJob::Pairing);
+        Q_EMIT q->progress(q, q->percent());
+    }
+    m_finished++;
+
+    Q_EMIT q->deviceFinished(q, index);
+
+    if (m_finished == m_devices.count()) {
+        if (m_failed > 0) {
+            qCWarning(BLUEZQT) << "PairingJob Error:" << m_failed << "of" << m_devices.count() << "devices failed";
+            q->setError(PairingJob::UserDefinedError);
+            q->setErrorText(QStringLiteral("%1 of %2 devices failed").arg(m_failed).arg(m_devices.count()));
+        }
+        q->emitResult();
+    }
+}
+
+PairingJob::PairingJob(const QList<DevicePtr> &devices, PairingQueue *queue)
+    : Job(queue)
+    , d(new PairingJobPrivate(this, devices, queue))
+{
+}
+
+PairingJob::~PairingJob()
+{
+    if (isRunning()) {
+        qCWarning(BLUEZQT) << "PairingJob Error: Job was deleted before finished!";
+
+        setError(UserDefinedError);
+        setErrorText(QStringLiteral("Job was deleted before finished."));
+        emitResult();
+    }
+    if (d->m_queue) {
+        d->m_queue->d->abort(this);
+    }
+    delete d;
+}
+
+int PairingJob::count() const
+{
+    return d->m_devices.count();
+}
+
+DevicePtr PairingJob::device(int index) const
+{
+    return d->m_devices.value(index);
+}
+
+int PairingJob::finishedCount() const
+{
+    return d->m_finished;
+}
+
+int PairingJob::failedCount() const
+{
+    return d->m_failed;
+}
+
+int PairingJob::percent() const
+{
+    if (d->m_devices.isEmpty()) {
+        return isFinished() ? 100 : 0;
+    }
+    return d->m_steps * 100 / (d->m_devices.count() * d->stepCount());
+}
+
+PairingJob::Stage PairingJob::itemStage(int index) const
+{
+    return d->m_stages.value(index, Queued);
+}
+
+int PairingJob::itemError(int index) const
+{
+    return d->m_errors.value(index, PendingCall::NoError);
+}
+
+QString PairingJob::itemErrorText(int index) const
+{
+    return d->m_errorTexts.value(index);
+}
+
+int PairingJob::itemAttempts(int index) const
+{
+    return d->m_attempts.value(index);
+}
+
+bool PairingJob::connectAfterPairing() const
+{
+    return d->m_connect;
+}
+
+void PairingJob::setConnectAfterPairing(bool connect)
+{
+    d->m_connect = connect;
+}
+
+void PairingJob::doStart()
+{
+    if (!d->m_queue) {
+        setError(UserDefinedError);
+        setErrorText(QStringLiteral("Pairing queue was deleted"));
+        emitResult();
+        return;
+    }
+
+    if (d->m_devices.isEmpty()) {
+        emitResult();
+        return;
+    }
+
+    d->m_queue->d->enqueue(this);
+}
+
+void PairingJob::doEmitResult()
+{
+    Q_EMIT result(this);
+}
+
+} // namespace BluezQt
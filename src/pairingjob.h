@@ -0,0 +1,209 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PAIRINGJOB_H
+#define BLUEZQT_PAIRINGJOB_H
+
+#include <QObject>
+
+#include "job.h"
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class PairingQueue;
+
+/**
+ * @class BluezQt::PairingJob pairingjob.h <BluezQt/PairingJob>
+ *
+ * Pairing job.
+ *
+ * This class represents a list of devices queued for pairing in PairingQueue.
+ *
+ * Each device goes through the pipeline of pairing, marking as trusted and
+ * optionally connecting (see setConnectAfterPairing()). Steps that are already
+ * done (eg. device is already paired) are skipped.
+ *
+ * progress() is emitted after each finished step and deviceFinished() after
+ * each device went through the whole pipeline or failed.
+ *
+ * When all devices have finished, result() is emitted. If any of the devices
+ * failed, error() is UserDefinedError and per-device errors can be read
+ * with itemError(), itemErrorText() and itemStage().
+ *
+ * Killing the job cancels calls that are still waiting for reply.
+ */
+class BLUEZQT_EXPORT PairingJob : public Job
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count)
+    Q_PROPERTY(int finishedCount READ finishedCount)
+    Q_PROPERTY(int failedCount READ failedCount)
+    Q_PROPERTY(int percent READ percent)
+    Q_PROPERTY(bool connectAfterPairing READ connectAfterPairing WRITE setConnectAfterPairing)
+
+public:
+    /**
+     * Steps of the pairing pipeline.
+     */
+    enum Stage {
+        /** Device is waiting for a free slot on its adapter. */
+        Queued = 0,
+        /** Device is being paired. */
+        Pairing = 1,
+        /** Device is being marked as trusted. */
+        Trusting = 2,
+        /** Device is being connected. */
+        Connecting = 3,
+        /** Device went through the whole pipeline. */
+        Done = 4
+    };
+    Q_ENUM(Stage)
+
+    /**
+     * Destroys a PairingJob object.
+     */
+    ~PairingJob() override;
+
+    /**
+     * Returns the number of devices in the job.
+     *
+     * @return number of devices
+     */
+    int count() const;
+
+    /**
+     * Returns a device of item.
+     *
+     * @param index index of item
+     * @return device
+     */
+    DevicePtr device(int index) const;
+
+    /**
+     * Returns the number of finished devices.
+     *
+     * @return number of finished devices
+     */
+    int finishedCount() const;
+
+    /**
+     * Returns the number of failed devices.
+     *
+     * @return number of failed devices
+     */
+    int failedCount() const;
+
+    /**
+     * Returns the overall progress of the job.
+     *
+     * Every step of every device counts the same, failed devices
+     * count as finished.
+     *
+     * @return progress in percent
+     */
+    int percent() const;
+
+    /**
+     * Returns a stage of item.
+     *
+     * For failed items, this is the stage that failed.
+     *
+     * @param index index of item
+     * @return stage of item
+     */
+    Stage itemStage(int index) const;
+
+    /**
+     * Returns an error code of item.
+     *
+     * @param index index of item
+     * @return PendingCall::Error of last call of item
+     */
+    int itemError(int index) const;
+
+    /**
+     * Returns an error text of item.
+     *
+     * @param index index of item
+     * @return error text of last call of item
+     */
+    QString itemErrorText(int index) const;
+
+    /**
+     * Returns the number of calls made for item, including retries.
+     *
+     * @param index index of item
+     * @return number of calls
+     */
+    int itemAttempts(int index) const;
+
+    /**
+     * Returns whether devices are connected after pairing.
+     *
+     * @return true if devices are connected
+     */
+    bool connectAfterPairing() const;
+
+    /**
+     * Sets whether devices are connected after pairing.
+     *
+     * It must be called before the job is started. Default value is false.
+     *
+     * @param connect true to connect devices
+     */
+    void setConnectAfterPairing(bool connect);
+
+Q_SIGNALS:
+    /**
+     * Indicates that a step of the job have finished.
+     */
+    void progress(PairingJob *job, int percent);
+
+    /**
+     * Indicates that a device of the job have finished.
+     */
+    void deviceFinished(PairingJob *job, int index);
+
+    /**
+     * Indicates that the job have finished.
+     */
+    void result(PairingJob *job);
+
+private:
+    explicit PairingJob(const QList<DevicePtr> &devices, PairingQueue *queue);
+
+    void doStart() override;
+    void doEmitResult() override;
+
+    class PairingJobPrivate *const d;
+
+    friend class PairingJobPrivate;
+    friend class PairingQueue;
+    friend class PairingQueuePrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PAIRINGJOB_H
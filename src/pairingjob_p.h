@@ -0,0 +1,62 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PAIRINGJOB_P_H
+#define BLUEZQT_PAIRINGJOB_P_H
+
+#include <QHash>
+#include <QVector>
+#include <QPointer>
+
+#include "pairingjob.h"
+#include "types.h"
+
+namespace BluezQt
+{
+
+class PairingQueue;
+
+class PairingJobPrivate
+{
+public:
+    explicit PairingJobPrivate(PairingJob *q, const QList<DevicePtr> &devices, PairingQueue *queue);
+
+    int stepCount() const;
+    void stepFinished();
+    void itemFinished(int index, PairingJob::Stage stage, int error, const QString &errorText);
+
+    PairingJob *q;
+    QList<DevicePtr> m_devices;
+    QPointer<PairingQueue> m_queue;
+    QVector<PairingJob::Stage> m_stages;
+    QVector<int> m_errors;
+    QVector<int> m_attempts;
+    QHash<int, QString> m_errorTexts;
+    bool m_connect;
+    int m_finished;
+    int m_failed;
+    int m_steps;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PAIRINGJOB_P_H
@@ -0,0 +1,421 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pairingpolicy.h"
+#include "pairingpolicy_p.h"
+#include "device.h"
+
+#include <QTimer>
+
+namespace BluezQt
+{
+
+// Window for computing the pairing rate
+static const qint64 RateWindow = 60 * 1000;
+
+PairingPolicyPrivate::PairingPolicyPrivate(PairingPolicy *q)
+    : q(q)
+    , m_objectPath(QStringLiteral("/org/kde/bluezqt/PairingPolicy"))
+    , m_capability(Agent::DisplayYesNo)
+    , m_capabilitySet(false)
+    , m_allowAll(false)
+    , m_passkeySet(false)
+    , m_passkey(0)
+    , m_requestTimeout(-1)
+    , m_accepted(0)
+    , m_rejected(0)
+    , m_forwarded(0)
+    , m_timedOut(0)
+{
+    m_clock.start();
+}
+
+bool PairingPolicyPrivate::isAllowed(DevicePtr device) const
+{
+    return m_allowAll || isListed(device);
+}
+
+bool PairingPolicyPrivate::isListed(DevicePtr device) const
+{
+    return m_allowedAddresses.contains(device->address(), Qt::CaseInsensitive);
+}
+
+bool PairingPolicyPrivate::hasPasskey() const
+{
+    return m_passkeySet || m_passkeyFunction;
+}
+
+quint32 PairingPolicyPrivate::passkey(DevicePtr device) const
+{
+    if (m_passkeyFunction) {
+        return m_passkeyFunction(device);
+    }
+    return m_passkey;
+}
+
+template<typename T>
+void PairingPolicyPrivate::accept(const Request<T> &request, const T &value)
+{
+    request.accept(value);
+    m_accepted++;
+    m_acceptTimes.enqueue(m_clock.elapsed());
+    pruneAcceptTimes();
+}
+
+void PairingPolicyPrivate::accept(const Request<> &request)
+{
+    request.accept();
+    m_accepted++;
+    m_acceptTimes.enqueue(m_clock.elapsed());
+    pruneAcceptTimes();
+}
+
+void PairingPolicyPrivate::pruneAcceptTimes()
+{
+    const qint64 now = m_clock.elapsed();
+    while (!m_acceptTimes.isEmpty() && now - m_acceptTimes.head() > RateWindow) {
+        m_acceptTimes.dequeue();
+    }
+}
+
+template<typename T>
+void PairingPolicyPrivate::reject(const Request<T> &request)
+{
+    request.reject();
+    m_rejected++;
+}
+
+template<typename T>
+void PairingPolicyPrivate::forwarded(DevicePtr device, const Request<T> &request)
+{
+    m_forwarded++;
+
+    const int timeout = m_deviceTimeouts.value(device->address().toUpper(), m_requestTimeout);
+    if (timeout < 0) {
+        return;
+    }
+
+    QTimer::singleShot(timeout, q, [this, request]() {
+        if (request.isPending()) {
+            request.cancel();
+            m_timedOut++;
+        }
+    });
+}
+
+PairingPolicy::PairingPolicy(QObject *parent)
+    : Agent(parent)
+    , d(new PairingPolicyPrivate(this))
+{
+}
+
+PairingPolicy::~PairingPolicy()
+{
+    delete d;
+}
+
+QDBusObjectPath PairingPolicy::objectPath() const
+{
+    return d->m_objectPath;
+}
+
+void PairingPolicy::setObjectPath(const QDBusObjectPath &path)
+{
+    d->m_objectPath = path;
+}
+
+Agent::Capability PairingPolicy::capability() const
+{
+    if (!d->m_capabilitySet && d->m_agent) {
+        return d->m_agent->capability();
+    }
+    return d->m_capability;
+}
+
+void PairingPolicy::setCapability(Capability capability)
+{
+    d->m_capability = capability;
+    d->m_capabilitySet = true;
+}
+
+Agent *PairingPolicy::agent() const
+{
+    return d->m_agent;
+}
+
+void PairingPolicy::setAgent(Agent *agent)
+{
+    d->m_agent = agent;
+}
+
+bool PairingPolicy::allowAll() const
+{
+    return d->m_allowAll;
+}
+
+void PairingPolicy::setAllowAll(bool allow)
+{
+    d->m_allowAll = allow;
+}
+
+QStringList PairingPolicy::allowedAddresses() const
+{
+    return d->m_allowedAddresses;
+}
+
+void PairingPolicy::setAllowedAddresses(const QStringList &addresses)
+{
+    d->m_allowedAddresses = addresses;
+}
+
+void PairingPolicy::setPinCode(const QString &pinCode)
+{
+    d->m_pinCode = pinCode;
+}
+
+void PairingPolicy::setPinCodeFunction(const std::function<QString(DevicePtr)> &function)
+{
+    d->m_pinCodeFunction = function;
+}
+
+void PairingPolicy::setPasskey(quint32 passkey)
+{
+    d->m_passkey = passkey;
+    d->m_passkeySet = true;
+}
+
+void PairingPolicy::setPasskeyFunction(const std::function<quint32(DevicePtr)> &function)
+{
+    d->m_passkeyFunction = function;
+}
+
+QStringList PairingPolicy::allowedServices() const
+{
+    return d->m_allowedServices;
+}
+
+void PairingPolicy::setAllowedServices(const QStringList &uuids)
+{
+    d->m_allowedServices.clear();
+    Q_FOREACH (const QString &uuid, uuids) {
+        d->m_allowedServices.append(uuid.toUpper());
+    }
+}
+
+int PairingPolicy::requestTimeout() const
+{
+    return d->m_requestTimeout;
+}
+
+void PairingPolicy::setRequestTimeout(int msecs)
+{
+    d->m_requestTimeout = msecs;
+}
+
+void PairingPolicy::setRequestTimeout(const QString &address, int msecs)
+{
+    d->m_deviceTimeouts[address.toUpper()] = msecs;
+}
+
+int PairingPolicy::acceptedCount() const
+{
+    return d->m_accepted;
+}
+
+int PairingPolicy::rejectedCount() const
+{
+    return d->m_rejected;
+}
+
+int PairingPolicy::forwardedCount() const
+{
+    return d->m_forwarded;
+}
+
+int PairingPolicy::timedOutCount() const
+{
+    return d->m_timedOut;
+}
+
+double PairingPolicy::pairingRate() const
+{
+    d->pruneAcceptTimes();
+    return d->m_acceptTimes.count();
+}
+
+void PairingPolicy::resetStatistics()
+{
+    d->m_accepted = 0;
+    d->m_rejected = 0;
+    d->m_forwarded = 0;
+    d->m_timedOut = 0;
+    d->m_acceptTimes.clear();
+}
+
+void PairingPolicy::requestPinCode(DevicePtr device, const Request<QString> &request)
+{
+    if (!d->isAllowed(device)) {
+        d->reject(request);
+        return;
+    }
+
+    const QString &pinCode = d->m_pinCodeFunction ? d->m_pinCodeFunction(device) : d->m_pinCode;
+    if (!pinCode.isEmpty()) {
+        d->accept(request, pinCode);
+        return;
+    }
+
+    if (!d->m_agent) {
+        d->reject(request);
+        return;
+    }
+
+    d->forwarded(device, request);
+    d->m_agent->requestPinCode(device, request);
+}
+
+void PairingPolicy::displayPinCode(DevicePtr device, const QString &pinCode)
+{
+    if (d->m_agent) {
+        d->m_agent->displayPinCode(device, pinCode);
+    }
+}
+
+void PairingPolicy::requestPasskey(DevicePtr device, const Request<quint32> &request)
+{
+    if (!d->isAllowed(device)) {
+        d->reject(request);
+        return;
+    }
+
+    if (d->hasPasskey()) {
+        d->accept(request, d->passkey(device));
+        return;
+    }
+
+    if (!d->m_agent) {
+        d->reject(request);
+        return;
+    }
+
+    d->forwarded(device, request);
+    d->m_agent->requestPasskey(device, request);
+}
+
+void PairingPolicy::displayPasskey(DevicePtr device, const QString &passkey, const QString &entered)
+{
+    if (d->m_agent) {
+        d->m_agent->displayPasskey(device, passkey, entered);
+    }
+}
+
+void PairingPolicy::requestConfirmation(DevicePtr device, const QString &passkey, const Request<> &request)
+{
+    if (!d->isAllowed(device)) {
+        d->reject(request);
+        return;
+    }
+
+    if (d->hasPasskey()) {
+        if (passkey.toUInt() == d->passkey(device)) {
+            d->accept(request);
+        } else {
+            d->reject(request);
+        }
+        return;
+    }
+
+    if (d->isListed(device)) {
+        d->accept(request);
+        return;
+    }
+
+    if (!d->m_agent) {
+        d->reject(request);
+        return;
+    }
+
+    d->forwarded(device, request);
+    d->m_agent->requestConfirmation(device, passkey, request);
+}
+
+void PairingPolicy::requestAuthorization(DevicePtr device, const Request<> &request)
+{
+    if (!d->isAllowed(device)) {
+        d->reject(request);
+        return;
+    }
+
+    if (d->isListed(device)) {
+        d->accept(request);
+        return;
+    }
+
+    if (!d->m_agent) {
+        d->reject(request);
+        return;
+    }
+
+    d->forwarded(device, request);
+    d->m_agent->requestAuthorization(device, request);
+}
+
+void PairingPolicy::authorizeService(DevicePtr device, const QString &uuid, const Request<> &request)
+{
+    if (!d->isAllowed(device)) {
+        d->reject(request);
+        return;
+    }
+
+    if (!d->m_allowedServices.isEmpty()) {
+        if (d->m_allowedServices.contains(uuid.toUpper())) {
+            d->accept(request);
+        } else {
+            d->reject(request);
+        }
+        return;
+    }
+
+    if (!d->m_agent) {
+        d->reject(request);
+        return;
+    }
+
+    d->forwarded(device, request);
+    d->m_agent->authorizeService(device, uuid, request);
+}
+
+void PairingPolicy::cancel()
+{
+    if (d->m_agent) {
+        d->m_agent->cancel();
+    }
+}
+
+void PairingPolicy::release()
+{
+    if (d->m_agent) {
+        d->m_agent->release();
+    }
+}
+
+} // namespace BluezQt
@@ -0,0 +1,306 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PAIRINGPOLICY_H
+#define BLUEZQT_PAIRINGPOLICY_H
+
+#include <QStringList>
+
+#include <functional>
+
+#include "agent.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::PairingPolicy pairingpolicy.h <BluezQt/PairingPolicy>
+ *
+ * Pairing policy.
+ *
+ * This class is an agent that answers pairing requests by declarative rules,
+ * right when the requests arrive, without involving the application. Requests
+ * not covered by the rules are forwarded to another agent set with setAgent().
+ *
+ * The rules are:
+ * <ul>
+ *  <li>Requests from devices that are not allowed are rejected. Only the allowed
+ *      addresses are allowed, unless all devices are allowed with setAllowAll().</li>
+ *  <li>PIN code requests are accepted with the PIN code, if set.</li>
+ *  <li>Passkey requests are accepted with the passkey, if set.</li>
+ *  <li>Passkey confirmations are accepted if the passkey matches the passkey, if set,
+ *      otherwise they are rejected. Without passkey, confirmations from the allowed
+ *      addresses are accepted.</li>
+ *  <li>Authorization requests from the allowed addresses are accepted.</li>
+ *  <li>If the allowed services are set, service authorizations are accepted only for them.</li>
+ * </ul>
+ *
+ * Forwarded requests can be canceled automatically if the agent does not answer
+ * them in time, see setRequestTimeout().
+ *
+ * Example use:
+ * @code
+ * BluezQt::PairingPolicy *policy = new BluezQt::PairingPolicy(this);
+ * policy->setAllowedAddresses(addresses);
+ * policy->setPasskeyFunction([](BluezQt::DevicePtr device) {
+ *     return passkeyForSerialNumber(device->name());
+ * });
+ * manager->registerAgent(policy);
+ * manager->requestDefaultAgent(policy);
+ * @endcode
+ */
+class BLUEZQT_EXPORT PairingPolicy : public Agent
+{
+    Q_OBJECT
+
+    Q_PROPERTY(bool allowAll READ allowAll WRITE setAllowAll)
+    Q_PROPERTY(QStringList allowedAddresses READ allowedAddresses WRITE setAllowedAddresses)
+    Q_PROPERTY(QStringList allowedServices READ allowedServices WRITE setAllowedServices)
+    Q_PROPERTY(int requestTimeout READ requestTimeout WRITE setRequestTimeout)
+    Q_PROPERTY(int acceptedCount READ acceptedCount)
+    Q_PROPERTY(int rejectedCount READ rejectedCount)
+    Q_PROPERTY(int forwardedCount READ forwardedCount)
+    Q_PROPERTY(int timedOutCount READ timedOutCount)
+    Q_PROPERTY(double pairingRate READ pairingRate)
+
+public:
+    /**
+     * Creates a new PairingPolicy object.
+     *
+     * @param parent
+     */
+    explicit PairingPolicy(QObject *parent = nullptr);
+
+    /**
+     * Destroys a PairingPolicy object.
+     */
+    ~PairingPolicy();
+
+    /**
+     * D-Bus object path of the policy agent.
+     *
+     * Default object path is /org/kde/bluezqt/PairingPolicy.
+     *
+     * @return object path of agent
+     */
+    QDBusObjectPath objectPath() const override;
+
+    /**
+     * Sets the D-Bus object path of the policy agent.
+     *
+     * @param path object path
+     */
+    void setObjectPath(const QDBusObjectPath &path);
+
+    /**
+     * Input/output capability of the policy agent.
+     *
+     * Default capability is the capability of the forwarding agent,
+     * or DisplayYesNo if there is none.
+     *
+     * @return capability of agent
+     */
+    Capability capability() const override;
+
+    /**
+     * Sets the input/output capability of the policy agent.
+     *
+     * @param capability capability
+     */
+    void setCapability(Capability capability);
+
+    /**
+     * Returns the agent that gets requests not covered by the policy.
+     *
+     * @return forwarding agent
+     */
+    Agent *agent() const;
+
+    /**
+     * Sets the agent that gets requests not covered by the policy.
+     *
+     * Without agent, such requests are rejected.
+     *
+     * @param agent forwarding agent
+     */
+    void setAgent(Agent *agent);
+
+    /**
+     * Returns whether requests from all devices are allowed.
+     *
+     * @return true if all devices are allowed
+     */
+    bool allowAll() const;
+
+    /**
+     * Sets whether requests from all devices are allowed.
+     *
+     * Requests from devices other than the allowed addresses are then
+     * handled by the rules too, instead of being rejected.
+     * Default value is false.
+     *
+     * @param allow true to allow all devices
+     */
+    void setAllowAll(bool allow);
+
+    /**
+     * Returns the allowed device addresses.
+     *
+     * @return allowed addresses
+     */
+    QStringList allowedAddresses() const;
+
+    /**
+     * Sets the allowed device addresses.
+     *
+     * Unless setAllowAll() is enabled, requests from all other devices are rejected.
+     *
+     * @param addresses allowed addresses
+     */
+    void setAllowedAddresses(const QStringList &addresses);
+
+    /**
+     * Sets a fixed PIN code for all devices.
+     *
+     * @param pinCode PIN code
+     */
+    void setPinCode(const QString &pinCode);
+
+    /**
+     * Sets a function deriving the PIN code of a device.
+     *
+     * @param function function returning PIN code, empty string to forward the request
+     */
+    void setPinCodeFunction(const std::function<QString(DevicePtr)> &function);
+
+    /**
+     * Sets a fixed passkey for all devices.
+     *
+     * @param passkey passkey (0-999999)
+     */
+    void setPasskey(quint32 passkey);
+
+    /**
+     * Sets a function deriving the passkey of a device.
+     *
+     * @param function function returning passkey
+     */
+    void setPasskeyFunction(const std::function<quint32(DevicePtr)> &function);
+
+    /**
+     * Returns the allowed service UUIDs.
+     *
+     * @return allowed services, empty if service authorizations are forwarded
+     */
+    QStringList allowedServices() const;
+
+    /**
+     * Sets the allowed service UUIDs.
+     *
+     * @param uuids allowed services, empty to forward service authorizations
+     */
+    void setAllowedServices(const QStringList &uuids);
+
+    /**
+     * Returns the timeout for answering forwarded requests.
+     *
+     * @return timeout in milliseconds, -1 if disabled
+     */
+    int requestTimeout() const;
+
+    /**
+     * Sets the timeout for answering forwarded requests.
+     *
+     * Requests not answered within the timeout are canceled. Default is -1 (disabled).
+     *
+     * @param msecs timeout in milliseconds, -1 to disable
+     */
+    void setRequestTimeout(int msecs);
+
+    /**
+     * Sets the timeout for answering forwarded requests of one device.
+     *
+     * @param address address of device
+     * @param msecs timeout in milliseconds, -1 to disable
+     */
+    void setRequestTimeout(const QString &address, int msecs);
+
+    /**
+     * Returns the number of requests accepted by the policy.
+     *
+     * @return number of requests
+     */
+    int acceptedCount() const;
+
+    /**
+     * Returns the number of requests rejected or canceled by the policy.
+     *
+     * @return number of requests
+     */
+    int rejectedCount() const;
+
+    /**
+     * Returns the number of requests forwarded to the agent.
+     *
+     * @return number of requests
+     */
+    int forwardedCount() const;
+
+    /**
+     * Returns the number of forwarded requests canceled because of timeout.
+     *
+     * @return number of requests
+     */
+    int timedOutCount() const;
+
+    /**
+     * Returns the rate of accepted requests.
+     *
+     * @return number of requests accepted in the last minute
+     */
+    double pairingRate() const;
+
+    /**
+     * Resets all statistics.
+     */
+    void resetStatistics();
+
+    void requestPinCode(DevicePtr device, const Request<QString> &request) override;
+    void displayPinCode(DevicePtr device, const QString &pinCode) override;
+    void requestPasskey(DevicePtr device, const Request<quint32> &request) override;
+    void displayPasskey(DevicePtr device, const QString &passkey, const QString &entered) override;
+    void requestConfirmation(DevicePtr device, const QString &passkey, const Request<> &request) override;
+    void requestAuthorization(DevicePtr device, const Request<> &request) override;
+    void authorizeService(DevicePtr device, const QString &uuid, const Request<> &request) override;
+    void cancel() override;
+    void release() override;
+
+private:
+    class PairingPolicyPrivate *const d;
+
+    friend class PairingPolicyPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PAIRINGPOLICY_H
@@ -0,0 +1,83 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PAIRINGPOLICY_P_H
+#define BLUEZQT_PAIRINGPOLICY_P_H
+
+#include <QHash>
+#include <QQueue>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QDBusObjectPath>
+
+#include "pairingpolicy.h"
+
+namespace BluezQt
+{
+
+class PairingPolicyPrivate
+{
+public:
+    explicit PairingPolicyPrivate(PairingPolicy *q);
+
+    bool isAllowed(DevicePtr device) const;
+    bool isListed(DevicePtr device) const;
+    bool hasPasskey() const;
+    quint32 passkey(DevicePtr device) const;
+
+    template<typename T>
+    void accept(const Request<T> &request, const T &value);
+    void accept(const Request<> &request);
+    template<typename T>
+    void reject(const Request<T> &request);
+    template<typename T>
+    void forwarded(DevicePtr device, const Request<T> &request);
+    void pruneAcceptTimes();
+
+    PairingPolicy *q;
+    QDBusObjectPath m_objectPath;
+    Agent::Capability m_capability;
+    bool m_capabilitySet;
+    QPointer<Agent> m_agent;
+    bool m_allowAll;
+    QStringList m_allowedAddresses;
+    QStringList m_allowedServices;
+    QString m_pinCode;
+    std::function<QString(DevicePtr)> m_pinCodeFunction;
+    bool m_passkeySet;
+    quint32 m_passkey;
+    std::function<quint32(DevicePtr)> m_passkeyFunction;
+    int m_requestTimeout;
+    QHash<QString, int> m_deviceTimeouts;
+
+    // Statistics
+    int m_accepted;
+    int m_rejected;
+    int m_forwarded;
+    int m_timedOut;
+    QElapsedTimer m_clock;
+    QQueue<qint64> m_acceptTimes;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PAIRINGPOLICY_P_H
@@ -0,0 +1,377 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pairingqueue.h"
+#include "pairingqueue_p.h"
+#include "pairingjob.h"
+#include "pairingjob_p.h"
+#include "device.h"
+#include "adapter.h"
+#include "pendingcall.h"
+#include "utils.h"
+#include "debug.h"
+
+#include <QTimer>
+
+namespace BluezQt
+{
+
+PairingQueuePrivate::PairingQueuePrivate(PairingQueue *q)
+    : QObject()
+    , q(q)
+    , m_maxActive(1)
+    , m_maxRetries(3)
+    , m_initialBackoff(1000)
+    , m_maximumBackoff(16000)
+{
+}
+
+void PairingQueuePrivate::enqueue(PairingJob *job)
+{
+    QList<int> invalid;
+    QSet<QString> adapters;
+
+    for (int i = 0; i < job->d->m_devices.count(); ++i) {
+        const DevicePtr &device = job->d->m_devices.at(i);
+        if (!device) {
+            invalid.append(i);
+            continue;
+        }
+
+        ItemPtr item = ItemPtr(new Item);
+        item->job = job;
+        item->index = i;
+        item->device = device;
+        item->adapter = device->adapter() ? device->adapter()->ubi() : QString();
+        item->stage = PairingJob::Queued;
+        item->attempts = 0;
+        item->active = false;
+        item->aborted = false;
+
+        m_items.append(item);
+        m_queues[item->adapter].enqueue(item);
+        adapters.insert(item->adapter);
+    }
+
+    Q_FOREACH (int index, invalid) {
+        job->d->itemFinished(index, PairingJob::Pairing, PendingCall::InvalidArguments, QStringLiteral("Invalid device"));
+    }
+
+    Q_FOREACH (const QString &adapter, adapters) {
+        dispatch(adapter);
+    }
+}
+
+void PairingQueuePrivate::abort(PairingJob *job)
+{
+    QSet<QString> adapters;
+
+    const QList<ItemPtr> items = m_items;
+    Q_FOREACH (const ItemPtr &item, items) {
+        if (item->job != job) {
+            continue;
+        }
+
+        item->aborted = true;
+        m_items.removeOne(item);
+
+        if (item->call) {
+            item->call->cancel();
+            if (item->stage == PairingJob::Pairing) {
+                item->device->cancelPairing();
+            }
+        }
+
+        if (item->active) {
+            item->active = false;
+            m_active[item->adapter]--;
+            adapters.insert(item->adapter);
+        }
+    }
+
+    Q_FOREACH (const QString &adapter, adapters) {
+        dispatch(adapter);
+    }
+}
+
+void PairingQueuePrivate::dispatch(const QString &adapter)
+{
+    // Items finishing synchronously are picked up by the outer loop
+    if (m_dispatching.contains(adapter)) {
+        return;
+    }
+    m_dispatching.insert(adapter);
+
+    while (!m_queues[adapter].isEmpty() && m_active.value(adapter) < maxActive(adapter)) {
+        const ItemPtr item = m_queues[adapter].dequeue();
+
+        if (item->aborted) {
+            continue;
+        }
+
+        item->active = true;
+        item->stage = PairingJob::Pairing;
+        m_active[adapter]++;
+        runStage(item);
+    }
+
+    m_dispatching.remove(adapter);
+}
+
+void PairingQueuePrivate::runStage(const ItemPtr &item)
+{
+    PendingCall *call = nullptr;
+
+    switch (item->stage) {
+    case PairingJob::Pairing:
+        if (!item->device->isPaired()) {
+            call = item->device->pair();
+        }
+        break;
+
+    case PairingJob::Trusting:
+        if (!item->device->isTrusted()) {
+            call = item->device->setTrusted(true);
+        }
+        break;
+
+    case PairingJob::Connecting:
+        if (!item->device->isConnected()) {
+            call = item->device->connectToDevice();
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    // Step is already done
+    if (!call) {
+        nextStage(item);
+        return;
+    }
+
+    item->attempts++;
+    item->call = call;
+    item->job->d->m_attempts[item->index]++;
+
+    connect(call, &PendingCall::finished, this, [this, item](PendingCall *finishedCall) {
+        item->call = nullptr;
+        stageFinished(item, finishedCall->error(), finishedCall->errorText());
+    });
+}
+
+void PairingQueuePrivate::stageFinished(const ItemPtr &item, int error, const QString &errorText)
+{
+    // Killed job releases its items when it is deleted
+    if (item->aborted || !item->job || !item->job->isRunning()) {
+        return;
+    }
+
+    if (item->stage == PairingJob::Pairing && error == PendingCall::AlreadyExists) {
+        error = PendingCall::NoError;
+    } else if (item->stage == PairingJob::Connecting && error == PendingCall::AlreadyConnected) {
+        error = PendingCall::NoError;
+    }
+
+    if (error == PendingCall::NoError) {
+        nextStage(item);
+        return;
+    }
+
+    if (isRetryable(error) && item->attempts <= m_maxRetries) {
+        const int delay = Retry::backoffDelay(item->attempts - 1, m_initialBackoff, m_maximumBackoff);
+
+        qCDebug(BLUEZQT) << "PairingQueue: Retrying" << item->device->ubi() << "in" << delay << "ms";
+
+        // The adapter slot stays taken until the device finishes
+        QTimer::singleShot(delay, this, [this, item]() {
+            if (!item->aborted) {
+                runStage(item);
+            }
+        });
+        return;
+    }
+
+    finishItem(item, error, errorText);
+}
+
+void PairingQueuePrivate::nextStage(const ItemPtr &item)
+{
+    item->job->d->stepFinished();
+    item->attempts = 0;
+
+    switch (item->stage) {
+    case PairingJob::Pairing:
+        item->stage = PairingJob::Trusting;
+        break;
+
+    case PairingJob::Trusting:
+        item->stage = item->job->d->m_connect ? PairingJob::Connecting : PairingJob::Done;
+        break;
+
+    default:
+        item->stage = PairingJob::Done;
+        break;
+    }
+
+    if (item->stage == PairingJob::Done) {
+        finishItem(item, PendingCall::NoError, QString());
+        return;
+    }
+
+    runStage(item);
+}
+
+void PairingQueuePrivate::finishItem(const ItemPtr &item, int error, const QString &errorText)
+{
+    m_items.removeOne(item);
+
+    if (item->active) {
+        item->active = false;
+        m_active[item->adapter]--;
+    }
+
+    if (item->job) {
+        item->job->d->itemFinished(item->index, item->stage, error, errorText);
+    }
+
+    dispatch(item->adapter);
+}
+
+int PairingQueuePrivate::maxActive(const QString &adapter) const
+{
+    return m_adapterLimits.value(adapter, m_maxActive);
+}
+
+bool PairingQueuePrivate::isRetryable(int error)
+{
+    // Agent on the remote side may answer on the next try
+    return error == PendingCall::AuthenticationTimeout || Retry::isRetryable(error);
+}
+
+PairingQueue::PairingQueue(QObject *parent)
+    : QObject(parent)
+    , d(new PairingQueuePrivate(this))
+{
+}
+
+PairingQueue::~PairingQueue()
+{
+    // Unfinished jobs are children of this object and finish with error when deleted
+    delete d;
+}
+
+int PairingQueue::maxPairingsPerAdapter() const
+{
+    return d->m_maxActive;
+}
+
+void PairingQueue::setMaxPairingsPerAdapter(int count)
+{
+    d->m_maxActive = qMax(1, count);
+
+    const QStringList adapters = d->m_queues.keys();
+    Q_FOREACH (const QString &adapter, adapters) {
+        d->dispatch(adapter);
+    }
+}
+
+int PairingQueue::maxPairings(AdapterPtr adapter) const
+{
+    if (!adapter) {
+        return d->m_maxActive;
+    }
+    return d->maxActive(adapter->ubi());
+}
+
+void PairingQueue::setMaxPairings(AdapterPtr adapter, int count)
+{
+    if (!adapter) {
+        return;
+    }
+
+    if (count < 0) {
+        d->m_adapterLimits.remove(adapter->ubi());
+    } else {
+        d->m_adapterLimits.insert(adapter->ubi(), qMax(1, count));
+    }
+
+    if (d->m_queues.contains(adapter->ubi())) {
+        d->dispatch(adapter->ubi());
+    }
+}
+
+int PairingQueue::maxRetries() const
+{
+    return d->m_maxRetries;
+}
+
+void PairingQueue::setMaxRetries(int count)
+{
+    d->m_maxRetries = qMax(0, count);
+}
+
+int PairingQueue::initialBackoff() const
+{
+    return d->m_initialBackoff;
+}
+
+void PairingQueue::setInitialBackoff(int msecs)
+{
+    d->m_initialBackoff = qMax(0, msecs);
+}
+
+int PairingQueue::maximumBackoff() const
+{
+    return d->m_maximumBackoff;
+}
+
+void PairingQueue::setMaximumBackoff(int msecs)
+{
+    d->m_maximumBackoff = qMax(0, msecs);
+}
+
+int PairingQueue::pendingCount() const
+{
+    return d->m_items.count();
+}
+
+int PairingQueue::activeCount(AdapterPtr adapter) const
+{
+    if (!adapter) {
+        return 0;
+    }
+    return d->m_active.value(adapter->ubi());
+}
+
+PairingJob *PairingQueue::pairDevices(const QList<DevicePtr> &devices)
+{
+    return new PairingJob(devices, this);
+}
+
+PairingJob *PairingQueue::pairDevice(DevicePtr device)
+{
+    return pairDevices(QList<DevicePtr>() << device);
+}
+
+} // namespace BluezQt
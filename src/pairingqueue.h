@@ -0,0 +1,221 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PAIRINGQUEUE_H
+#define BLUEZQT_PAIRINGQUEUE_H
+
+#include <QObject>
+
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+class PairingJob;
+
+/**
+ * @class BluezQt::PairingQueue pairingqueue.h <BluezQt/PairingQueue>
+ *
+ * Pairing queue.
+ *
+ * PairingQueue pairs lists of devices. Each device is paired, marked as trusted
+ * and optionally connected, see PairingJob.
+ *
+ * Devices are queued per adapter and only maxPairingsPerAdapter() devices
+ * of one adapter go through the pipeline at the same time, devices of different
+ * adapters are paired in parallel.
+ *
+ * Calls that fail with PendingCall::AuthenticationTimeout, PendingCall::ConnectionAttemptFailed,
+ * PendingCall::NotReady or PendingCall::InProgress are retried with exponential backoff
+ * up to maxRetries() times. PendingCall::AlreadyExists error of pairing and
+ * PendingCall::AlreadyConnected error of connecting are treated as success.
+ *
+ * Pairing needs an agent registered with Manager::registerAgent(),
+ * see eg. PairingPolicy.
+ *
+ * Example use:
+ * @code
+ * BluezQt::PairingJob *job = pairingQueue->pairDevices(devices);
+ * job->setConnectAfterPairing(true);
+ * connect(job, &BluezQt::PairingJob::progress, this, [](BluezQt::PairingJob *, int percent) {
+ *     qDebug() << "Pairing:" << percent << "%";
+ * });
+ * connect(job, &BluezQt::PairingJob::result, this, [](BluezQt::PairingJob *job) {
+ *     qDebug() << "Paired" << job->count() - job->failedCount() << "of" << job->count() << "devices";
+ * });
+ * job->start();
+ * @endcode
+ */
+class BLUEZQT_EXPORT PairingQueue : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int maxPairingsPerAdapter READ maxPairingsPerAdapter WRITE setMaxPairingsPerAdapter)
+    Q_PROPERTY(int maxRetries READ maxRetries WRITE setMaxRetries)
+    Q_PROPERTY(int initialBackoff READ initialBackoff WRITE setInitialBackoff)
+    Q_PROPERTY(int maximumBackoff READ maximumBackoff WRITE setMaximumBackoff)
+    Q_PROPERTY(int pendingCount READ pendingCount)
+
+public:
+    /**
+     * Creates a new PairingQueue object.
+     *
+     * @param parent
+     */
+    explicit PairingQueue(QObject *parent = nullptr);
+
+    /**
+     * Destroys a PairingQueue object.
+     *
+     * All unfinished jobs finish with error.
+     */
+    ~PairingQueue();
+
+    /**
+     * Returns the maximum number of devices paired at the same time per adapter.
+     *
+     * @return maximum number of devices
+     */
+    int maxPairingsPerAdapter() const;
+
+    /**
+     * Sets the maximum number of devices paired at the same time per adapter.
+     *
+     * Default value is 1, meaning devices of one adapter are paired one by one.
+     *
+     * @param count maximum number of devices (at least 1)
+     */
+    void setMaxPairingsPerAdapter(int count);
+
+    /**
+     * Returns the maximum number of devices paired at the same time on the adapter.
+     *
+     * @param adapter adapter
+     * @return maximum number of devices
+     */
+    int maxPairings(AdapterPtr adapter) const;
+
+    /**
+     * Sets the maximum number of devices paired at the same time on the adapter.
+     *
+     * This overrides maxPairingsPerAdapter() for the adapter.
+     *
+     * @param adapter adapter
+     * @param count maximum number of devices (at least 1), -1 to use maxPairingsPerAdapter()
+     */
+    void setMaxPairings(AdapterPtr adapter, int count);
+
+    /**
+     * Returns the maximum number of retries of failed call.
+     *
+     * @return maximum number of retries
+     */
+    int maxRetries() const;
+
+    /**
+     * Sets the maximum number of retries of failed call.
+     *
+     * Default value is 3.
+     *
+     * @param count maximum number of retries
+     */
+    void setMaxRetries(int count);
+
+    /**
+     * Returns the delay before first retry.
+     *
+     * @return delay in milliseconds
+     */
+    int initialBackoff() const;
+
+    /**
+     * Sets the delay before first retry.
+     *
+     * The delay is doubled with each following retry.
+     * Default value is 1000 milliseconds.
+     *
+     * @param msecs delay in milliseconds
+     */
+    void setInitialBackoff(int msecs);
+
+    /**
+     * Returns the maximum delay between retries.
+     *
+     * @return delay in milliseconds
+     */
+    int maximumBackoff() const;
+
+    /**
+     * Sets the maximum delay between retries.
+     *
+     * Default value is 16000 milliseconds.
+     *
+     * @param msecs delay in milliseconds
+     */
+    void setMaximumBackoff(int msecs);
+
+    /**
+     * Returns the number of devices waiting in the queue or being paired.
+     *
+     * @return number of pending devices
+     */
+    int pendingCount() const;
+
+    /**
+     * Returns the number of devices being paired on the adapter.
+     *
+     * @param adapter adapter
+     * @return number of active devices
+     */
+    int activeCount(AdapterPtr adapter) const;
+
+    /**
+     * Creates a job that pairs the devices.
+     *
+     * The job needs to be started with Job::start().
+     *
+     * @param devices devices to pair
+     * @return pairing job
+     */
+    PairingJob *pairDevices(const QList<DevicePtr> &devices);
+
+    /**
+     * Creates a job that pairs the device.
+     *
+     * The job needs to be started with Job::start().
+     *
+     * @param device device to pair
+     * @return pairing job
+     */
+    PairingJob *pairDevice(DevicePtr device);
+
+private:
+    class PairingQueuePrivate *const d;
+
+    friend class PairingQueuePrivate;
+    friend class PairingJob;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PAIRINGQUEUE_H
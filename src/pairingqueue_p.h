@@ -0,0 +1,87 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PAIRINGQUEUE_P_H
+#define BLUEZQT_PAIRINGQUEUE_P_H
+
+#include <QHash>
+#include <QQueue>
+#include <QSet>
+#include <QPointer>
+#include <QSharedPointer>
+
+#include "pairingjob.h"
+#include "types.h"
+
+namespace BluezQt
+{
+
+class PendingCall;
+class PairingQueue;
+
+class PairingQueuePrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Item
+    {
+        QPointer<PairingJob> job;
+        int index;
+        DevicePtr device;
+        QString adapter;
+        PairingJob::Stage stage;
+        QPointer<PendingCall> call;
+        int attempts;
+        bool active;
+        bool aborted;
+    };
+    typedef QSharedPointer<Item> ItemPtr;
+
+    explicit PairingQueuePrivate(PairingQueue *q);
+
+    void enqueue(PairingJob *job);
+    void abort(PairingJob *job);
+    void dispatch(const QString &adapter);
+    void runStage(const ItemPtr &item);
+    void stageFinished(const ItemPtr &item, int error, const QString &errorText);
+    void finishItem(const ItemPtr &item, int error, const QString &errorText);
+    void nextStage(const ItemPtr &item);
+
+    int maxActive(const QString &adapter) const;
+    static bool isRetryable(int error);
+
+    PairingQueue *q;
+    QList<ItemPtr> m_items;
+    QHash<QString, QQueue<ItemPtr> > m_queues;
+    QHash<QString, int> m_active;
+    QHash<QString, int> m_adapterLimits;
+    QSet<QString> m_dispatching;
+    int m_maxActive;
+    int m_maxRetries;
+    int m_initialBackoff;
+    int m_maximumBackoff;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PAIRINGQUEUE_P_H
@@ -21,15 +21,17 @@
  */
 
 #include "pendingcall.h"
+#include "pendingcall_p.h"
+#include "callscheduler_p.h"
 #include "obextransfer.h"
 #include "obextransfer_p.h"
 #include "obexfiletransferentry.h"
 #include "bluezqt_dbustypes.h"
 #include "debug.h"
 
-#include <QTimer>
 #include <QDBusPendingReply>
 #include <QDBusPendingCallWatcher>
+#include <QDBusUnixFileDescriptor>
 
 namespace BluezQt
 {
@@ -37,6 +39,10 @@ namespace BluezQt
 static PendingCall::Error nameToError(const QString &name)
 {
     if (name.startsWith(QLatin1String("org.freedesktop.DBus.Error"))) {
+        if (name == QLatin1String("org.freedesktop.DBus.Error.NoReply")
+                || name == QLatin1String("org.freedesktop.DBus.Error.Timeout")) {
+            return PendingCall::TimedOut;
+        }
         return PendingCall::DBusError;
     }
 
@@ -57,6 +63,8 @@ static PendingCall::Error nameToError(const QString &name)
     FROM_BLUEZ_ERROR("InvalidArguments", PendingCall::InvalidArguments);
     FROM_BLUEZ_ERROR("AlreadyExists", PendingCall::AlreadyExists);
     FROM_BLUEZ_ERROR("DoesNotExist", PendingCall::DoesNotExist);
+    FROM_BLUEZ_ERROR("InProgress", PendingCall::InProgress);
+    FROM_BLUEZ_ERROR("NotInProgress", PendingCall::NotInProgress);
     FROM_BLUEZ_ERROR("AlreadyConnected", PendingCall::AlreadyConnected);
     FROM_BLUEZ_ERROR("ConnectFailed", PendingCall::ConnectFailed);
     FROM_BLUEZ_ERROR("NotConnected", PendingCall::NotConnected);
@@ -72,128 +80,90 @@ static PendingCall::Error nameToError(const QString &name)
     return PendingCall::UnknownError;
 }
 
-class PendingCallPrivate : public QObject
-{
-public:
-    explicit PendingCallPrivate(PendingCall *parent);
-
-    void processReply(QDBusPendingCallWatcher *call);
-    void processVoidReply(const QDBusPendingReply<> &reply);
-    void processUint32Reply(const QDBusPendingReply<quint32> &reply);
-    void processStringReply(const QDBusPendingReply<QString> &reply);
-    void processObjectPathReply(const QDBusPendingReply<QDBusObjectPath> &reply);
-    void processFileTransferListReply(const QDBusPendingReply<QVariantMapList> &reply);
-    void processTransferWithPropertiesReply(const QDBusPendingReply<QDBusObjectPath, QVariantMap> &reply);
-    void processError(const QDBusError &m_error);
-
-    void emitFinished();
-    void emitDelayedFinished();
-    void emitInternalError(const QString &errorText);
-    void pendingCallFinished(QDBusPendingCallWatcher *m_watcher);
-
-    PendingCall *q;
-    int m_error;
-    QString m_errorText;
-    QVariant m_userData;
-    QVariantList m_value;
-    PendingCall::ReturnType m_type;
-    QDBusPendingCallWatcher *m_watcher;
-};
-
 PendingCallPrivate::PendingCallPrivate(PendingCall *parent)
-    : QObject(parent)
-    , q(parent)
+    : q(parent)
     , m_error(PendingCall::NoError)
-    , m_type(PendingCall::ReturnVoid)
     , m_watcher(nullptr)
+    , m_timer(nullptr)
+    , m_timeout(-1)
+    , m_done(false)
+    , m_queued(false)
 {
 }
 
-void PendingCallPrivate::processReply(QDBusPendingCallWatcher *call)
+PendingCallPrivate::~PendingCallPrivate()
 {
-    switch (m_type) {
-    case PendingCall::ReturnVoid:
-        processVoidReply(*call);
-        break;
-
-    case PendingCall::ReturnUint32:
-        processUint32Reply(*call);
-        break;
-
-    case PendingCall::ReturnString:
-        processStringReply(*call);
-        break;
-
-    case PendingCall::ReturnObjectPath:
-        processObjectPathReply(*call);
-        break;
-
-    case PendingCall::ReturnFileTransferList:
-        processFileTransferListReply(*call);
-        break;
-
-    case PendingCall::ReturnTransferWithProperties:
-        processTransferWithPropertiesReply(*call);
-        break;
-
-    default:
-        break;
-    }
 }
 
-void PendingCallPrivate::processVoidReply(const QDBusPendingReply<> &reply)
+void PendingCallPrivate::processReply(QDBusPendingCallWatcher *call)
 {
-    processError(reply.error());
+    processError(call->error());
 }
 
-void PendingCallPrivate::processUint32Reply(const QDBusPendingReply<quint32> &reply)
+QVariant PendingCallPrivate::value() const
 {
-    processError(reply.error());
-    if (!reply.isError()) {
-        m_value.append(reply.value());
-    }
+    return QVariant();
 }
 
-void PendingCallPrivate::processStringReply(const QDBusPendingReply<QString> &reply)
+QList<ObexFileTransferEntry> PendingCallPrivate::fileTransferList(const QVariantMapList &list)
 {
-    processError(reply.error());
-    if (!reply.isError()) {
-        m_value.append(reply.value());
+    QList<ObexFileTransferEntry> items;
+    items.reserve(list.size());
+    Q_FOREACH (const QVariantMap &map, list) {
+        items.append(ObexFileTransferEntry(map));
     }
+    return items;
 }
 
-void PendingCallPrivate::processObjectPathReply(const QDBusPendingReply<QDBusObjectPath> &reply)
+ObexTransferPtr PendingCallPrivate::transferWithProperties(const QDBusObjectPath &path, const QVariantMap &properties)
 {
-    processError(reply.error());
-    if (!reply.isError()) {
-        m_value.append(QVariant::fromValue(reply.value()));
-    }
+    ObexTransferPtr transfer = ObexTransferPtr(new ObexTransfer(path.path(), properties));
+    transfer->d->q = transfer.toWeakRef();
+    transfer->d->m_suspendable = true;
+    return transfer;
 }
 
-void PendingCallPrivate::processFileTransferListReply(const QDBusPendingReply<QVariantMapList> &reply)
+AcquireCallPrivate::AcquireCallPrivate(QObject *owner, const SocketHandler &handler)
+    : PendingCallPrivate(nullptr)
+    , m_owner(owner)
+    , m_handler(handler)
 {
-    processError(reply.error());
-    if (!reply.isError()) {
-        QList<ObexFileTransferEntry> items;
-        items.reserve(reply.value().size());
-        Q_FOREACH (const QVariantMap &map, reply.value()) {
-            items.append(ObexFileTransferEntry(map));
-        }
-        m_value.append(QVariant::fromValue(items));
-    }
 }
 
-void PendingCallPrivate::processTransferWithPropertiesReply(const QDBusPendingReply<QDBusObjectPath, QVariantMap> &reply)
+void AcquireCallPrivate::processReply(QDBusPendingCallWatcher *call)
 {
+    const QDBusPendingReply<QDBusUnixFileDescriptor, quint16> reply = *call;
     processError(reply.error());
     if (reply.isError()) {
         return;
     }
 
-    ObexTransferPtr transfer = ObexTransferPtr(new ObexTransfer(reply.argumentAt<0>().path(), reply.argumentAt<1>()));
-    transfer->d->q = transfer.toWeakRef();
-    transfer->d->m_suspendable = true;
-    m_value.append(QVariant::fromValue(transfer));
+    if (!m_owner) {
+        m_error = PendingCall::InternalError;
+        m_errorText = QStringLiteral("Object was removed");
+        return;
+    }
+
+    // Call succeeds only if the owner can use the socket
+    const QString &errorText = m_handler(reply.argumentAt<0>(), reply.argumentAt<1>());
+    if (!errorText.isEmpty()) {
+        qCWarning(BLUEZQT) << "PendingCall Error:" << errorText;
+        m_error = PendingCall::Failed;
+        m_errorText = errorText;
+    }
+}
+
+void PendingCallPrivate::startCall(const QDBusPendingCall &call)
+{
+    static const int metaTypeId = qDBusRegisterMetaType<QVariantMapList>();
+    Q_UNUSED(metaTypeId)
+
+    m_queued = false;
+    m_watcher = new QDBusPendingCallWatcher(call, q);
+
+    QObject::connect(m_watcher, &QDBusPendingCallWatcher::finished, q, [this](QDBusPendingCallWatcher *watcher) {
+        pendingCallFinished(watcher);
+    });
 }
 
 void PendingCallPrivate::processError(const QDBusError &error)
@@ -207,18 +177,24 @@ void PendingCallPrivate::processError(const QDBusError &error)
 
 void PendingCallPrivate::emitFinished()
 {
-    m_watcher->deleteLater();
-    m_watcher = nullptr;
+    if (m_watcher) {
+        m_watcher->deleteLater();
+        m_watcher = nullptr;
+    }
+    if (m_timer) {
+        m_timer->stop();
+    }
+    m_done = true;
     Q_EMIT q->finished(q);
     q->deleteLater();
 }
 
 void PendingCallPrivate::emitDelayedFinished()
 {
-    Q_ASSERT(qobject_cast<QTimer*>(sender()));
-
-    Q_EMIT q->finished(q);
-    static_cast<QTimer*>(sender())->deleteLater();
+    if (m_done) {
+        return;
+    }
+    emitFinished();
 }
 
 void PendingCallPrivate::emitInternalError(const QString &errorText)
@@ -229,6 +205,26 @@ void PendingCallPrivate::emitInternalError(const QString &errorText)
     emitFinished();
 }
 
+void PendingCallPrivate::emitTimedOut()
+{
+    qCWarning(BLUEZQT) << "PendingCall Error: Call timed out";
+    stopProcessing();
+    m_error = PendingCall::TimedOut;
+    m_errorText = QStringLiteral("Call timed out");
+    emitFinished();
+}
+
+void PendingCallPrivate::stopProcessing()
+{
+    // Deleting the watcher releases the pending D-Bus call, the reply is dropped
+    delete m_watcher;
+    m_watcher = nullptr;
+
+    if (m_timer) {
+        m_timer->stop();
+    }
+}
+
 void PendingCallPrivate::pendingCallFinished(QDBusPendingCallWatcher *watcher)
 {
     processReply(watcher);
@@ -236,28 +232,49 @@ void PendingCallPrivate::pendingCallFinished(QDBusPendingCallWatcher *watcher)
 }
 
 PendingCall::PendingCall(const QDBusPendingCall &call, ReturnType type, QObject *parent)
-    : QObject(parent)
-    , d(new PendingCallPrivate(this))
+    : PendingCall(new PendingCallPrivate(this), call, parent)
 {
-    qDBusRegisterMetaType<QVariantMapList>();
+    Q_UNUSED(type)
+}
 
-    d->m_type = type;
-    d->m_watcher = new QDBusPendingCallWatcher(call, this);
+PendingCall::PendingCall(PendingCall::Error error, const QString &errorText, QObject *parent)
+    : PendingCall(new PendingCallPrivate(this), error, errorText, parent)
+{
+}
 
-    connect(d->m_watcher, &QDBusPendingCallWatcher::finished, d, &PendingCallPrivate::pendingCallFinished);
+PendingCall::PendingCall(PendingCallPrivate *dd, QObject *parent)
+    : QObject(parent)
+    , d(dd)
+{
+    // Started later with CallSchedulerPrivate::scheduleCall()
+    d->q = this;
+    d->m_queued = true;
 }
 
-PendingCall::PendingCall(PendingCall::Error error, const QString &errorText, QObject *parent)
+PendingCall::PendingCall(PendingCallPrivate *dd, const QDBusPendingCall &call, QObject *parent)
+    : QObject(parent)
+    , d(dd)
+{
+    d->startCall(call);
+}
+
+PendingCall::PendingCall(ReturnType type, QObject *parent)
     : QObject(parent)
     , d(new PendingCallPrivate(this))
+{
+    Q_UNUSED(type)
+
+    d->m_queued = true;
+}
+
+PendingCall::PendingCall(PendingCallPrivate *dd, PendingCall::Error error, const QString &errorText, QObject *parent)
+    : QObject(parent)
+    , d(dd)
 {
     d->m_error = error;
     d->m_errorText = errorText;
 
-    QTimer *timer = new QTimer(this);
-    timer->setSingleShot(true);
-    timer->start(0);
-    connect(timer, &QTimer::timeout, d, &PendingCallPrivate::emitDelayedFinished);
+    QMetaObject::invokeMethod(this, "emitDelayedFinished", Qt::QueuedConnection);
 }
 
 PendingCall::~PendingCall()
@@ -267,15 +284,16 @@ PendingCall::~PendingCall()
 
 QVariant PendingCall::value() const
 {
-    if (d->m_value.isEmpty()) {
-        return QVariant();
-    }
-    return d->m_value.first();
+    return d->value();
 }
 
 QVariantList PendingCall::values() const
 {
-    return d->m_value;
+    const QVariant &value = d->value();
+    if (!value.isValid()) {
+        return QVariantList();
+    }
+    return QVariantList() << value;
 }
 
 int PendingCall::error() const
@@ -293,11 +311,65 @@ bool PendingCall::isFinished() const
     if (d->m_watcher) {
         return d->m_watcher->isFinished();
     }
-    return true;
+    return !d->m_queued || d->m_done;
+}
+
+int PendingCall::timeout() const
+{
+    return d->m_timeout;
+}
+
+void PendingCall::setTimeout(int msecs)
+{
+    if (d->m_done) {
+        return;
+    }
+
+    d->m_timeout = msecs;
+
+    if (msecs < 0) {
+        if (d->m_timer) {
+            d->m_timer->stop();
+        }
+        return;
+    }
+
+    if (!d->m_timer) {
+        d->m_timer = new QTimer(this);
+        d->m_timer->setSingleShot(true);
+        connect(d->m_timer, &QTimer::timeout, this, [this]() {
+            d->emitTimedOut();
+        });
+    }
+    d->m_timer->start(msecs);
+}
+
+void PendingCall::cancel()
+{
+    if (d->m_done) {
+        return;
+    }
+
+    d->stopProcessing();
+    d->m_done = true;
+    deleteLater();
+}
+
+void PendingCall::setScope(QObject *scope)
+{
+    if (d->m_done || !scope) {
+        return;
+    }
+
+    connect(scope, &QObject::destroyed, this, &PendingCall::cancel);
 }
 
 void PendingCall::waitForFinished()
 {
+    if (d->m_queued && !d->m_done) {
+        CallSchedulerPrivate::startNow(this);
+    }
+
     if (d->m_watcher) {
         d->m_watcher->waitForFinished();
     }
@@ -314,3 +386,5 @@ void PendingCall::setUserData(const QVariant &userData)
 }
 
 } // namespace BluezQt
+
+#include "moc_pendingcall.cpp"
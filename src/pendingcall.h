@@ -32,6 +32,8 @@ class QDBusPendingCall;
 namespace BluezQt
 {
 
+class PendingCallPrivate;
+
 /**
  * @class BluezQt::PendingCall pendingcall.h <BluezQt/PendingCall>
  *
@@ -39,6 +41,11 @@ namespace BluezQt
  *
  * This class represents a pending method call. It is a convenient wrapper
  * around QDBusPendingReply and QDBusPendingCallWatcher.
+ *
+ * The call is automatically deleted after the finished() signal is emitted.
+ *
+ * A call can be canceled with cancel(), in which case the finished() signal
+ * is not emitted at all.
  */
 class BLUEZQT_EXPORT PendingCall : public QObject
 {
@@ -50,6 +57,7 @@ class BLUEZQT_EXPORT PendingCall : public QObject
     Q_PROPERTY(QString errorText READ errorText)
     Q_PROPERTY(bool isFinished READ isFinished)
     Q_PROPERTY(QVariant userData READ userData WRITE setUserData)
+    Q_PROPERTY(int timeout READ timeout WRITE setTimeout)
 
 public:
     /**
@@ -96,6 +104,8 @@ public:
         AuthenticationTimeout = 18,
         /** Indicates that the connection attempt have failed. */
         ConnectionAttemptFailed = 19,
+        /** Indicates that the call have timed out. */
+        TimedOut = 20,
         /** Indicates an error with D-Bus. */
         DBusError = 98,
         /** Indicates an internal error. */
@@ -146,6 +156,46 @@ public:
      */
     bool isFinished() const;
 
+    /**
+     * Returns the timeout of the call.
+     *
+     * @return timeout in milliseconds, -1 if no timeout was set
+     */
+    int timeout() const;
+
+    /**
+     * Sets the timeout of the call.
+     *
+     * If the call does not finish within the timeout (counted from now),
+     * it finishes with TimedOut error and its reply is ignored.
+     *
+     * This is in addition to the D-Bus timeout used when sending the call,
+     * see eg. Device::setCallTimeout().
+     *
+     * @param msecs timeout in milliseconds, -1 to disable the timeout
+     */
+    void setTimeout(int msecs);
+
+    /**
+     * Cancels the call.
+     *
+     * The reply of the call will not be processed, the finished() signal
+     * will not be emitted and the call is deleted.
+     *
+     * Canceling does not undo the action if the remote side already received the call.
+     */
+    void cancel();
+
+    /**
+     * Binds the call to a scope object.
+     *
+     * When the scope object is destroyed before the call finishes,
+     * the call is canceled.
+     *
+     * @param scope scope object
+     */
+    void setScope(QObject *scope);
+
     /**
      * Waits for the call to finish.
      *
@@ -174,25 +224,32 @@ Q_SIGNALS:
     void finished(PendingCall *call);
 
 private:
+    // Calls with return values are created as PendingReply
     enum ReturnType {
-        ReturnVoid,
-        ReturnUint32,
-        ReturnString,
-        ReturnObjectPath,
-        ReturnFileTransferList,
-        ReturnTransferWithProperties
+        ReturnVoid
     };
 
     explicit PendingCall(const QDBusPendingCall &call, ReturnType type, QObject *parent = nullptr);
     explicit PendingCall(Error error, const QString &errorText, QObject *parent = nullptr);
+    explicit PendingCall(ReturnType type, QObject *parent);
+    explicit PendingCall(PendingCallPrivate *dd, const QDBusPendingCall &call, QObject *parent);
+    explicit PendingCall(PendingCallPrivate *dd, QObject *parent);
+    explicit PendingCall(PendingCallPrivate *dd, Error error, const QString &errorText, QObject *parent);
 
     class PendingCallPrivate *const d;
 
+    Q_PRIVATE_SLOT(d, void emitDelayedFinished())
+
     friend class PendingCallPrivate;
+    friend class CallSchedulerPrivate;
+    template<typename T> friend class PendingReply;
     friend class Manager;
     friend class Adapter;
     friend class Device;
     friend class MediaPlayer;
+    friend class GattCharacteristic;
+    friend class GattDescriptor;
+    friend class GattWriteStream;
     friend class ObexManager;
     friend class ObexTransfer;
     friend class ObexSession;
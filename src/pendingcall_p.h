@@ -0,0 +1,98 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PENDINGCALL_P_H
+#define BLUEZQT_PENDINGCALL_P_H
+
+#include <functional>
+
+#include <QVariant>
+#include <QPointer>
+#include <QDBusError>
+#include <QDBusPendingCallWatcher>
+#include <QDBusUnixFileDescriptor>
+#include <QTimer>
+
+#include "pendingcall.h"
+#include "types.h"
+#include "bluezqt_dbustypes.h"
+
+namespace BluezQt
+{
+
+class CallScheduler;
+
+class PendingCallPrivate
+{
+public:
+    explicit PendingCallPrivate(PendingCall *parent);
+    virtual ~PendingCallPrivate();
+
+    // Reimplemented by PendingReplyPrivate to store the typed result
+    virtual void processReply(QDBusPendingCallWatcher *call);
+    virtual QVariant value() const;
+
+    void startCall(const QDBusPendingCall &call);
+    void processError(const QDBusError &error);
+
+    void emitFinished();
+    void emitDelayedFinished();
+    void emitInternalError(const QString &errorText);
+    void emitTimedOut();
+    void pendingCallFinished(QDBusPendingCallWatcher *watcher);
+    void stopProcessing();
+
+    static QList<ObexFileTransferEntry> fileTransferList(const QVariantMapList &list);
+    static ObexTransferPtr transferWithProperties(const QDBusObjectPath &path, const QVariantMap &properties);
+
+    PendingCall *q;
+    int m_error;
+    QString m_errorText;
+    QVariant m_userData;
+    QDBusPendingCallWatcher *m_watcher;
+    QTimer *m_timer;
+    int m_timeout;
+    bool m_done;
+
+    // Deferred calls are queued in scheduler until started
+    bool m_queued;
+    QPointer<CallScheduler> m_scheduler;
+};
+
+// Call acquiring a socket (eg. AcquireNotify), the reply is (fd, mtu)
+class AcquireCallPrivate : public PendingCallPrivate
+{
+public:
+    // Takes the socket, returns error text if it cannot be used
+    typedef std::function<QString(const QDBusUnixFileDescriptor &fd, quint16 mtu)> SocketHandler;
+
+    explicit AcquireCallPrivate(QObject *owner, const SocketHandler &handler);
+
+    void processReply(QDBusPendingCallWatcher *call) override;
+
+    QPointer<QObject> m_owner;
+    SocketHandler m_handler;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PENDINGCALL_P_H
@@ -0,0 +1,129 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pendingreply.h"
+#include "pendingcall_p.h"
+#include "obextransfer.h"
+#include "obexfiletransferentry.h"
+
+#include <QDBusObjectPath>
+#include <QDBusPendingReply>
+
+namespace BluezQt
+{
+
+template<typename T>
+class PendingReplyPrivate : public PendingCallPrivate
+{
+public:
+    explicit PendingReplyPrivate(PendingCall *parent);
+
+    void processReply(QDBusPendingCallWatcher *call) override;
+    QVariant value() const override;
+
+    T m_result;
+    bool m_hasResult;
+};
+
+template<typename T>
+PendingReplyPrivate<T>::PendingReplyPrivate(PendingCall *parent)
+    : PendingCallPrivate(parent)
+    , m_result()
+    , m_hasResult(false)
+{
+}
+
+template<typename T>
+void PendingReplyPrivate<T>::processReply(QDBusPendingCallWatcher *call)
+{
+    const QDBusPendingReply<T> reply = *call;
+    processError(reply.error());
+    if (!reply.isError()) {
+        m_result = reply.value();
+        m_hasResult = true;
+    }
+}
+
+template<>
+void PendingReplyPrivate<QList<ObexFileTransferEntry> >::processReply(QDBusPendingCallWatcher *call)
+{
+    const QDBusPendingReply<QVariantMapList> reply = *call;
+    processError(reply.error());
+    if (!reply.isError()) {
+        m_result = fileTransferList(reply.value());
+        m_hasResult = true;
+    }
+}
+
+template<>
+void PendingReplyPrivate<ObexTransferPtr>::processReply(QDBusPendingCallWatcher *call)
+{
+    const QDBusPendingReply<QDBusObjectPath, QVariantMap> reply = *call;
+    processError(reply.error());
+    if (!reply.isError()) {
+        m_result = transferWithProperties(reply.argumentAt<0>(), reply.argumentAt<1>());
+        m_hasResult = true;
+    }
+}
+
+template<typename T>
+QVariant PendingReplyPrivate<T>::value() const
+{
+    // Only converted to QVariant when requested through PendingCall API
+    if (!m_hasResult) {
+        return QVariant();
+    }
+    return QVariant::fromValue(m_result);
+}
+
+template<typename T>
+PendingReply<T>::PendingReply(const QDBusPendingCall &call, QObject *parent)
+    : PendingCall(new PendingReplyPrivate<T>(this), call, parent)
+{
+}
+
+template<typename T>
+PendingReply<T>::PendingReply(QObject *parent)
+    : PendingCall(new PendingReplyPrivate<T>(this), parent)
+{
+}
+
+template<typename T>
+PendingReply<T>::PendingReply(Error error, const QString &errorText, QObject *parent)
+    : PendingCall(new PendingReplyPrivate<T>(this), error, errorText, parent)
+{
+}
+
+template<typename T>
+T PendingReply<T>::result() const
+{
+    return static_cast<PendingReplyPrivate<T>*>(d)->m_result;
+}
+
+template class PendingReply<quint32>;
+template class PendingReply<QString>;
+template class PendingReply<QByteArray>;
+template class PendingReply<QDBusObjectPath>;
+template class PendingReply<QList<ObexFileTransferEntry> >;
+template class PendingReply<ObexTransferPtr>;
+
+} // namespace BluezQt
@@ -0,0 +1,90 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PENDINGREPLY_H
+#define BLUEZQT_PENDINGREPLY_H
+
+#include "pendingcall.h"
+#include "types.h"
+#include "bluezqt_export.h"
+
+class QDBusObjectPath;
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::PendingReply pendingreply.h <BluezQt/PendingReply>
+ *
+ * Pending method call with typed result.
+ *
+ * This class represents a pending method call that returns a value.
+ * The value is stored with its concrete type and can be accessed with result()
+ * without any conversion through QVariant.
+ *
+ * PendingReply is a PendingCall, so it can be used everywhere a PendingCall is
+ * expected and PendingCall::value() still returns the result as QVariant.
+ *
+ * Example use:
+ * @code
+ * BluezQt::PendingReply<quint32> *call = BluezQt::Manager::startService();
+ * connect(call, &BluezQt::PendingCall::finished, this, [call]() {
+ *     if (!call->error()) {
+ *         qDebug() << "startService:" << call->result();
+ *     }
+ * });
+ * @endcode
+ *
+ * @note PendingReply is available for quint32, QString, QByteArray, QDBusObjectPath,
+ *       QList<ObexFileTransferEntry> and ObexTransferPtr result types.
+ */
+template<typename T>
+class BLUEZQT_EXPORT PendingReply : public PendingCall
+{
+public:
+    /**
+     * Returns the result of the call.
+     *
+     * Returns default constructed value if the call is not finished yet
+     * or it finished with error.
+     *
+     * @return result of the call
+     */
+    T result() const;
+
+private:
+    explicit PendingReply(const QDBusPendingCall &call, QObject *parent = nullptr);
+    explicit PendingReply(QObject *parent);
+    explicit PendingReply(Error error, const QString &errorText, QObject *parent = nullptr);
+
+    friend class Manager;
+    friend class GattCharacteristic;
+    friend class GattDescriptor;
+    friend class ObexManager;
+    friend class ObexSession;
+    friend class ObexObjectPush;
+    friend class ObexFileTransfer;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PENDINGREPLY_H
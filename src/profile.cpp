@@ -122,6 +122,16 @@ void Profile::setFeatures(quint16 features)
     d->options[QStringLiteral("Features")] = QVariant::fromValue(features);
 }
 
+ProfileDispatcher *Profile::dispatcher() const
+{
+    return d->dispatcher;
+}
+
+void Profile::setDispatcher(ProfileDispatcher *dispatcher)
+{
+    d->dispatcher = dispatcher;
+}
+
 QSharedPointer<QLocalSocket> Profile::createSocket(const QDBusUnixFileDescriptor &fd)
 {
     int newfd = ::dup(fd.fileDescriptor());
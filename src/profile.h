@@ -37,6 +37,7 @@ namespace BluezQt
 {
 
 class Device;
+class ProfileDispatcher;
 
 /**
  * @class BluezQt::Profile profile.h <BluezQt/Profile>
@@ -201,6 +202,30 @@ public:
      */
     void setFeatures(quint16 features);
 
+    /**
+     * Returns the dispatcher of connections.
+     *
+     * @return dispatcher, null if connections are handled in the thread of Manager
+     */
+    ProfileDispatcher *dispatcher() const;
+
+    /**
+     * Sets the dispatcher of connections.
+     *
+     * With a dispatcher, newConnection() and requestDisconnection() are called
+     * in its worker threads. The profile does not take ownership of the dispatcher,
+     * the dispatcher should be destroyed before the profile.
+     *
+     * @note The DevicePtr passed to newConnection() and requestDisconnection() in a worker
+     *       thread belongs to the thread of Manager, which keeps updating it. Its properties
+     *       must not be read from the worker thread without synchronization, use it only
+     *       to identify the device.
+     *
+     * @param dispatcher dispatcher, null to handle connections in the thread of Manager
+     * @see ProfileDispatcher
+     */
+    void setDispatcher(ProfileDispatcher *dispatcher);
+
     /**
      * Creates a socket from file descriptor.
      *
@@ -23,8 +23,11 @@
 #ifndef BLUEZQT_PROFILE_P_H
 #define BLUEZQT_PROFILE_P_H
 
+#include <QPointer>
 #include <QVariantMap>
 
+#include "profiledispatcher.h"
+
 namespace BluezQt
 {
 
@@ -32,6 +35,7 @@ class ProfilePrivate
 {
 public:
     QVariantMap options;
+    QPointer<ProfileDispatcher> dispatcher;
 };
 
 } // namepsace BluezQt
@@ -22,9 +22,12 @@
 
 #include "profileadaptor.h"
 #include "profile.h"
+#include "profiledispatcher.h"
+#include "profiledispatcher_p.h"
 #include "manager.h"
 #include "device.h"
 
+#include <QPointer>
 #include <QDBusMessage>
 #include <QDBusObjectPath>
 #include <QDBusUnixFileDescriptor>
@@ -50,6 +53,22 @@ void ProfileAdaptor::NewConnection(const QDBusObjectPath &device, const QDBusUni
         return;
     }
 
+    ProfileDispatcher *dispatcher = m_profile->dispatcher();
+    if (dispatcher) {
+        // Profile may be deleted before the worker thread gets to the call
+        QPointer<Profile> profile = m_profile;
+        dispatcher->d->dispatchConnection(dev, [profile, dev, fd, properties, req]() {
+            if (!profile) {
+                req.cancel();
+                return;
+            }
+            profile->newConnection(dev, fd, properties, req);
+        }, [req]() {
+            req.cancel();
+        });
+        return;
+    }
+
     m_profile->newConnection(dev, fd, properties, req);
 }
 
@@ -64,6 +83,21 @@ void ProfileAdaptor::RequestDisconnection(const QDBusObjectPath &device, const Q
         return;
     }
 
+    ProfileDispatcher *dispatcher = m_profile->dispatcher();
+    if (dispatcher) {
+        QPointer<Profile> profile = m_profile;
+        dispatcher->d->dispatchDisconnection(device.path(), [profile, dev, req]() {
+            if (!profile) {
+                req.cancel();
+                return;
+            }
+            profile->requestDisconnection(dev, req);
+        }, [req]() {
+            req.cancel();
+        });
+        return;
+    }
+
     m_profile->requestDisconnection(dev, req);
 }
 
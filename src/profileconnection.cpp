@@ -0,0 +1,521 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profileconnection.h"
+#include "profileconnection_p.h"
+#include "debug.h"
+
+#ifdef BLUEZQT_HAVE_IO_URING
+#include "profileconnectionuring_p.h"
+#endif
+
+#include <QTimer>
+#include <QSocketNotifier>
+#include <QDBusUnixFileDescriptor>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace BluezQt
+{
+
+// Maximum number of buffers in one writev() call
+static const int MaxIovecs = 64;
+
+static const qint64 DefaultHighWatermark = 256 * 1024;
+static const qint64 DefaultLowWatermark = 64 * 1024;
+
+ProfileConnectionPrivate::ProfileConnectionPrivate(ProfileConnection *q)
+    : QObject()
+    , q(q)
+    , m_fd(-1)
+    , m_packetBased(false)
+    , m_readNotifier(nullptr)
+    , m_writeNotifier(nullptr)
+    , m_uring(nullptr)
+    , m_queued(0)
+    , m_highWatermark(DefaultHighWatermark)
+    , m_lowWatermark(DefaultLowWatermark)
+    , m_aboveWatermark(false)
+    , m_totalRead(0)
+    , m_totalWritten(0)
+    , m_latencySum(0)
+    , m_latencyCount(0)
+    , m_latencyMax(0)
+{
+    m_clock.start();
+}
+
+void ProfileConnectionPrivate::readActivated()
+{
+    // Emitted again only after the data are read with read()
+    m_readNotifier->setEnabled(false);
+
+    char c;
+    const ssize_t ret = ::recv(m_fd, &c, sizeof(c), MSG_PEEK | MSG_DONTWAIT);
+
+    if (ret == 0 || (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+        handleDisconnect();
+        return;
+    }
+    if (ret < 0) {
+        m_readNotifier->setEnabled(true);
+        return;
+    }
+
+    Q_EMIT q->readyRead();
+}
+
+void ProfileConnectionPrivate::writeActivated()
+{
+    const qint64 written = flush();
+    if (written > 0) {
+        Q_EMIT q->bytesWritten(written);
+    }
+}
+
+qint64 ProfileConnectionPrivate::flush()
+{
+    qint64 written = 0;
+
+    while (!m_queue.isEmpty()) {
+        struct iovec iov[MaxIovecs];
+        int count = 0;
+
+        for (int i = 0; i < m_queue.size() && count < MaxIovecs; ++i) {
+            const Segment &segment = m_queue.at(i);
+            iov[count].iov_base = const_cast<char*>(segment.data.constData()) + segment.offset;
+            iov[count].iov_len = segment.data.size() - segment.offset;
+            count++;
+
+            // One write() call is one packet
+            if (m_packetBased && segment.last) {
+                break;
+            }
+        }
+
+        // Same as writev(), but a closed peer fails the write instead of raising SIGPIPE
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = size_t(count);
+
+        const ssize_t ret = ::sendmsg(m_fd, &msg, MSG_NOSIGNAL);
+
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        if (ret < 0) {
+            qCWarning(BLUEZQT) << "ProfileConnection: Write failed:" << strerror(errno);
+            handleDisconnect();
+            return -1;
+        }
+
+        written += ret;
+        consumeWritten(ret);
+    }
+
+    m_writeNotifier->setEnabled(!m_queue.isEmpty());
+    updateWatermark();
+
+    return written;
+}
+
+void ProfileConnectionPrivate::consumeWritten(qint64 bytes)
+{
+    m_queued -= bytes;
+    m_totalWritten += bytes;
+
+    while (bytes > 0) {
+        Segment &segment = m_queue.head();
+        const int size = segment.data.size() - segment.offset;
+
+        if (bytes < size) {
+            segment.offset += int(bytes);
+            break;
+        }
+
+        bytes -= size;
+        if (segment.last) {
+            const qint64 latency = (m_clock.nsecsElapsed() - segment.time) / 1000;
+            m_latencySum += latency;
+            m_latencyCount++;
+            m_latencyMax = qMax(m_latencyMax, latency);
+        }
+        m_queue.dequeue();
+    }
+}
+
+void ProfileConnectionPrivate::updateWatermark()
+{
+    if (!m_aboveWatermark && m_queued >= m_highWatermark) {
+        m_aboveWatermark = true;
+        Q_EMIT q->highWatermarkReached();
+    } else if (m_aboveWatermark && m_queued <= m_lowWatermark) {
+        m_aboveWatermark = false;
+        Q_EMIT q->lowWatermarkReached();
+    }
+}
+
+void ProfileConnectionPrivate::closeSocket()
+{
+    if (m_fd == -1) {
+        return;
+    }
+
+#ifdef BLUEZQT_HAVE_IO_URING
+    if (m_uring) {
+        m_uring->stop();
+        m_uring->deleteLater();
+        m_uring = nullptr;
+    }
+#endif
+
+    m_readNotifier->setEnabled(false);
+    m_readNotifier->deleteLater();
+    m_readNotifier = nullptr;
+
+    m_writeNotifier->setEnabled(false);
+    m_writeNotifier->deleteLater();
+    m_writeNotifier = nullptr;
+
+    ::close(m_fd);
+    m_fd = -1;
+
+    m_queue.clear();
+    m_queued = 0;
+    m_aboveWatermark = false;
+}
+
+void ProfileConnectionPrivate::handleDisconnect()
+{
+    closeSocket();
+
+    // Emitted later, so slots deleting the connection do not free it inside read() or write()
+    QTimer::singleShot(0, this, [this]() {
+        Q_EMIT q->disconnected();
+    });
+}
+
+bool ProfileConnectionPrivate::setBlocking(bool blocking)
+{
+    const int flags = ::fcntl(m_fd, F_GETFL);
+    if (flags < 0) {
+        return false;
+    }
+    return ::fcntl(m_fd, F_SETFL, blocking ? flags & ~O_NONBLOCK : flags | O_NONBLOCK) == 0;
+}
+
+ProfileConnection::ProfileConnection(const QDBusUnixFileDescriptor &fd, QObject *parent)
+    : QObject(parent)
+    , d(new ProfileConnectionPrivate(this))
+{
+    if (!fd.isValid()) {
+        return;
+    }
+
+    d->m_fd = ::fcntl(fd.fileDescriptor(), F_DUPFD_CLOEXEC, 0);
+    if (d->m_fd < 0 || !d->setBlocking(false)) {
+        qCWarning(BLUEZQT) << "ProfileConnection: Invalid socket";
+        if (d->m_fd >= 0) {
+            ::close(d->m_fd);
+        }
+        d->m_fd = -1;
+        return;
+    }
+
+    int type = 0;
+    socklen_t length = sizeof(type);
+    if (::getsockopt(d->m_fd, SOL_SOCKET, SO_TYPE, &type, &length) == 0) {
+        d->m_packetBased = type == SOCK_SEQPACKET;
+    }
+
+    d->m_readNotifier = new QSocketNotifier(d->m_fd, QSocketNotifier::Read, d);
+    connect(d->m_readNotifier, &QSocketNotifier::activated, d, &ProfileConnectionPrivate::readActivated);
+
+    // Only enabled while data are queued
+    d->m_writeNotifier = new QSocketNotifier(d->m_fd, QSocketNotifier::Write, d);
+    d->m_writeNotifier->setEnabled(false);
+    connect(d->m_writeNotifier, &QSocketNotifier::activated, d, &ProfileConnectionPrivate::writeActivated);
+}
+
+ProfileConnection::~ProfileConnection()
+{
+    d->closeSocket();
+    delete d;
+}
+
+bool ProfileConnection::isOpen() const
+{
+    return d->m_fd != -1;
+}
+
+int ProfileConnection::socketDescriptor() const
+{
+    return d->m_fd;
+}
+
+bool ProfileConnection::isPacketBased() const
+{
+    return d->m_packetBased;
+}
+
+void ProfileConnection::close()
+{
+    d->closeSocket();
+}
+
+ProfileConnection::Backend ProfileConnection::backend() const
+{
+    return d->m_uring ? IoUringBackend : NotifierBackend;
+}
+
+bool ProfileConnection::setBackend(Backend backend)
+{
+    if (!isOpen()) {
+        return false;
+    }
+
+    if (backend == this->backend()) {
+        return true;
+    }
+
+#ifdef BLUEZQT_HAVE_IO_URING
+    if (backend == IoUringBackend) {
+        if (!ProfileConnectionUring::isSupported()) {
+            return false;
+        }
+
+        // io_uring waits for the socket itself, so the socket is switched to blocking mode
+        d->m_readNotifier->setEnabled(false);
+        d->m_writeNotifier->setEnabled(false);
+        d->setBlocking(true);
+
+        d->m_uring = new ProfileConnectionUring(d);
+        if (!d->m_uring->start()) {
+            delete d->m_uring;
+            d->m_uring = nullptr;
+            d->setBlocking(false);
+            d->m_readNotifier->setEnabled(true);
+            d->m_writeNotifier->setEnabled(!d->m_queue.isEmpty());
+            return false;
+        }
+        return true;
+    }
+
+    // Received data and in-flight writes cannot be moved to the notifier
+    if (!d->m_uring->isIdle()) {
+        return false;
+    }
+
+    d->m_uring->stop();
+    d->m_uring->deleteLater();
+    d->m_uring = nullptr;
+
+    d->setBlocking(false);
+    d->m_readNotifier->setEnabled(true);
+    d->m_writeNotifier->setEnabled(!d->m_queue.isEmpty());
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ProfileConnection::isIoUringSupported()
+{
+#ifdef BLUEZQT_HAVE_IO_URING
+    return ProfileConnectionUring::isSupported();
+#else
+    return false;
+#endif
+}
+
+qint64 ProfileConnection::read(char *data, qint64 maxSize)
+{
+    if (!isOpen()) {
+        return -1;
+    }
+
+#ifdef BLUEZQT_HAVE_IO_URING
+    if (d->m_uring) {
+        const qint64 ret = d->m_uring->read(data, maxSize);
+        if (ret < 0) {
+            d->handleDisconnect();
+            return -1;
+        }
+        d->m_totalRead += ret;
+        return ret;
+    }
+#endif
+
+    Q_FOREVER {
+        const ssize_t ret = ::recv(d->m_fd, data, size_t(maxSize), MSG_DONTWAIT);
+
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            d->m_readNotifier->setEnabled(true);
+            return 0;
+        }
+        if (ret == 0 && maxSize > 0) {
+            d->handleDisconnect();
+            return -1;
+        }
+        if (ret < 0) {
+            qCWarning(BLUEZQT) << "ProfileConnection: Read failed:" << strerror(errno);
+            d->handleDisconnect();
+            return -1;
+        }
+
+        d->m_totalRead += ret;
+        d->m_readNotifier->setEnabled(true);
+        return ret;
+    }
+}
+
+qint64 ProfileConnection::write(const QByteArray &data)
+{
+    return write(QList<QByteArray>() << data);
+}
+
+qint64 ProfileConnection::write(const QList<QByteArray> &buffers)
+{
+    if (!isOpen()) {
+        return -1;
+    }
+
+    const qint64 now = d->m_clock.nsecsElapsed();
+    qint64 size = 0;
+    int count = 0;
+
+    Q_FOREACH (const QByteArray &buffer, buffers) {
+        size += buffer.size();
+        count += buffer.isEmpty() ? 0 : 1;
+    }
+
+    if (size == 0) {
+        return 0;
+    }
+
+    if (d->m_packetBased && count > MaxIovecs) {
+        // Packet must be sent with one writev(), so too many buffers are joined into one
+        QByteArray packet;
+        packet.reserve(int(size));
+        Q_FOREACH (const QByteArray &buffer, buffers) {
+            packet.append(buffer);
+        }
+        d->m_queue.enqueue({packet, 0, false, now});
+    } else {
+        // Buffers are shared with the caller, not copied
+        Q_FOREACH (const QByteArray &buffer, buffers) {
+            if (!buffer.isEmpty()) {
+                d->m_queue.enqueue({buffer, 0, false, now});
+            }
+        }
+    }
+
+    d->m_queue.last().last = true;
+    d->m_queued += size;
+
+#ifdef BLUEZQT_HAVE_IO_URING
+    if (d->m_uring) {
+        d->updateWatermark();
+        d->m_uring->scheduleSubmit();
+        return size;
+    }
+#endif
+
+    // Written right away unless older data are still waiting for the socket
+    if (!d->m_writeNotifier->isEnabled()) {
+        if (d->flush() < 0) {
+            return -1;
+        }
+    } else {
+        d->updateWatermark();
+    }
+
+    return size;
+}
+
+qint64 ProfileConnection::bytesToWrite() const
+{
+    return d->m_queued;
+}
+
+qint64 ProfileConnection::highWatermark() const
+{
+    return d->m_highWatermark;
+}
+
+void ProfileConnection::setHighWatermark(qint64 size)
+{
+    d->m_highWatermark = size;
+}
+
+qint64 ProfileConnection::lowWatermark() const
+{
+    return d->m_lowWatermark;
+}
+
+void ProfileConnection::setLowWatermark(qint64 size)
+{
+    d->m_lowWatermark = size;
+}
+
+qint64 ProfileConnection::totalBytesRead() const
+{
+    return d->m_totalRead;
+}
+
+qint64 ProfileConnection::totalBytesWritten() const
+{
+    return d->m_totalWritten;
+}
+
+qint64 ProfileConnection::averageWriteLatency() const
+{
+    return d->m_latencyCount ? d->m_latencySum / d->m_latencyCount : 0;
+}
+
+qint64 ProfileConnection::maximumWriteLatency() const
+{
+    return d->m_latencyMax;
+}
+
+void ProfileConnection::resetStatistics()
+{
+    d->m_totalRead = 0;
+    d->m_totalWritten = 0;
+    d->m_latencySum = 0;
+    d->m_latencyCount = 0;
+    d->m_latencyMax = 0;
+}
+
+} // namespace BluezQt
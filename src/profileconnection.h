@@ -0,0 +1,325 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PROFILECONNECTION_H
+#define BLUEZQT_PROFILECONNECTION_H
+
+#include <QObject>
+
+#include "bluezqt_export.h"
+
+class QDBusUnixFileDescriptor;
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::ProfileConnection profileconnection.h <BluezQt/ProfileConnection>
+ *
+ * Profile connection.
+ *
+ * This class wraps the RFCOMM or L2CAP socket passed to Profile::newConnection()
+ * and does non-blocking I/O directly on it.
+ *
+ * Reading is done with read() into a buffer supplied by the caller, without any
+ * intermediate buffering. The readyRead() signal is emitted when data are available
+ * and it is not emitted again until read() is called.
+ *
+ * Writing is done with write(), which writes as much data as possible right away
+ * and queues the rest. Queued buffers are shared, not copied, and multiple buffers
+ * are written with a single writev() call. On SOCK_SEQPACKET (L2CAP) sockets, each
+ * write() call is sent as one packet.
+ *
+ * The write queue has high and low watermarks. highWatermarkReached() is emitted when
+ * queued data reach the high watermark, the writer should then stop writing until
+ * lowWatermarkReached() is emitted.
+ *
+ * On Linux, the connection can optionally use io_uring instead of the socket notifiers,
+ * see setBackend(). Data are then received into buffers registered with the kernel using
+ * multishot receive, and all writes done in one event loop iteration are submitted together.
+ * This saves system calls with many small frames.
+ *
+ * The backends only apply to ProfileConnection. Sockets acquired with
+ * GattCharacteristic::acquireNotify() and GattWriteStream always use socket notifiers.
+ *
+ * Example use:
+ * @code
+ * void MyProfile::newConnection(BluezQt::DevicePtr device, const QDBusUnixFileDescriptor &fd, const QVariantMap &properties, const BluezQt::Request<> &request)
+ * {
+ *     m_connection = new BluezQt::ProfileConnection(fd, this);
+ *     connect(m_connection, &BluezQt::ProfileConnection::readyRead, this, &MyProfile::readData);
+ *     request.accept();
+ * }
+ * @endcode
+ */
+class BLUEZQT_EXPORT ProfileConnection : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(bool open READ isOpen)
+    Q_PROPERTY(Backend backend READ backend)
+    Q_PROPERTY(qint64 bytesToWrite READ bytesToWrite)
+    Q_PROPERTY(qint64 highWatermark READ highWatermark WRITE setHighWatermark)
+    Q_PROPERTY(qint64 lowWatermark READ lowWatermark WRITE setLowWatermark)
+    Q_PROPERTY(qint64 totalBytesRead READ totalBytesRead)
+    Q_PROPERTY(qint64 totalBytesWritten READ totalBytesWritten)
+    Q_PROPERTY(qint64 averageWriteLatency READ averageWriteLatency)
+    Q_PROPERTY(qint64 maximumWriteLatency READ maximumWriteLatency)
+
+public:
+    /** I/O backend of the connection. */
+    enum Backend {
+        /** Non-blocking system calls driven by socket notifiers. */
+        NotifierBackend,
+        /** Submission and completion queues of io_uring. */
+        IoUringBackend
+    };
+    Q_ENUM(Backend)
+
+    /**
+     * Creates a new ProfileConnection object.
+     *
+     * The file descriptor is duplicated and switched to non-blocking mode.
+     *
+     * @param fd socket file descriptor
+     * @param parent
+     */
+    explicit ProfileConnection(const QDBusUnixFileDescriptor &fd, QObject *parent = nullptr);
+
+    /**
+     * Destroys a ProfileConnection object.
+     *
+     * The socket is closed and queued data are discarded.
+     */
+    ~ProfileConnection();
+
+    /**
+     * Returns whether the connection is open.
+     *
+     * @return true if connection is open
+     */
+    bool isOpen() const;
+
+    /**
+     * Returns the socket descriptor of the connection.
+     *
+     * @return socket descriptor, -1 if connection is closed
+     */
+    int socketDescriptor() const;
+
+    /**
+     * Returns whether the socket preserves message boundaries (SOCK_SEQPACKET).
+     *
+     * @return true if socket is packet based
+     */
+    bool isPacketBased() const;
+
+    /**
+     * Closes the connection.
+     *
+     * Queued data are discarded. The disconnected() signal is not emitted.
+     */
+    void close();
+
+    /**
+     * Returns the I/O backend of the connection.
+     *
+     * Default backend is NotifierBackend.
+     *
+     * @return backend
+     */
+    Backend backend() const;
+
+    /**
+     * Sets the I/O backend of the connection.
+     *
+     * It should be called right after creating the connection. Switching back
+     * to NotifierBackend fails while there are unread received data or writes
+     * in progress.
+     *
+     * When io_uring is not supported by the system, the connection keeps
+     * using NotifierBackend.
+     *
+     * @param backend backend
+     * @return true if the backend is used
+     * @see isIoUringSupported()
+     */
+    bool setBackend(Backend backend);
+
+    /**
+     * Returns whether IoUringBackend is supported.
+     *
+     * It needs BluezQt built with liburing and Linux 6.0 or newer.
+     *
+     * @return true if io_uring is supported
+     */
+    static bool isIoUringSupported();
+
+    /**
+     * Reads data into the buffer.
+     *
+     * On SOCK_SEQPACKET sockets, one read returns at most one packet and
+     * the rest of the packet is discarded if the buffer is too small.
+     *
+     * @param data buffer to read into
+     * @param maxSize size of the buffer
+     * @return number of bytes read, 0 if no data are available, -1 if connection is closed
+     */
+    qint64 read(char *data, qint64 maxSize);
+
+    /**
+     * Writes data.
+     *
+     * @param data data to write
+     * @return number of accepted bytes, -1 if connection is closed or writing failed
+     */
+    qint64 write(const QByteArray &data);
+
+    /**
+     * Writes multiple buffers.
+     *
+     * The buffers are written as if they were one continuous buffer,
+     * on SOCK_SEQPACKET sockets they are sent as one packet. A packet is sent
+     * with one system call, so more than 64 buffers of one packet are first
+     * copied into a single buffer.
+     *
+     * @param buffers buffers to write
+     * @return number of accepted bytes, -1 if connection is closed or writing failed
+     */
+    qint64 write(const QList<QByteArray> &buffers);
+
+    /**
+     * Returns the number of queued bytes.
+     *
+     * @return number of bytes
+     */
+    qint64 bytesToWrite() const;
+
+    /**
+     * Returns the high watermark of the write queue.
+     *
+     * Default is 256 KiB.
+     *
+     * @return size in bytes
+     */
+    qint64 highWatermark() const;
+
+    /**
+     * Sets the high watermark of the write queue.
+     *
+     * @param size size in bytes
+     */
+    void setHighWatermark(qint64 size);
+
+    /**
+     * Returns the low watermark of the write queue.
+     *
+     * Default is 64 KiB.
+     *
+     * @return size in bytes
+     */
+    qint64 lowWatermark() const;
+
+    /**
+     * Sets the low watermark of the write queue.
+     *
+     * @param size size in bytes
+     */
+    void setLowWatermark(qint64 size);
+
+    /**
+     * Returns the number of bytes read from the socket.
+     *
+     * @return number of bytes
+     */
+    qint64 totalBytesRead() const;
+
+    /**
+     * Returns the number of bytes written to the socket.
+     *
+     * @return number of bytes
+     */
+    qint64 totalBytesWritten() const;
+
+    /**
+     * Returns the average write latency.
+     *
+     * The latency is the time between write() and the moment when all its data
+     * were written to the socket.
+     *
+     * @return latency in microseconds
+     */
+    qint64 averageWriteLatency() const;
+
+    /**
+     * Returns the maximum write latency.
+     *
+     * @return latency in microseconds
+     * @see averageWriteLatency()
+     */
+    qint64 maximumWriteLatency() const;
+
+    /**
+     * Resets all statistics.
+     */
+    void resetStatistics();
+
+Q_SIGNALS:
+    /**
+     * Indicates that data are available for reading.
+     */
+    void readyRead();
+
+    /**
+     * Indicates that queued data were written to the socket.
+     *
+     * @param bytes number of bytes written
+     */
+    void bytesWritten(qint64 bytes);
+
+    /**
+     * Indicates that queued data reached the high watermark.
+     */
+    void highWatermarkReached();
+
+    /**
+     * Indicates that queued data dropped to the low watermark.
+     */
+    void lowWatermarkReached();
+
+    /**
+     * Indicates that the remote side closed the connection or an I/O error occurred.
+     *
+     * It is emitted from the event loop, never from within read() or write(),
+     * so it is safe to delete the connection in a connected slot.
+     */
+    void disconnected();
+
+private:
+    class ProfileConnectionPrivate *const d;
+
+    friend class ProfileConnectionPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PROFILECONNECTION_H
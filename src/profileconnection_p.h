@@ -0,0 +1,87 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PROFILECONNECTION_P_H
+#define BLUEZQT_PROFILECONNECTION_P_H
+
+#include <QObject>
+#include <QQueue>
+#include <QElapsedTimer>
+
+class QSocketNotifier;
+
+namespace BluezQt
+{
+
+class ProfileConnection;
+class ProfileConnectionUring;
+
+class ProfileConnectionPrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Queued buffer, the last buffer of one write() call has the time of the call
+    struct Segment
+    {
+        QByteArray data;
+        int offset;
+        bool last;
+        qint64 time;
+    };
+
+    explicit ProfileConnectionPrivate(ProfileConnection *q);
+
+    void readActivated();
+    void writeActivated();
+    qint64 flush();
+    void consumeWritten(qint64 bytes);
+    void updateWatermark();
+    void closeSocket();
+    void handleDisconnect();
+    bool setBlocking(bool blocking);
+
+    ProfileConnection *q;
+    int m_fd;
+    bool m_packetBased;
+    QSocketNotifier *m_readNotifier;
+    QSocketNotifier *m_writeNotifier;
+    ProfileConnectionUring *m_uring;
+
+    QQueue<Segment> m_queue;
+    qint64 m_queued;
+    qint64 m_highWatermark;
+    qint64 m_lowWatermark;
+    bool m_aboveWatermark;
+
+    // Statistics
+    QElapsedTimer m_clock;
+    qint64 m_totalRead;
+    qint64 m_totalWritten;
+    qint64 m_latencySum;
+    qint64 m_latencyCount;
+    qint64 m_latencyMax;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PROFILECONNECTION_P_H
@@ -0,0 +1,500 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profileconnectionuring_p.h"
+#include "profileconnection.h"
+#include "profileconnection_p.h"
+#include "debug.h"
+
+#include <QTimer>
+#include <QSocketNotifier>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace BluezQt
+{
+
+static const unsigned QueueDepth = 64;
+static const int BufferGroup = 0;
+
+// Fixed file index of the socket
+static const int SocketIndex = 0;
+
+static const quint64 RecvTag = 1;
+static const quint64 WriteTag = 2;
+static const quint64 CancelTag = 3;
+
+ProfileConnectionUring::ProfileConnectionUring(ProfileConnectionPrivate *d)
+    : QObject(d)
+    , d(d)
+    , m_running(false)
+    , m_bufferRing(nullptr)
+    , m_buffers(nullptr)
+    , m_bufferSize(0)
+    , m_bufferCount(0)
+    , m_eventFd(-1)
+    , m_eventNotifier(nullptr)
+    , m_recvArmed(false)
+    , m_recvStarved(false)
+    , m_eof(false)
+    , m_readyReadPending(false)
+    , m_dataReceived(false)
+    , m_writesInFlight(0)
+    , m_batchWritten(0)
+    , m_submitScheduled(false)
+    , m_failed(false)
+{
+}
+
+ProfileConnectionUring::~ProfileConnectionUring()
+{
+    stop();
+}
+
+bool ProfileConnectionUring::isSupported()
+{
+    // Multishot receive with provided buffers needs Linux 6.0, the only reliable
+    // way to find out is to try it once
+    static const bool supported = []() {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0) {
+            return false;
+        }
+
+        bool ok = false;
+        char buffer[16];
+        struct io_uring ring;
+        if (io_uring_queue_init(4, &ring, 0) == 0) {
+            int ret;
+            struct io_uring_buf_ring *bufferRing = io_uring_setup_buf_ring(&ring, 1, BufferGroup, 0, &ret);
+            if (bufferRing) {
+                io_uring_buf_ring_add(bufferRing, buffer, sizeof(buffer), 0, io_uring_buf_ring_mask(1), 0);
+                io_uring_buf_ring_advance(bufferRing, 1);
+
+                struct io_uring_sqe *sqe = io_uring_get_sqe(&ring);
+                io_uring_prep_recv_multishot(sqe, fds[0], nullptr, 0, 0);
+                sqe->flags |= IOSQE_BUFFER_SELECT;
+                sqe->buf_group = BufferGroup;
+                io_uring_submit(&ring);
+
+                if (::write(fds[1], "x", 1) == 1) {
+                    struct io_uring_cqe *cqe;
+                    struct __kernel_timespec timeout = {1, 0};
+                    if (io_uring_wait_cqe_timeout(&ring, &cqe, &timeout) == 0) {
+                        ok = cqe->res == 1 && (cqe->flags & IORING_CQE_F_MORE);
+                        io_uring_cqe_seen(&ring, cqe);
+                    }
+                }
+
+                io_uring_free_buf_ring(&ring, bufferRing, 1, BufferGroup);
+            }
+            io_uring_queue_exit(&ring);
+        }
+
+        ::close(fds[0]);
+        ::close(fds[1]);
+        return ok;
+    }();
+
+    return supported;
+}
+
+bool ProfileConnectionUring::start()
+{
+    // Stream sockets get many small buffers, packet sockets get buffers for whole packets
+    m_bufferSize = d->m_packetBased ? 65536 : 4096;
+    m_bufferCount = d->m_packetBased ? 16 : 64;
+
+    if (io_uring_queue_init(QueueDepth, &m_ring, 0) < 0) {
+        return false;
+    }
+
+    int ret;
+    m_bufferRing = io_uring_setup_buf_ring(&m_ring, m_bufferCount, BufferGroup, 0, &ret);
+    m_buffers = static_cast<char*>(::malloc(size_t(m_bufferSize) * m_bufferCount));
+    m_eventFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    if (!m_bufferRing || !m_buffers || m_eventFd < 0
+            || io_uring_register_files(&m_ring, &d->m_fd, 1) < 0
+            || io_uring_register_eventfd(&m_ring, m_eventFd) < 0) {
+        qCWarning(BLUEZQT) << "ProfileConnection: Cannot set up io_uring";
+        if (m_bufferRing) {
+            io_uring_free_buf_ring(&m_ring, m_bufferRing, m_bufferCount, BufferGroup);
+            m_bufferRing = nullptr;
+        }
+        ::free(m_buffers);
+        m_buffers = nullptr;
+        if (m_eventFd >= 0) {
+            ::close(m_eventFd);
+            m_eventFd = -1;
+        }
+        io_uring_queue_exit(&m_ring);
+        return false;
+    }
+
+    for (int i = 0; i < m_bufferCount; ++i) {
+        io_uring_buf_ring_add(m_bufferRing, m_buffers + i * m_bufferSize, m_bufferSize, i,
+                              io_uring_buf_ring_mask(m_bufferCount), i);
+    }
+    io_uring_buf_ring_advance(m_bufferRing, m_bufferCount);
+
+    m_eventNotifier = new QSocketNotifier(m_eventFd, QSocketNotifier::Read, this);
+    connect(m_eventNotifier, &QSocketNotifier::activated, this, &ProfileConnectionUring::completionsReady);
+
+    m_running = true;
+
+    armRecv();
+    if (!d->m_queue.isEmpty()) {
+        prepareWrites();
+    }
+    io_uring_submit(&m_ring);
+
+    return true;
+}
+
+void ProfileConnectionUring::stop()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+    m_eventNotifier->setEnabled(false);
+
+    // In-flight writes reference queued data, wait until they are canceled
+    if (m_recvArmed || m_writesInFlight > 0) {
+        struct io_uring_sqe *sqe = io_uring_get_sqe(&m_ring);
+        if (!sqe) {
+            io_uring_submit(&m_ring);
+            sqe = io_uring_get_sqe(&m_ring);
+        }
+        io_uring_prep_cancel_fd(sqe, SocketIndex, IORING_ASYNC_CANCEL_ALL | IORING_ASYNC_CANCEL_FD_FIXED);
+        io_uring_sqe_set_data64(sqe, CancelTag);
+        io_uring_submit(&m_ring);
+
+        while (m_recvArmed || m_writesInFlight > 0) {
+            struct io_uring_cqe *cqe;
+            struct __kernel_timespec timeout = {1, 0};
+            if (io_uring_wait_cqe_timeout(&m_ring, &cqe, &timeout) < 0) {
+                break;
+            }
+
+            const quint64 tag = io_uring_cqe_get_data64(cqe);
+            if (tag == RecvTag && !(cqe->flags & IORING_CQE_F_MORE)) {
+                m_recvArmed = false;
+            } else if (tag == WriteTag) {
+                m_writesInFlight--;
+            }
+            io_uring_cqe_seen(&m_ring, cqe);
+        }
+    }
+
+    io_uring_free_buf_ring(&m_ring, m_bufferRing, m_bufferCount, BufferGroup);
+    m_bufferRing = nullptr;
+    io_uring_queue_exit(&m_ring);
+
+    ::free(m_buffers);
+    m_buffers = nullptr;
+    ::close(m_eventFd);
+    m_eventFd = -1;
+
+    m_received.clear();
+    m_writesInFlight = 0;
+}
+
+bool ProfileConnectionUring::isIdle() const
+{
+    return m_writesInFlight == 0 && m_received.isEmpty();
+}
+
+qint64 ProfileConnectionUring::read(char *data, qint64 maxSize)
+{
+    m_readyReadPending = false;
+
+    if (m_received.isEmpty()) {
+        if (m_eof) {
+            return -1;
+        }
+        return 0;
+    }
+
+    qint64 size = 0;
+
+    if (d->m_packetBased) {
+        // One packet per read, the rest of the packet is discarded like with recv()
+        const Received received = m_received.dequeue();
+        size = qMin(qint64(received.size), maxSize);
+        ::memcpy(data, m_buffers + received.id * m_bufferSize, size_t(size));
+        recycleBuffer(received.id);
+    } else {
+        while (size < maxSize && !m_received.isEmpty()) {
+            Received &received = m_received.head();
+            const qint64 count = qMin(qint64(received.size - received.offset), maxSize - size);
+            ::memcpy(data + size, m_buffers + received.id * m_bufferSize + received.offset, size_t(count));
+            size += count;
+            received.offset += int(count);
+
+            if (received.offset == received.size) {
+                recycleBuffer(m_received.dequeue().id);
+            }
+        }
+    }
+
+    // Same as with socket notifier, readyRead() is emitted again if there are unread data
+    if (!m_received.isEmpty() || m_eof) {
+        QTimer::singleShot(0, this, &ProfileConnectionUring::emitReadyRead);
+    }
+
+    return size;
+}
+
+void ProfileConnectionUring::scheduleSubmit()
+{
+    // All writes in one event loop iteration are submitted together
+    if (m_submitScheduled) {
+        return;
+    }
+
+    m_submitScheduled = true;
+    QTimer::singleShot(0, this, &ProfileConnectionUring::submitPending);
+}
+
+void ProfileConnectionUring::completionsReady()
+{
+    quint64 value;
+    if (::read(m_eventFd, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+        qCWarning(BLUEZQT) << "ProfileConnection: Cannot read eventfd:" << strerror(errno);
+    }
+
+    struct io_uring_cqe *cqe;
+    unsigned head;
+    unsigned count = 0;
+
+    io_uring_for_each_cqe(&m_ring, head, cqe) {
+        const quint64 tag = io_uring_cqe_get_data64(cqe);
+        if (tag == RecvTag) {
+            handleRecv(cqe);
+        } else if (tag == WriteTag) {
+            handleWrite(cqe);
+        }
+        count++;
+    }
+    io_uring_cq_advance(&m_ring, count);
+
+    if (m_failed) {
+        d->handleDisconnect();
+        return;
+    }
+
+    qint64 written = 0;
+    if (m_writesInFlight == 0) {
+        written = m_batchWritten;
+        m_batchWritten = 0;
+        if (!d->m_queue.isEmpty()) {
+            scheduleSubmit();
+        }
+    }
+
+    if (io_uring_sq_ready(&m_ring) > 0) {
+        io_uring_submit(&m_ring);
+    }
+
+    // Signals are emitted only after the completion queue is processed,
+    // the connection may be closed from the connected slots
+    if (m_dataReceived) {
+        m_dataReceived = false;
+        if (!m_readyReadPending) {
+            m_readyReadPending = true;
+            Q_EMIT d->q->readyRead();
+        }
+    }
+
+    if (written > 0 && m_running) {
+        d->updateWatermark();
+        Q_EMIT d->q->bytesWritten(written);
+    }
+}
+
+void ProfileConnectionUring::handleRecv(const struct io_uring_cqe *cqe)
+{
+    if (!(cqe->flags & IORING_CQE_F_MORE)) {
+        m_recvArmed = false;
+    }
+
+    if (cqe->res > 0) {
+        Received received;
+        received.id = int(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+        received.size = cqe->res;
+        received.offset = 0;
+        m_received.enqueue(received);
+        m_dataReceived = true;
+
+        if (!m_recvArmed) {
+            armRecv();
+        }
+    } else if (cqe->res == -ENOBUFS) {
+        // All buffers hold unread data, receiving continues after read()
+        m_recvStarved = true;
+    } else if (cqe->res != -ECANCELED) {
+        // Connection closed or failed, disconnection is reported only after reading the received data
+        if (cqe->res < 0) {
+            qCWarning(BLUEZQT) << "ProfileConnection: Read failed:" << strerror(-cqe->res);
+        }
+        if (m_received.isEmpty()) {
+            m_failed = true;
+        } else {
+            m_eof = true;
+        }
+    }
+}
+
+void ProfileConnectionUring::handleWrite(const struct io_uring_cqe *cqe)
+{
+    m_writesInFlight--;
+
+    if (cqe->res > 0) {
+        d->consumeWritten(cqe->res);
+        m_batchWritten += cqe->res;
+    } else if (cqe->res < 0 && cqe->res != -ECANCELED && cqe->res != -EAGAIN) {
+        qCWarning(BLUEZQT) << "ProfileConnection: Write failed:" << strerror(-cqe->res);
+        m_failed = true;
+    }
+}
+
+void ProfileConnectionUring::armRecv()
+{
+    struct io_uring_sqe *sqe = io_uring_get_sqe(&m_ring);
+    if (!sqe) {
+        io_uring_submit(&m_ring);
+        sqe = io_uring_get_sqe(&m_ring);
+    }
+
+    io_uring_prep_recv_multishot(sqe, SocketIndex, nullptr, 0, 0);
+    sqe->flags |= IOSQE_FIXED_FILE | IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BufferGroup;
+    io_uring_sqe_set_data64(sqe, RecvTag);
+
+    m_recvArmed = true;
+    m_recvStarved = false;
+}
+
+void ProfileConnectionUring::prepareWrites()
+{
+    struct io_uring_sqe *last = nullptr;
+    int index = 0;
+
+    // Stream sockets use one sendmsg() for all queued data, packet sockets use one
+    // sendmsg() per packet and the writes are linked to keep their order
+    for (int i = 0; i < MaxWriteOps && index < d->m_queue.size(); ++i) {
+        struct io_uring_sqe *sqe = io_uring_get_sqe(&m_ring);
+        if (!sqe) {
+            break;
+        }
+
+        WriteOp &op = m_writeOps[i];
+        op.count = 0;
+
+        while (index < d->m_queue.size() && op.count < MaxIovecs) {
+            const ProfileConnectionPrivate::Segment &segment = d->m_queue.at(index++);
+            op.iov[op.count].iov_base = const_cast<char*>(segment.data.constData()) + segment.offset;
+            op.iov[op.count].iov_len = segment.data.size() - segment.offset;
+            op.count++;
+
+            if (d->m_packetBased && segment.last) {
+                break;
+            }
+        }
+
+        // Closed peer fails the write instead of raising SIGPIPE
+        memset(&op.msg, 0, sizeof(op.msg));
+        op.msg.msg_iov = op.iov;
+        op.msg.msg_iovlen = size_t(op.count);
+        io_uring_prep_sendmsg(sqe, SocketIndex, &op.msg, MSG_NOSIGNAL);
+        sqe->flags |= IOSQE_FIXED_FILE | IOSQE_IO_LINK;
+        io_uring_sqe_set_data64(sqe, WriteTag);
+
+        last = sqe;
+        m_writesInFlight++;
+
+        if (!d->m_packetBased) {
+            break;
+        }
+    }
+
+    if (last) {
+        last->flags &= ~IOSQE_IO_LINK;
+    }
+}
+
+void ProfileConnectionUring::submitPending()
+{
+    m_submitScheduled = false;
+
+    if (!m_running) {
+        return;
+    }
+
+    // Writes are submitted again only after all previous writes completed
+    if (m_writesInFlight == 0 && !d->m_queue.isEmpty()) {
+        prepareWrites();
+    }
+
+    if (io_uring_sq_ready(&m_ring) > 0) {
+        io_uring_submit(&m_ring);
+    }
+}
+
+void ProfileConnectionUring::recycleBuffer(int id)
+{
+    io_uring_buf_ring_add(m_bufferRing, m_buffers + id * m_bufferSize, m_bufferSize, id,
+                          io_uring_buf_ring_mask(m_bufferCount), 0);
+    io_uring_buf_ring_advance(m_bufferRing, 1);
+
+    if (m_recvStarved && !m_recvArmed && !m_eof) {
+        armRecv();
+        scheduleSubmit();
+    }
+}
+
+void ProfileConnectionUring::emitReadyRead()
+{
+    if (!m_running || m_readyReadPending) {
+        return;
+    }
+
+    if (m_received.isEmpty() && m_eof) {
+        d->handleDisconnect();
+        return;
+    }
+
+    if (!m_received.isEmpty()) {
+        m_readyReadPending = true;
+        Q_EMIT d->q->readyRead();
+    }
+}
+
+} // namespace BluezQt
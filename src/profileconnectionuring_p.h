@@ -0,0 +1,114 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PROFILECONNECTIONURING_P_H
+#define BLUEZQT_PROFILECONNECTIONURING_P_H
+
+#include <QObject>
+#include <QQueue>
+
+#include <liburing.h>
+#include <sys/socket.h>
+
+class QSocketNotifier;
+
+namespace BluezQt
+{
+
+class ProfileConnectionPrivate;
+
+// io_uring backend of ProfileConnection
+class ProfileConnectionUring : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ProfileConnectionUring(ProfileConnectionPrivate *d);
+    ~ProfileConnectionUring();
+
+    static bool isSupported();
+
+    bool start();
+    void stop();
+    bool isIdle() const;
+
+    qint64 read(char *data, qint64 maxSize);
+    void scheduleSubmit();
+
+private:
+    enum {
+        MaxIovecs = 64,
+        MaxWriteOps = 16
+    };
+
+    // Received data in a provided buffer
+    struct Received
+    {
+        int id;
+        int size;
+        int offset;
+    };
+
+    // Pending sendmsg() of queued segments
+    struct WriteOp
+    {
+        struct msghdr msg;
+        struct iovec iov[MaxIovecs];
+        int count;
+    };
+
+    void completionsReady();
+    void handleRecv(const struct io_uring_cqe *cqe);
+    void handleWrite(const struct io_uring_cqe *cqe);
+    void armRecv();
+    void prepareWrites();
+    void submitPending();
+    void recycleBuffer(int id);
+    void emitReadyRead();
+
+    ProfileConnectionPrivate *d;
+    bool m_running;
+    struct io_uring m_ring;
+    struct io_uring_buf_ring *m_bufferRing;
+    char *m_buffers;
+    int m_bufferSize;
+    int m_bufferCount;
+    int m_eventFd;
+    QSocketNotifier *m_eventNotifier;
+
+    QQueue<Received> m_received;
+    bool m_recvArmed;
+    bool m_recvStarved;
+    bool m_eof;
+    bool m_readyReadPending;
+    bool m_dataReceived;
+
+    WriteOp m_writeOps[MaxWriteOps];
+    int m_writesInFlight;
+    qint64 m_batchWritten;
+    bool m_submitScheduled;
+    bool m_failed;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PROFILECONNECTIONURING_P_H
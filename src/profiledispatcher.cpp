@@ -0,0 +1,222 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profiledispatcher.h"
+#include "profiledispatcher_p.h"
+#include "device.h"
+
+#include <QThread>
+#include <QCoreApplication>
+
+namespace BluezQt
+{
+
+DispatchEvent::DispatchEvent(const std::function<void()> &function, const std::function<void()> &cancel)
+    : QEvent(eventType())
+    , function(function)
+    , cancel(cancel)
+    , done(false)
+{
+}
+
+DispatchEvent::~DispatchEvent()
+{
+    if (!done && cancel) {
+        cancel();
+    }
+}
+
+QEvent::Type DispatchEvent::eventType()
+{
+    static const QEvent::Type type = static_cast<QEvent::Type>(QEvent::registerEventType());
+    return type;
+}
+
+bool DispatchContext::event(QEvent *event)
+{
+    if (event->type() == DispatchEvent::eventType()) {
+        DispatchEvent *dispatchEvent = static_cast<DispatchEvent*>(event);
+        dispatchEvent->done = true;
+        dispatchEvent->function();
+        return true;
+    }
+    return QObject::event(event);
+}
+
+ProfileDispatcherPrivate::ProfileDispatcherPrivate(ProfileDispatcher *q)
+    : q(q)
+    , m_policy(ProfileDispatcher::RoundRobin)
+    , m_nextThread(0)
+{
+}
+
+int ProfileDispatcherPrivate::selectThread(const QString &device)
+{
+    // Device that is already connected stays in its thread
+    auto it = m_deviceThreads.find(device);
+    if (it != m_deviceThreads.end()) {
+        return it->thread;
+    }
+
+    switch (m_policy) {
+    case ProfileDispatcher::DeviceAffinity:
+        return int(qHash(device) % uint(m_threads.count()));
+
+    default:
+        return m_nextThread++ % m_threads.count();
+    }
+}
+
+void ProfileDispatcherPrivate::dispatchConnection(DevicePtr device, const std::function<void()> &function, const std::function<void()> &cancel)
+{
+    QMutexLocker locker(&m_mutex);
+
+    const QString &ubi = device->ubi();
+    const int index = selectThread(ubi);
+
+    auto it = m_deviceThreads.find(ubi);
+    if (it == m_deviceThreads.end()) {
+        it = m_deviceThreads.insert(ubi, DeviceThread());
+        it->thread = index;
+        it->connections = 0;
+
+        // Remote side may drop the link without any request for disconnection
+        it->connectedChanged = QObject::connect(device.data(), &Device::connectedChanged, q, [this, ubi](bool connected) {
+            if (!connected) {
+                releaseDevice(ubi);
+            }
+        });
+        it->deviceRemoved = QObject::connect(device.data(), &Device::deviceRemoved, q, [this, ubi]() {
+            releaseDevice(ubi);
+        });
+    }
+
+    it->connections++;
+    m_connections[index]++;
+
+    QCoreApplication::postEvent(m_contexts.at(index), new DispatchEvent(function, cancel));
+}
+
+void ProfileDispatcherPrivate::dispatchDisconnection(const QString &device, const std::function<void()> &function, const std::function<void()> &cancel)
+{
+    QMutexLocker locker(&m_mutex);
+
+    int index = 0;
+    auto it = m_deviceThreads.find(device);
+    if (it != m_deviceThreads.end()) {
+        index = it->thread;
+        m_connections[index]--;
+        if (--it->connections == 0) {
+            eraseDevice(it);
+        }
+    }
+
+    QCoreApplication::postEvent(m_contexts.at(index), new DispatchEvent(function, cancel));
+}
+
+void ProfileDispatcherPrivate::releaseDevice(const QString &device)
+{
+    QMutexLocker locker(&m_mutex);
+
+    auto it = m_deviceThreads.find(device);
+    if (it == m_deviceThreads.end()) {
+        return;
+    }
+
+    m_connections[it->thread] -= it->connections;
+    eraseDevice(it);
+}
+
+void ProfileDispatcherPrivate::eraseDevice(QHash<QString, DeviceThread>::iterator it)
+{
+    QObject::disconnect(it->connectedChanged);
+    QObject::disconnect(it->deviceRemoved);
+    m_deviceThreads.erase(it);
+}
+
+ProfileDispatcher::ProfileDispatcher(int threadCount, QObject *parent)
+    : QObject(parent)
+    , d(new ProfileDispatcherPrivate(this))
+{
+    if (threadCount <= 0) {
+        threadCount = qMax(1, QThread::idealThreadCount());
+    }
+
+    d->m_connections.fill(0, threadCount);
+
+    for (int i = 0; i < threadCount; ++i) {
+        QThread *thread = new QThread;
+        thread->setObjectName(QStringLiteral("ProfileDispatcher %1").arg(i));
+
+        DispatchContext *context = new DispatchContext;
+        context->moveToThread(thread);
+        thread->start();
+
+        d->m_threads.append(thread);
+        d->m_contexts.append(context);
+    }
+}
+
+ProfileDispatcher::~ProfileDispatcher()
+{
+    for (int i = 0; i < d->m_threads.count(); ++i) {
+        d->m_threads.at(i)->quit();
+        d->m_threads.at(i)->wait();
+
+        // Calls still waiting in the queue are canceled when their events are deleted
+        QCoreApplication::removePostedEvents(d->m_contexts.at(i), DispatchEvent::eventType());
+        delete d->m_contexts.at(i);
+        delete d->m_threads.at(i);
+    }
+
+    delete d;
+}
+
+int ProfileDispatcher::threadCount() const
+{
+    return d->m_threads.count();
+}
+
+QThread *ProfileDispatcher::workerThread(int index) const
+{
+    return d->m_threads.value(index);
+}
+
+ProfileDispatcher::Policy ProfileDispatcher::policy() const
+{
+    QMutexLocker locker(&d->m_mutex);
+    return d->m_policy;
+}
+
+void ProfileDispatcher::setPolicy(Policy policy)
+{
+    QMutexLocker locker(&d->m_mutex);
+    d->m_policy = policy;
+}
+
+int ProfileDispatcher::connectionCount(int index) const
+{
+    QMutexLocker locker(&d->m_mutex);
+    return d->m_connections.value(index);
+}
+
+} // namespace BluezQt
@@ -0,0 +1,141 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PROFILEDISPATCHER_H
+#define BLUEZQT_PROFILEDISPATCHER_H
+
+#include <QObject>
+
+#include "bluezqt_export.h"
+
+class QThread;
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::ProfileDispatcher profiledispatcher.h <BluezQt/ProfileDispatcher>
+ *
+ * Dispatcher of profile connections.
+ *
+ * By default, Profile::newConnection() and Profile::requestDisconnection() are
+ * called in the thread of Manager, and so is usually all the I/O on the accepted sockets.
+ *
+ * When a dispatcher is set with Profile::setDispatcher(), these calls are instead
+ * delivered to a pool of worker threads. Objects created in Profile::newConnection()
+ * (eg. ProfileConnection) then live in the worker thread and all their I/O runs there,
+ * while the thread of Manager only handles D-Bus.
+ *
+ * Requests for disconnection are always delivered to the thread that handled
+ * the last connection of the device. The device is released from its thread
+ * when its last connection is disconnected, when the device disconnects
+ * (eg. the remote side dropped the link) or when it is removed.
+ *
+ * @note Profile::newConnection() and Profile::requestDisconnection() of a profile using
+ *       a dispatcher must be thread-safe. The Device passed to them lives in the thread
+ *       of Manager, so it should only be used to identify the device.
+ */
+class BLUEZQT_EXPORT ProfileDispatcher : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int threadCount READ threadCount)
+    Q_PROPERTY(Policy policy READ policy WRITE setPolicy)
+
+public:
+    /** Policy for selecting worker threads for new connections. */
+    enum Policy {
+        /** Threads are used in turns. */
+        RoundRobin,
+        /** Connections from the same device always use the same thread. */
+        DeviceAffinity
+    };
+    Q_ENUM(Policy)
+
+    /**
+     * Creates a new ProfileDispatcher object and starts its worker threads.
+     *
+     * @param threadCount number of worker threads, 0 to use the number of CPU cores
+     * @param parent
+     */
+    explicit ProfileDispatcher(int threadCount = 0, QObject *parent = nullptr);
+
+    /**
+     * Destroys a ProfileDispatcher object.
+     *
+     * Worker threads are stopped and waited for.
+     * Requests that did not get to a worker thread yet are canceled.
+     */
+    ~ProfileDispatcher();
+
+    /**
+     * Returns the number of worker threads.
+     *
+     * @return number of threads
+     */
+    int threadCount() const;
+
+    /**
+     * Returns the worker thread.
+     *
+     * @param index index of thread
+     * @return worker thread
+     */
+    QThread *workerThread(int index) const;
+
+    /**
+     * Returns the policy for selecting worker threads.
+     *
+     * Default policy is RoundRobin.
+     *
+     * @return policy
+     */
+    Policy policy() const;
+
+    /**
+     * Sets the policy for selecting worker threads.
+     *
+     * @param policy policy
+     */
+    void setPolicy(Policy policy);
+
+    /**
+     * Returns the number of connections dispatched to the worker thread.
+     *
+     * Connections are counted until their disconnection is requested,
+     * or until their device disconnects or is removed.
+     *
+     * @param index index of thread
+     * @return number of connections
+     */
+    int connectionCount(int index) const;
+
+private:
+    class ProfileDispatcherPrivate *const d;
+
+    friend class ProfileDispatcherPrivate;
+    friend class ProfileAdaptor;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PROFILEDISPATCHER_H
@@ -0,0 +1,93 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_PROFILEDISPATCHER_P_H
+#define BLUEZQT_PROFILEDISPATCHER_P_H
+
+#include <QHash>
+#include <QEvent>
+#include <QMutex>
+#include <QVector>
+
+#include <functional>
+
+#include "profiledispatcher.h"
+#include "types.h"
+
+namespace BluezQt
+{
+
+// Function to be called in a worker thread, cancel is called instead if the event is dropped
+class DispatchEvent : public QEvent
+{
+public:
+    explicit DispatchEvent(const std::function<void()> &function, const std::function<void()> &cancel);
+    ~DispatchEvent();
+
+    static QEvent::Type eventType();
+
+    std::function<void()> function;
+    std::function<void()> cancel;
+    bool done;
+};
+
+// Receiver of dispatched functions, lives in a worker thread
+class DispatchContext : public QObject
+{
+    Q_OBJECT
+
+public:
+    bool event(QEvent *event) override;
+};
+
+class ProfileDispatcherPrivate
+{
+public:
+    struct DeviceThread
+    {
+        int thread;
+        int connections;
+        QMetaObject::Connection connectedChanged;
+        QMetaObject::Connection deviceRemoved;
+    };
+
+    explicit ProfileDispatcherPrivate(ProfileDispatcher *q);
+
+    int selectThread(const QString &device);
+    void dispatchConnection(DevicePtr device, const std::function<void()> &function, const std::function<void()> &cancel);
+    void dispatchDisconnection(const QString &device, const std::function<void()> &function, const std::function<void()> &cancel);
+    void releaseDevice(const QString &device);
+    void eraseDevice(QHash<QString, DeviceThread>::iterator it);
+
+    ProfileDispatcher *q;
+    ProfileDispatcher::Policy m_policy;
+    QVector<QThread*> m_threads;
+    QVector<DispatchContext*> m_contexts;
+    QVector<int> m_connections;
+    QHash<QString, DeviceThread> m_deviceThreads;
+    int m_nextThread;
+    mutable QMutex m_mutex;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_PROFILEDISPATCHER_P_H
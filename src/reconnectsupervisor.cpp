@@ -0,0 +1,308 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "reconnectsupervisor.h"
+#include "reconnectsupervisor_p.h"
+#include "device.h"
+#include "adapter.h"
+#include "pendingcall.h"
+#include "utils.h"
+#include "debug.h"
+
+#include <QTimer>
+
+namespace BluezQt
+{
+
+ReconnectSupervisorPrivate::ReconnectSupervisorPrivate(ReconnectSupervisor *q)
+    : QObject()
+    , q(q)
+    , m_inFlight(0)
+    , m_trustedOnly(true)
+    , m_maxConcurrent(4)
+    , m_maxPerAdapter(1)
+    , m_initialBackoff(1000)
+    , m_maximumBackoff(60000)
+    , m_jitter(0.3)
+{
+}
+
+ReconnectSupervisorPrivate::~ReconnectSupervisorPrivate()
+{
+    qDeleteAll(m_entries);
+}
+
+void ReconnectSupervisorPrivate::deviceConnectedChanged(Entry *entry, bool connected)
+{
+    if (connected) {
+        entry->attempts = 0;
+        entry->timer->stop();
+        m_ready.removeOne(entry->device->ubi());
+        return;
+    }
+
+    if (!entry->inFlight && !entry->timer->isActive()) {
+        schedule(entry);
+    }
+}
+
+void ReconnectSupervisorPrivate::schedule(Entry *entry)
+{
+    entry->timer->start(Retry::backoffDelay(entry->attempts, m_initialBackoff, m_maximumBackoff, m_jitter));
+}
+
+void ReconnectSupervisorPrivate::enqueue(Entry *entry)
+{
+    if (!m_ready.contains(entry->device->ubi())) {
+        m_ready.append(entry->device->ubi());
+    }
+    dispatch();
+}
+
+void ReconnectSupervisorPrivate::dispatch()
+{
+    QStringList::iterator it = m_ready.begin();
+
+    while (it != m_ready.end() && m_inFlight < m_maxConcurrent) {
+        Entry *entry = m_entries.value(*it);
+        if (!entry) {
+            it = m_ready.erase(it);
+            continue;
+        }
+
+        // Skip devices of busy adapters, but keep them at their place in the queue
+        const QString &adapter = adapterUbi(entry->device);
+        if (m_adapterInFlight.value(adapter) >= m_maxPerAdapter) {
+            ++it;
+            continue;
+        }
+
+        it = m_ready.erase(it);
+        startReconnect(entry);
+    }
+}
+
+void ReconnectSupervisorPrivate::startReconnect(Entry *entry)
+{
+    if (!isWanted(entry)) {
+        entry->attempts = 0;
+        return;
+    }
+
+    const QString &ubi = entry->device->ubi();
+    const QString &adapter = adapterUbi(entry->device);
+
+    entry->inFlight = true;
+    m_inFlight++;
+    m_adapterInFlight[adapter]++;
+
+    Q_EMIT q->reconnecting(entry->device, entry->attempts + 1);
+
+    PendingCall *call = entry->device->connectToDevice();
+    connect(call, &PendingCall::finished, this, [this, ubi, adapter](PendingCall *finishedCall) {
+        finishedCall->disconnect(this);
+        reconnectFinished(ubi, adapter, finishedCall->error());
+    });
+    connect(call, &QObject::destroyed, this, [this, ubi, adapter]() {
+        // Call deleted with its removed device without finishing
+        reconnectFinished(ubi, adapter, PendingCall::InternalError);
+    });
+}
+
+void ReconnectSupervisorPrivate::reconnectFinished(const QString &ubi, const QString &adapter, int error)
+{
+    m_inFlight--;
+    m_adapterInFlight[adapter]--;
+
+    Entry *entry = m_entries.value(ubi);
+    if (entry) {
+        entry->inFlight = false;
+
+        if (error == PendingCall::NoError || error == PendingCall::AlreadyConnected) {
+            entry->attempts = 0;
+            Q_EMIT q->reconnected(entry->device);
+        } else {
+            entry->attempts++;
+            qCDebug(BLUEZQT) << "ReconnectSupervisor: Reconnect of" << ubi << "failed, attempt" << entry->attempts;
+            schedule(entry);
+        }
+    }
+
+    dispatch();
+}
+
+bool ReconnectSupervisorPrivate::isWanted(Entry *entry) const
+{
+    if (entry->device->isConnected()) {
+        return false;
+    }
+    return !m_trustedOnly || entry->device->isTrusted();
+}
+
+QString ReconnectSupervisorPrivate::adapterUbi(const DevicePtr &device)
+{
+    return device->adapter() ? device->adapter()->ubi() : QString();
+}
+
+ReconnectSupervisor::ReconnectSupervisor(QObject *parent)
+    : QObject(parent)
+    , d(new ReconnectSupervisorPrivate(this))
+{
+}
+
+ReconnectSupervisor::~ReconnectSupervisor()
+{
+    delete d;
+}
+
+QList<DevicePtr> ReconnectSupervisor::devices() const
+{
+    QList<DevicePtr> list;
+    list.reserve(d->m_entries.size());
+
+    Q_FOREACH (ReconnectSupervisorPrivate::Entry *entry, d->m_entries) {
+        list.append(entry->device);
+    }
+    return list;
+}
+
+bool ReconnectSupervisor::contains(DevicePtr device) const
+{
+    return device && d->m_entries.contains(device->ubi());
+}
+
+void ReconnectSupervisor::addDevice(DevicePtr device)
+{
+    if (!device || contains(device)) {
+        return;
+    }
+
+    ReconnectSupervisorPrivate::Entry *entry = new ReconnectSupervisorPrivate::Entry;
+    entry->device = device;
+    entry->attempts = 0;
+    entry->inFlight = false;
+    entry->timer = new QTimer(d);
+    entry->timer->setSingleShot(true);
+    d->m_entries.insert(device->ubi(), entry);
+
+    connect(entry->timer, &QTimer::timeout, d, [this, entry]() {
+        d->enqueue(entry);
+    });
+    connect(device.data(), &Device::connectedChanged, d, [this, entry](bool connected) {
+        d->deviceConnectedChanged(entry, connected);
+    });
+    connect(device.data(), &Device::deviceRemoved, d, [this](DevicePtr removedDevice) {
+        removeDevice(removedDevice);
+    });
+
+    if (!device->isConnected()) {
+        d->enqueue(entry);
+    }
+}
+
+void ReconnectSupervisor::removeDevice(DevicePtr device)
+{
+    if (!device) {
+        return;
+    }
+
+    ReconnectSupervisorPrivate::Entry *entry = d->m_entries.take(device->ubi());
+    if (!entry) {
+        return;
+    }
+
+    // Reconnect in progress is not canceled, its result is only ignored.
+    // When the device is destroyed, the call is deleted and releases its slot.
+    device->disconnect(d);
+    d->m_ready.removeOne(device->ubi());
+    delete entry->timer;
+    delete entry;
+}
+
+bool ReconnectSupervisor::trustedOnly() const
+{
+    return d->m_trustedOnly;
+}
+
+void ReconnectSupervisor::setTrustedOnly(bool trustedOnly)
+{
+    d->m_trustedOnly = trustedOnly;
+}
+
+int ReconnectSupervisor::maxConcurrentAttempts() const
+{
+    return d->m_maxConcurrent;
+}
+
+void ReconnectSupervisor::setMaxConcurrentAttempts(int count)
+{
+    d->m_maxConcurrent = qMax(1, count);
+    d->dispatch();
+}
+
+int ReconnectSupervisor::maxAttemptsPerAdapter() const
+{
+    return d->m_maxPerAdapter;
+}
+
+void ReconnectSupervisor::setMaxAttemptsPerAdapter(int count)
+{
+    d->m_maxPerAdapter = qMax(1, count);
+    d->dispatch();
+}
+
+int ReconnectSupervisor::initialBackoff() const
+{
+    return d->m_initialBackoff;
+}
+
+void ReconnectSupervisor::setInitialBackoff(int msecs)
+{
+    d->m_initialBackoff = qMax(0, msecs);
+}
+
+int ReconnectSupervisor::maximumBackoff() const
+{
+    return d->m_maximumBackoff;
+}
+
+void ReconnectSupervisor::setMaximumBackoff(int msecs)
+{
+    d->m_maximumBackoff = qMax(0, msecs);
+}
+
+qreal ReconnectSupervisor::jitter() const
+{
+    return d->m_jitter;
+}
+
+void ReconnectSupervisor::setJitter(qreal jitter)
+{
+    d->m_jitter = qBound<qreal>(0.0, jitter, 1.0);
+}
+
+int ReconnectSupervisor::inFlightCount() const
+{
+    return d->m_inFlight;
+}
+
+} // namespace BluezQt
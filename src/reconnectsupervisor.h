@@ -0,0 +1,236 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_RECONNECTSUPERVISOR_H
+#define BLUEZQT_RECONNECTSUPERVISOR_H
+
+#include <QObject>
+
+#include "types.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::ReconnectSupervisor reconnectsupervisor.h <BluezQt/ReconnectSupervisor>
+ *
+ * Reconnect supervisor.
+ *
+ * ReconnectSupervisor keeps a set of devices that should stay connected.
+ * When a supervised device gets disconnected (eg. after link loss),
+ * it is reconnected with Device::connectToDevice().
+ *
+ * Failed reconnects are retried with exponential backoff. The delays are randomized
+ * by jitter() so devices that were lost at the same time do not all retry at once.
+ * The number of concurrent reconnects is limited both globally and per adapter.
+ *
+ * By default, only devices that are trusted are reconnected.
+ */
+class BLUEZQT_EXPORT ReconnectSupervisor : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(bool trustedOnly READ trustedOnly WRITE setTrustedOnly)
+    Q_PROPERTY(int maxConcurrentAttempts READ maxConcurrentAttempts WRITE setMaxConcurrentAttempts)
+    Q_PROPERTY(int maxAttemptsPerAdapter READ maxAttemptsPerAdapter WRITE setMaxAttemptsPerAdapter)
+    Q_PROPERTY(int initialBackoff READ initialBackoff WRITE setInitialBackoff)
+    Q_PROPERTY(int maximumBackoff READ maximumBackoff WRITE setMaximumBackoff)
+    Q_PROPERTY(qreal jitter READ jitter WRITE setJitter)
+    Q_PROPERTY(int inFlightCount READ inFlightCount)
+
+public:
+    /**
+     * Creates a new ReconnectSupervisor object.
+     *
+     * @param parent
+     */
+    explicit ReconnectSupervisor(QObject *parent = nullptr);
+
+    /**
+     * Destroys a ReconnectSupervisor object.
+     */
+    ~ReconnectSupervisor();
+
+    /**
+     * Returns list of supervised devices.
+     *
+     * @return list of devices
+     */
+    QList<DevicePtr> devices() const;
+
+    /**
+     * Returns whether the device is supervised.
+     *
+     * @param device device
+     * @return true if device is supervised
+     */
+    bool contains(DevicePtr device) const;
+
+    /**
+     * Adds the device to supervised devices.
+     *
+     * If the device is not connected, it is connected right away.
+     *
+     * @param device device
+     */
+    void addDevice(DevicePtr device);
+
+    /**
+     * Removes the device from supervised devices.
+     *
+     * Device is also removed automatically when it is removed from the adapter.
+     *
+     * @param device device
+     */
+    void removeDevice(DevicePtr device);
+
+    /**
+     * Returns whether only trusted devices are reconnected.
+     *
+     * @return true if only trusted devices are reconnected
+     */
+    bool trustedOnly() const;
+
+    /**
+     * Sets whether only trusted devices are reconnected.
+     *
+     * Default value is true.
+     *
+     * @param trustedOnly true to reconnect only trusted devices
+     */
+    void setTrustedOnly(bool trustedOnly);
+
+    /**
+     * Returns the maximum number of concurrent reconnects.
+     *
+     * @return maximum number of reconnects
+     */
+    int maxConcurrentAttempts() const;
+
+    /**
+     * Sets the maximum number of concurrent reconnects.
+     *
+     * Default value is 4.
+     *
+     * @param count maximum number of reconnects (at least 1)
+     */
+    void setMaxConcurrentAttempts(int count);
+
+    /**
+     * Returns the maximum number of concurrent reconnects per adapter.
+     *
+     * @return maximum number of reconnects
+     */
+    int maxAttemptsPerAdapter() const;
+
+    /**
+     * Sets the maximum number of concurrent reconnects per adapter.
+     *
+     * Default value is 1.
+     *
+     * @param count maximum number of reconnects (at least 1)
+     */
+    void setMaxAttemptsPerAdapter(int count);
+
+    /**
+     * Returns the delay before first reconnect.
+     *
+     * @return delay in milliseconds
+     */
+    int initialBackoff() const;
+
+    /**
+     * Sets the delay before first reconnect.
+     *
+     * The delay is doubled after each failed reconnect.
+     * Default value is 1000 milliseconds.
+     *
+     * @param msecs delay in milliseconds
+     */
+    void setInitialBackoff(int msecs);
+
+    /**
+     * Returns the maximum delay between reconnects.
+     *
+     * @return delay in milliseconds
+     */
+    int maximumBackoff() const;
+
+    /**
+     * Sets the maximum delay between reconnects.
+     *
+     * Default value is 60000 milliseconds.
+     *
+     * @param msecs delay in milliseconds
+     */
+    void setMaximumBackoff(int msecs);
+
+    /**
+     * Returns the jitter of delays.
+     *
+     * @return jitter
+     */
+    qreal jitter() const;
+
+    /**
+     * Sets the jitter of delays.
+     *
+     * Each delay is randomly changed by up to this fraction of its value.
+     * Default value is 0.3.
+     *
+     * @param jitter jitter in range 0.0 - 1.0
+     */
+    void setJitter(qreal jitter);
+
+    /**
+     * Returns the number of reconnects in progress.
+     *
+     * @return number of reconnects
+     */
+    int inFlightCount() const;
+
+Q_SIGNALS:
+    /**
+     * Indicates that a reconnect of the device have started.
+     *
+     * @param device device
+     * @param attempt number of the attempt, starting with 1
+     */
+    void reconnecting(DevicePtr device, int attempt);
+
+    /**
+     * Indicates that the device was reconnected.
+     *
+     * @param device device
+     */
+    void reconnected(DevicePtr device);
+
+private:
+    class ReconnectSupervisorPrivate *const d;
+
+    friend class ReconnectSupervisorPrivate;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_RECONNECTSUPERVISOR_H
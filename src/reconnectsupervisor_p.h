@@ -0,0 +1,79 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_RECONNECTSUPERVISOR_P_H
+#define BLUEZQT_RECONNECTSUPERVISOR_P_H
+
+#include <QHash>
+#include <QStringList>
+
+#include "types.h"
+
+class QTimer;
+
+namespace BluezQt
+{
+
+class ReconnectSupervisor;
+
+class ReconnectSupervisorPrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Entry
+    {
+        DevicePtr device;
+        QTimer *timer;
+        int attempts;
+        bool inFlight;
+    };
+
+    explicit ReconnectSupervisorPrivate(ReconnectSupervisor *q);
+    ~ReconnectSupervisorPrivate();
+
+    void deviceConnectedChanged(Entry *entry, bool connected);
+    void schedule(Entry *entry);
+    void enqueue(Entry *entry);
+    void dispatch();
+    void startReconnect(Entry *entry);
+    void reconnectFinished(const QString &ubi, const QString &adapter, int error);
+    bool isWanted(Entry *entry) const;
+
+    static QString adapterUbi(const DevicePtr &device);
+
+    ReconnectSupervisor *q;
+    QHash<QString, Entry*> m_entries;
+    QStringList m_ready;
+    QHash<QString, int> m_adapterInFlight;
+    int m_inFlight;
+    bool m_trustedOnly;
+    int m_maxConcurrent;
+    int m_maxPerAdapter;
+    int m_initialBackoff;
+    int m_maximumBackoff;
+    qreal m_jitter;
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_RECONNECTSUPERVISOR_P_H
@@ -21,33 +21,170 @@
  */
 
 #include "request.h"
+#include "request_p.h"
+#include "requestmonitor.h"
+#include "requestmonitor_p.h"
 #include "debug.h"
 #include "utils.h"
 
+#include <QTimer>
+#include <QThread>
 #include <QStringBuilder>
 #include <QDBusMessage>
 #include <QDBusConnection>
+#include <QCoreApplication>
 
 namespace BluezQt
 {
 
-class RequestPrivate
+Q_GLOBAL_STATIC(RequestQueue, globalRequestQueue)
+
+RequestQueue::RequestQueue()
+    : QObject()
+    , m_head(nullptr)
+{
+    if (QCoreApplication::instance()) {
+        moveToThread(QCoreApplication::instance()->thread());
+    }
+}
+
+RequestQueue::~RequestQueue()
+{
+    Node *node = m_head.exchange(nullptr);
+    while (node) {
+        Node *next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+RequestQueue *RequestQueue::instance()
 {
-public:
-    RequestOriginatingType m_type;
-    QDBusMessage m_message;
+    return globalRequestQueue();
+}
 
-    bool sendMessage(const QDBusMessage &msg);
-    QString interfaceName();
+void RequestQueue::post(const std::function<void()> &function)
+{
+    QCoreApplication *app = QCoreApplication::instance();
+    if (!app || QThread::currentThread() == app->thread()) {
+        function();
+        return;
+    }
 
-    void acceptRequest(const QVariant &val);
-    void rejectRequest();
-    void cancelRequest();
-};
+    instance()->push(new Node{function, nullptr});
+}
 
-bool RequestPrivate::sendMessage(const QDBusMessage &msg)
+bool RequestQueue::event(QEvent *event)
 {
-    switch (m_type) {
+    if (event->type() == eventType()) {
+        drain();
+        return true;
+    }
+    return QObject::event(event);
+}
+
+QEvent::Type RequestQueue::eventType()
+{
+    static const QEvent::Type type = static_cast<QEvent::Type>(QEvent::registerEventType());
+    return type;
+}
+
+void RequestQueue::push(Node *node)
+{
+    node->next = m_head.load();
+    while (!m_head.compare_exchange_weak(node->next, node)) {
+    }
+
+    // Only the push to empty queue needs to wake up the main thread
+    if (!node->next) {
+        QCoreApplication::postEvent(this, new QEvent(eventType()));
+    }
+}
+
+void RequestQueue::drain()
+{
+    Node *node = m_head.exchange(nullptr);
+
+    // Nodes are pushed in reverse order
+    Node *reversed = nullptr;
+    while (node) {
+        Node *next = node->next;
+        node->next = reversed;
+        reversed = node;
+        node = next;
+    }
+
+    while (reversed) {
+        Node *next = reversed->next;
+        reversed->function();
+        delete reversed;
+        reversed = next;
+    }
+}
+
+RequestPrivate::RequestPrivate()
+    : m_type(OrgBluezAgent)
+    , m_replied(false)
+    , m_pendingTime(-1)
+    , m_deadlineSerial(0)
+{
+}
+
+RequestPrivate::~RequestPrivate()
+{
+    if (isPending()) {
+        RequestMonitorPrivate::requestAbandoned();
+    }
+}
+
+QSharedPointer<RequestPrivate> RequestPrivate::create(RequestOriginatingType type, const QDBusMessage &message)
+{
+    QSharedPointer<RequestPrivate> d(new RequestPrivate);
+    d->m_type = type;
+    d->m_message = message;
+    d->m_time.start();
+
+    RequestMonitorPrivate::requestReceived();
+
+    const int deadline = RequestMonitor::defaultDeadline();
+    if (deadline >= 0) {
+        setDeadline(d, deadline, RequestMonitor::defaultDeadlineAction());
+    }
+    return d;
+}
+
+void RequestPrivate::setDeadline(const QSharedPointer<RequestPrivate> &d, int msecs, RequestDeadlineAction action)
+{
+    if (!d->isPending()) {
+        return;
+    }
+
+    // Invalidates previously set deadline
+    const int serial = ++d->m_deadlineSerial;
+    if (msecs < 0) {
+        return;
+    }
+
+    // Timer holds the request, so the deadline expires even if the application dropped it
+    RequestQueue::post([d, serial, msecs, action]() {
+        const qint64 remaining = qMax(qint64(0), msecs - d->m_time.elapsed());
+
+        QTimer::singleShot(int(remaining), RequestQueue::instance(), [d, serial, action]() {
+            if (d->m_deadlineSerial != serial) {
+                return;
+            }
+            if (action == RejectOnDeadline) {
+                d->rejectRequest(true);
+            } else {
+                d->cancelRequest(true);
+            }
+        });
+    });
+}
+
+bool RequestPrivate::sendMessage(RequestOriginatingType type, const QDBusMessage &msg)
+{
+    switch (type) {
     case OrgBluezAgent:
     case OrgBluezProfile:
         return DBusConnection::orgBluez().send(msg);
@@ -73,8 +210,52 @@ QString RequestPrivate::interfaceName()
     }
 }
 
+bool RequestPrivate::isPending() const
+{
+    return !m_replied && m_message.type() != QDBusMessage::InvalidMessage;
+}
+
+qint64 RequestPrivate::pendingTime() const
+{
+    const qint64 time = m_pendingTime;
+    if (time >= 0) {
+        return time;
+    }
+    return m_time.isValid() ? m_time.elapsed() : 0;
+}
+
+bool RequestPrivate::claimReply(bool expired)
+{
+    // Only the first reply is sent, replies may race from different threads
+    if (m_replied.exchange(true)) {
+        return false;
+    }
+
+    if (m_message.type() != QDBusMessage::InvalidMessage) {
+        const qint64 time = m_time.elapsed();
+        m_pendingTime = time;
+        RequestMonitorPrivate::requestReplied(time, expired);
+    }
+    return true;
+}
+
+void RequestPrivate::sendReply(const QDBusMessage &reply)
+{
+    const RequestOriginatingType type = m_type;
+
+    RequestQueue::post([type, reply]() {
+        if (!sendMessage(type, reply)) {
+            qCWarning(BLUEZQT) << "Request: Failed to put reply on DBus queue";
+        }
+    });
+}
+
 void RequestPrivate::acceptRequest(const QVariant &val)
 {
+    if (!claimReply(false)) {
+        return;
+    }
+
     QDBusMessage reply;
     if (val.isValid()) {
         reply = m_message.createReply(val);
@@ -82,27 +263,27 @@ void RequestPrivate::acceptRequest(const QVariant &val)
         reply = m_message.createReply();
     }
 
-    if (!sendMessage(reply)) {
-        qCWarning(BLUEZQT) << "Request: Failed to put reply on DBus queue";
-    }
+    sendReply(reply);
 }
 
-void RequestPrivate::rejectRequest()
+void RequestPrivate::rejectRequest(bool expired)
 {
-    const QDBusMessage &reply = m_message.createErrorReply(interfaceName() % QStringLiteral(".Rejected"),
-                                QStringLiteral("Rejected"));
-    if (!sendMessage(reply)) {
-        qCWarning(BLUEZQT) << "Request: Failed to put reply on DBus queue";
+    if (!claimReply(expired)) {
+        return;
     }
+
+    sendReply(m_message.createErrorReply(interfaceName() % QStringLiteral(".Rejected"),
+                                         QStringLiteral("Rejected")));
 }
 
-void RequestPrivate::cancelRequest()
+void RequestPrivate::cancelRequest(bool expired)
 {
-    const QDBusMessage &reply = m_message.createErrorReply(interfaceName() % QStringLiteral(".Canceled"),
-                                QStringLiteral("Canceled"));
-    if (!sendMessage(reply)) {
-        qCWarning(BLUEZQT) << "Request: Failed to put reply on DBus queue";
+    if (!claimReply(expired)) {
+        return;
     }
+
+    sendReply(m_message.createErrorReply(interfaceName() % QStringLiteral(".Canceled"),
+                                         QStringLiteral("Canceled")));
 }
 
 // T
@@ -114,10 +295,8 @@ Request<T>::Request()
 
 template<typename T>
 Request<T>::Request(RequestOriginatingType type, const QDBusMessage &message)
-    : d(new RequestPrivate)
+    : d(RequestPrivate::create(type, message))
 {
-    d->m_type = type;
-    d->m_message = message;
 }
 
 template<typename T>
@@ -158,6 +337,24 @@ void Request<T>::cancel() const
     d->cancelRequest();
 }
 
+template<typename T>
+void Request<T>::setDeadline(int msecs, RequestDeadlineAction action) const
+{
+    RequestPrivate::setDeadline(d, msecs, action);
+}
+
+template<typename T>
+bool Request<T>::isPending() const
+{
+    return d->isPending();
+}
+
+template<typename T>
+qint64 Request<T>::pendingTime() const
+{
+    return d->pendingTime();
+}
+
 // void
 Request<void>::Request()
     : d(new RequestPrivate)
@@ -165,10 +362,8 @@ Request<void>::Request()
 }
 
 Request<void>::Request(RequestOriginatingType type, const QDBusMessage &message)
-    : d(new RequestPrivate)
+    : d(RequestPrivate::create(type, message))
 {
-    d->m_type = type;
-    d->m_message = message;
 }
 
 Request<void>::~Request()
@@ -203,6 +398,21 @@ void Request<void>::cancel() const
     d->cancelRequest();
 }
 
+void Request<void>::setDeadline(int msecs, RequestDeadlineAction action) const
+{
+    RequestPrivate::setDeadline(d, msecs, action);
+}
+
+bool Request<void>::isPending() const
+{
+    return d->isPending();
+}
+
+qint64 Request<void>::pendingTime() const
+{
+    return d->pendingTime();
+}
+
 // Generate classes
 template class Request<void>;
 template class Request<quint32>;
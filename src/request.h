@@ -38,6 +38,18 @@ enum RequestOriginatingType {
     OrgBluezObexAgent
 };
 
+/**
+ * Reply sent when the deadline of a request expires.
+ *
+ * @see Request::setDeadline()
+ */
+enum RequestDeadlineAction {
+    /** The request is rejected. */
+    RejectOnDeadline,
+    /** The request is canceled. */
+    CancelOnDeadline
+};
+
 /**
  * @class BluezQt::Request request.h <BluezQt/Request>
  *
@@ -46,7 +58,16 @@ enum RequestOriginatingType {
  * This class represents a request from a Bluetooth daemon. It is a convenient
  * wrapper around QDBusMessage and easily allows sending replies and handling errors.
  *
- * @see Agent, ObexAgent, Profile
+ * Copies of a request share the reply state. Only the first reply is sent,
+ * any later accept(), reject() or cancel() calls are ignored.
+ *
+ * Replies can be sent from any thread. Replies from other threads than
+ * the main thread are queued and sent from the main thread.
+ *
+ * Requests that are not answered within a deadline can be automatically
+ * rejected or canceled, see setDeadline() and RequestMonitor::setDefaultDeadline().
+ *
+ * @see Agent, ObexAgent, Profile, RequestMonitor
  */
 template<typename T = void>
 class BLUEZQT_EXPORT Request
@@ -105,6 +126,32 @@ public:
      */
     void cancel() const;
 
+    /**
+     * Sets the deadline of the request.
+     *
+     * When the request is not answered within the deadline, counted from
+     * when the request was received, it is rejected or canceled.
+     * Setting a new deadline replaces the previous one.
+     *
+     * @param msecs deadline in milliseconds, -1 to disable the deadline
+     * @param action reply sent when the deadline expires
+     */
+    void setDeadline(int msecs, RequestDeadlineAction action = CancelOnDeadline) const;
+
+    /**
+     * Returns whether the request is still waiting for reply.
+     *
+     * @return true if request was not answered yet
+     */
+    bool isPending() const;
+
+    /**
+     * Returns how long the request is or was waiting for reply.
+     *
+     * @return time from receiving the request until it was answered (or until now) in milliseconds
+     */
+    qint64 pendingTime() const;
+
 private:
     explicit Request(RequestOriginatingType type, const QDBusMessage &message);
 
@@ -130,6 +177,10 @@ public:
     void reject() const;
     void cancel() const;
 
+    void setDeadline(int msecs, RequestDeadlineAction action = CancelOnDeadline) const;
+    bool isPending() const;
+    qint64 pendingTime() const;
+
 private:
     explicit Request(RequestOriginatingType type, const QDBusMessage &message);
 
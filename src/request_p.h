@@ -0,0 +1,100 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_REQUEST_P_H
+#define BLUEZQT_REQUEST_P_H
+
+#include <QObject>
+#include <QDBusMessage>
+#include <QElapsedTimer>
+#include <QSharedPointer>
+
+#include <atomic>
+#include <functional>
+
+#include "request.h"
+
+namespace BluezQt
+{
+
+// Runs functions posted from any thread in the main thread
+class RequestQueue : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit RequestQueue();
+    ~RequestQueue();
+
+    static RequestQueue *instance();
+    static void post(const std::function<void()> &function);
+
+protected:
+    bool event(QEvent *event) override;
+
+private:
+    struct Node
+    {
+        std::function<void()> function;
+        Node *next;
+    };
+
+    static QEvent::Type eventType();
+
+    void push(Node *node);
+    void drain();
+
+    std::atomic<Node*> m_head;
+};
+
+class RequestPrivate
+{
+public:
+    RequestPrivate();
+    ~RequestPrivate();
+
+    static QSharedPointer<RequestPrivate> create(RequestOriginatingType type, const QDBusMessage &message);
+    static void setDeadline(const QSharedPointer<RequestPrivate> &d, int msecs, RequestDeadlineAction action);
+    static bool sendMessage(RequestOriginatingType type, const QDBusMessage &msg);
+
+    RequestOriginatingType m_type;
+    QDBusMessage m_message;
+    QElapsedTimer m_time;
+    std::atomic<bool> m_replied;
+    std::atomic<qint64> m_pendingTime;
+    std::atomic<int> m_deadlineSerial;
+
+    QString interfaceName();
+    bool isPending() const;
+    qint64 pendingTime() const;
+
+    bool claimReply(bool expired);
+    void sendReply(const QDBusMessage &reply);
+
+    void acceptRequest(const QVariant &val);
+    void rejectRequest(bool expired = false);
+    void cancelRequest(bool expired = false);
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_REQUEST_P_H
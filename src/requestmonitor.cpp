@@ -0,0 +1,125 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "requestmonitor.h"
+#include "requestmonitor_p.h"
+
+#include <atomic>
+
+namespace BluezQt
+{
+
+// Counters are updated from any thread that replies to a request
+static std::atomic<int> s_defaultDeadline(-1);
+static std::atomic<int> s_defaultDeadlineAction(CancelOnDeadline);
+static std::atomic<int> s_pending(0);
+static std::atomic<qint64> s_replied(0);
+static std::atomic<qint64> s_expired(0);
+static std::atomic<qint64> s_abandoned(0);
+static std::atomic<qint64> s_totalPendingTime(0);
+static std::atomic<qint64> s_maximumPendingTime(0);
+
+void RequestMonitorPrivate::requestReceived()
+{
+    s_pending++;
+}
+
+void RequestMonitorPrivate::requestReplied(qint64 pendingTime, bool expired)
+{
+    s_pending--;
+    s_replied++;
+    s_totalPendingTime += pendingTime;
+    if (expired) {
+        s_expired++;
+    }
+
+    qint64 maximum = s_maximumPendingTime.load();
+    while (pendingTime > maximum && !s_maximumPendingTime.compare_exchange_weak(maximum, pendingTime)) {
+    }
+}
+
+void RequestMonitorPrivate::requestAbandoned()
+{
+    s_pending--;
+    s_abandoned++;
+}
+
+int RequestMonitor::defaultDeadline()
+{
+    return s_defaultDeadline.load();
+}
+
+RequestDeadlineAction RequestMonitor::defaultDeadlineAction()
+{
+    return static_cast<RequestDeadlineAction>(s_defaultDeadlineAction.load());
+}
+
+void RequestMonitor::setDefaultDeadline(int msecs, RequestDeadlineAction action)
+{
+    s_defaultDeadlineAction = action;
+    s_defaultDeadline = qMax(-1, msecs);
+}
+
+int RequestMonitor::pendingCount()
+{
+    return s_pending.load();
+}
+
+qint64 RequestMonitor::repliedCount()
+{
+    return s_replied.load();
+}
+
+qint64 RequestMonitor::expiredCount()
+{
+    return s_expired.load();
+}
+
+qint64 RequestMonitor::abandonedCount()
+{
+    return s_abandoned.load();
+}
+
+qint64 RequestMonitor::averagePendingTime()
+{
+    const qint64 replied = s_replied.load();
+    if (replied == 0) {
+        return 0;
+    }
+    return s_totalPendingTime.load() / replied;
+}
+
+qint64 RequestMonitor::maximumPendingTime()
+{
+    return s_maximumPendingTime.load();
+}
+
+void RequestMonitor::resetStatistics()
+{
+    s_replied = 0;
+    s_expired = 0;
+    s_abandoned = 0;
+    s_totalPendingTime = 0;
+    s_maximumPendingTime = 0;
+}
+
+} // namespace BluezQt
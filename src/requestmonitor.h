@@ -0,0 +1,131 @@
+/*
+ * BluezQt - Asynchronous Bluez wrapper library
+ *
+ * Copyright (C) 2026 BluezQt Authors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) version 3, or any
+ * later version accepted by the membership of KDE e.V. (or its
+ * successor approved by the membership of KDE e.V.), which shall
+ * act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLUEZQT_REQUESTMONITOR_H
+#define BLUEZQT_REQUESTMONITOR_H
+
+#include "request.h"
+#include "bluezqt_export.h"
+
+namespace BluezQt
+{
+
+/**
+ * @class BluezQt::RequestMonitor requestmonitor.h <BluezQt/RequestMonitor>
+ *
+ * Request monitor.
+ *
+ * This class provides the default deadline of requests and statistics
+ * about how long requests from Bluetooth daemons wait for reply.
+ *
+ * bluetoothd gives up on unanswered requests only after its own D-Bus timeout,
+ * which blocks pairing in the meantime. With a default deadline, requests that
+ * the application does not answer in time are rejected or canceled early.
+ *
+ * All methods are thread-safe.
+ *
+ * @see Request
+ */
+class BLUEZQT_EXPORT RequestMonitor
+{
+public:
+    /**
+     * Returns the default deadline of requests.
+     *
+     * @return deadline in milliseconds, -1 if there is no default deadline
+     */
+    static int defaultDeadline();
+
+    /**
+     * Returns the reply sent when the default deadline expires.
+     *
+     * @return deadline action
+     */
+    static RequestDeadlineAction defaultDeadlineAction();
+
+    /**
+     * Sets the default deadline of requests.
+     *
+     * The deadline is set to all requests received afterwards,
+     * it can be changed for each request with Request::setDeadline().
+     * Default value is -1, meaning there is no deadline.
+     *
+     * @param msecs deadline in milliseconds, -1 to disable the default deadline
+     * @param action reply sent when the deadline expires
+     */
+    static void setDefaultDeadline(int msecs, RequestDeadlineAction action = CancelOnDeadline);
+
+    /**
+     * Returns the number of requests waiting for reply.
+     *
+     * @return number of pending requests
+     */
+    static int pendingCount();
+
+    /**
+     * Returns the number of answered requests.
+     *
+     * This includes requests answered because of expired deadline.
+     *
+     * @return number of answered requests
+     */
+    static qint64 repliedCount();
+
+    /**
+     * Returns the number of requests answered because of expired deadline.
+     *
+     * @return number of expired requests
+     */
+    static qint64 expiredCount();
+
+    /**
+     * Returns the number of requests that were destroyed without reply.
+     *
+     * @return number of abandoned requests
+     */
+    static qint64 abandonedCount();
+
+    /**
+     * Returns the average time answered requests were waiting for reply.
+     *
+     * @return time in milliseconds
+     */
+    static qint64 averagePendingTime();
+
+    /**
+     * Returns the longest time an answered request was waiting for reply.
+     *
+     * @return time in milliseconds
+     */
+    static qint64 maximumPendingTime();
+
+    /**
+     * Resets the statistics.
+     *
+     * The number of pending requests is not reset.
+     */
+    static void resetStatistics();
+};
+
+} // namespace BluezQt
+
+#endif // BLUEZQT_REQUESTMONITOR_H
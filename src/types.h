@@ -34,9 +34,13 @@ class Device;
 class Input;
 class MediaPlayer;
 class MediaPlayerTrack;
+class GattService;
+class GattCharacteristic;
+class GattDescriptor;
 class Agent;
 class DevicesModel;
 class InitManagerJob;
+class BatchJob;
 class Profile;
 class PendingCall;
 class ObexManager;
@@ -53,6 +57,9 @@ typedef QSharedPointer<BluezQt::Adapter> AdapterPtr;
 typedef QSharedPointer<BluezQt::Device> DevicePtr;
 typedef QSharedPointer<BluezQt::Input> InputPtr;
 typedef QSharedPointer<BluezQt::MediaPlayer> MediaPlayerPtr;
+typedef QSharedPointer<BluezQt::GattService> GattServicePtr;
+typedef QSharedPointer<BluezQt::GattCharacteristic> GattCharacteristicPtr;
+typedef QSharedPointer<BluezQt::GattDescriptor> GattDescriptorPtr;
 typedef QSharedPointer<BluezQt::ObexManager> ObexManagerPtr;
 typedef QSharedPointer<BluezQt::ObexSession> ObexSessionPtr;
 typedef QSharedPointer<BluezQt::ObexTransfer> ObexTransferPtr;
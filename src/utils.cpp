@@ -23,12 +23,17 @@
 #include "utils.h"
 #include "manager.h"
 #include "obexmanager.h"
+#include "pendingcall.h"
 #include "bluezqt_export.h"
 
 #include <QPointer>
 #include <QStringList>
 #include <QDBusConnection>
 
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+#include <QRandomGenerator>
+#endif
+
 namespace BluezQt
 {
 
@@ -45,6 +50,9 @@ public:
     QString orgBluezDevice1;
     QString orgBluezInput1;
     QString orgBluezMediaPlayer1;
+    QString orgBluezGattService1;
+    QString orgBluezGattCharacteristic1;
+    QString orgBluezGattDescriptor1;
     QString orgBluezAgentManager1;
     QString orgBluezProfileManager1;
     QString orgBluezObex;
@@ -66,6 +74,9 @@ GlobalData::GlobalData()
     orgBluezDevice1 = QStringLiteral("org.bluez.Device1");
     orgBluezInput1 = QStringLiteral("org.bluez.Input1");
     orgBluezMediaPlayer1 = QStringLiteral("org.bluez.MediaPlayer1");
+    orgBluezGattService1 = QStringLiteral("org.bluez.GattService1");
+    orgBluezGattCharacteristic1 = QStringLiteral("org.bluez.GattCharacteristic1");
+    orgBluezGattDescriptor1 = QStringLiteral("org.bluez.GattDescriptor1");
     orgBluezAgentManager1 = QStringLiteral("org.bluez.AgentManager1");
     orgBluezProfileManager1 = QStringLiteral("org.bluez.ProfileManager1");
     orgBluezObex = QStringLiteral("org.bluez.obex");
@@ -120,6 +131,21 @@ QString Strings::orgBluezMediaPlayer1()
     return globalData->orgBluezMediaPlayer1;
 }
 
+QString Strings::orgBluezGattService1()
+{
+    return globalData->orgBluezGattService1;
+}
+
+QString Strings::orgBluezGattCharacteristic1()
+{
+    return globalData->orgBluezGattCharacteristic1;
+}
+
+QString Strings::orgBluezGattDescriptor1()
+{
+    return globalData->orgBluezGattDescriptor1;
+}
+
 QString Strings::orgBluezAgentManager1()
 {
     return globalData->orgBluezAgentManager1;
@@ -188,6 +214,38 @@ void Instance::setObexManager(ObexManager *obexManager)
     globalData->obexManager = obexManager;
 }
 
+static qreal randomUnit()
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    return QRandomGenerator::global()->generateDouble();
+#else
+    return qreal(qrand()) / RAND_MAX;
+#endif
+}
+
+int Retry::backoffDelay(int retry, int initial, int maximum, qreal jitter)
+{
+    qint64 delay = initial;
+    for (int i = 0; i < retry && delay < maximum; ++i) {
+        delay *= 2;
+    }
+    delay = qMin<qint64>(delay, maximum);
+
+    if (jitter <= 0) {
+        return int(delay);
+    }
+
+    const qreal factor = 1.0 + jitter * (2.0 * randomUnit() - 1.0);
+    return qMax(0, qRound(delay * factor));
+}
+
+bool Retry::isRetryable(int error)
+{
+    return error == PendingCall::ConnectionAttemptFailed
+            || error == PendingCall::NotReady
+            || error == PendingCall::InProgress;
+}
+
 QStringList stringListToUpper(const QStringList &list)
 {
     QStringList converted;
@@ -198,31 +256,43 @@ QStringList stringListToUpper(const QStringList &list)
     return converted;
 }
 
+// Device type for each major device class (bits 8-12 of Class of Device)
+static constexpr Device::Type s_majorClassTypes[32] = {
+    Device::Uncategorized,  // 0x00 Miscellaneous
+    Device::Computer,       // 0x01 Computer
+    Device::Phone,          // 0x02 Phone
+    Device::Network,        // 0x03 LAN/Network Access point
+    Device::AudioVideo,     // 0x04 Audio/Video
+    Device::Peripheral,     // 0x05 Peripheral
+    Device::Imaging,        // 0x06 Imaging
+    Device::Wearable,       // 0x07 Wearable
+    Device::Toy,            // 0x08 Toy
+    Device::Health,         // 0x09 Health
+    Device::Uncategorized, Device::Uncategorized, Device::Uncategorized, Device::Uncategorized,
+    Device::Uncategorized, Device::Uncategorized, Device::Uncategorized, Device::Uncategorized,
+    Device::Uncategorized, Device::Uncategorized, Device::Uncategorized, Device::Uncategorized,
+    Device::Uncategorized, Device::Uncategorized, Device::Uncategorized, Device::Uncategorized,
+    Device::Uncategorized, Device::Uncategorized, Device::Uncategorized, Device::Uncategorized,
+    Device::Uncategorized, Device::Uncategorized
+};
+
 Device::Type classToType(quint32 classNum)
 {
-    switch ((classNum & 0x1f00) >> 8) {
-    case 0x01:
-        return Device::Computer;
-    case 0x02:
-        switch ((classNum & 0xfc) >> 2) {
-        case 0x04:
-            return Device::Modem;
-        default:
-            return Device::Phone;
-        }
-    case 0x03:
-        return Device::Network;
-    case 0x04:
-        switch ((classNum & 0xfc) >> 2) {
-        case 0x01:
-        case 0x02:
+    const Device::Type type = s_majorClassTypes[(classNum & 0x1f00) >> 8];
+    const quint32 minor = (classNum & 0xfc) >> 2;
+
+    // Only some major classes are refined by the minor class
+    switch (type) {
+    case Device::Phone:
+        return minor == 0x04 ? Device::Modem : Device::Phone;
+    case Device::AudioVideo:
+        if (minor == 0x01 || minor == 0x02) {
             return Device::Headset;
-        case 0x06:
+        } else if (minor == 0x06) {
             return Device::Headphones;
-        default:
-            return Device::AudioVideo;
         }
-    case 0x05:
+        return Device::AudioVideo;
+    case Device::Peripheral:
         switch ((classNum & 0xc0) >> 6) {
         case 0x00:
             switch ((classNum & 0x1e) >> 2) {
@@ -242,21 +312,15 @@ Device::Type classToType(quint32 classNum)
             }
         }
         return Device::Peripheral;
-    case 0x06:
+    case Device::Imaging:
         if (classNum & 0x80) {
             return Device::Printer;
         } else if (classNum & 0x20) {
             return Device::Camera;
         }
         return Device::Imaging;
-    case 0x07:
-        return Device::Wearable;
-    case 0x08:
-        return Device::Toy;
-    case 0x09:
-        return Device::Health;
     default:
-        return Device::Uncategorized;
+        return type;
     }
 }
 
@@ -42,6 +42,9 @@ QString orgBluezAdapter1();
 QString orgBluezDevice1();
 QString orgBluezInput1();
 QString orgBluezMediaPlayer1();
+QString orgBluezGattService1();
+QString orgBluezGattCharacteristic1();
+QString orgBluezGattDescriptor1();
 QString orgBluezAgentManager1();
 QString orgBluezProfileManager1();
 QString orgBluezObex();
@@ -71,6 +74,17 @@ void setObexManager(ObexManager *obexManager);
 
 }
 
+namespace Retry
+{
+
+// Delay before the retry: initial doubled for each previous retry, capped at maximum,
+// randomly spread by +- jitter fraction
+int backoffDelay(int retry, int initial, int maximum, qreal jitter = 0);
+// Errors of connection attempts that may succeed when tried again
+bool isRetryable(int error);
+
+}
+
 QStringList stringListToUpper(const QStringList &list);
 Device::Type classToType(quint32 classNum);
 Device::Type appearanceToType(quint16 appearance);
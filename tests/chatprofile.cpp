@@ -22,10 +22,10 @@
 #include "manager.h"
 #include "initmanagerjob.h"
 #include "pendingcall.h"
+#include "profileconnection.h"
 
 #include <QDebug>
 #include <QTimer>
-#include <QLocalSocket>
 #include <QCoreApplication>
 #include <QDBusObjectPath>
 #include <QDBusConnection>
@@ -40,6 +40,7 @@
 
 ChatProfile::ChatProfile(QObject *parent)
     : BluezQt::Profile(parent)
+    , m_connection(nullptr)
 {
     setName(QStringLiteral("BluetoothChatSecure"));
     setChannel(0);
@@ -59,14 +60,15 @@ void ChatProfile::newConnection(BluezQt::DevicePtr device, const QDBusUnixFileDe
 {
     qDebug() << "Connect" << device->name() << properties;
 
-    m_socket = createSocket(fd);
-    if (!m_socket->isValid()) {
+    delete m_connection;
+    m_connection = new BluezQt::ProfileConnection(fd, this);
+    if (!m_connection->isOpen()) {
         request.cancel();
         return;
     }
 
-    connect(m_socket.data(), &QLocalSocket::readyRead, this, &ChatProfile::socketReadyRead);
-    connect(m_socket.data(), &QLocalSocket::disconnected, this, &ChatProfile::socketDisconnected);
+    connect(m_connection, &BluezQt::ProfileConnection::readyRead, this, &ChatProfile::socketReadyRead);
+    connect(m_connection, &BluezQt::ProfileConnection::disconnected, this, &ChatProfile::socketDisconnected);
     QTimer::singleShot(1000, this, SLOT(writeToSocket()));
 
     request.accept();
@@ -86,19 +88,28 @@ void ChatProfile::release()
 
 void ChatProfile::socketReadyRead()
 {
-    qDebug() << "Read:" << m_socket->socketDescriptor() << m_socket->readAll();
+    char buffer[1024];
+    qint64 size;
+    while ((size = m_connection->read(buffer, sizeof(buffer))) > 0) {
+        qDebug() << "Read:" << m_connection->socketDescriptor() << QByteArray(buffer, int(size));
+    }
 }
 
 void ChatProfile::socketDisconnected()
 {
     qDebug() << "Socket disconnected";
-    m_socket.clear();
+    m_connection->deleteLater();
+    m_connection = nullptr;
 }
 
 void ChatProfile::writeToSocket()
 {
-    qDebug() << "Writing" << m_socket->socketDescriptor();
-    m_socket->write(QByteArrayLiteral("test-data"));
+    if (!m_connection) {
+        return;
+    }
+
+    qDebug() << "Writing" << m_connection->socketDescriptor();
+    m_connection->write(QByteArrayLiteral("test-data"));
 }
 
 int main(int argc, char **argv)
@@ -24,7 +24,10 @@
 #include "profile.h"
 #include "device.h"
 
-class QLocalSocket;
+namespace BluezQt
+{
+class ProfileConnection;
+}
 
 class ChatProfile : public BluezQt::Profile
 {
@@ -46,7 +49,7 @@ private Q_SLOTS:
     void writeToSocket();
 
 private:
-    QSharedPointer<QLocalSocket> m_socket;
+    BluezQt::ProfileConnection *m_connection;
 };
 
 #endif // CHATPROFILE_H